@@ -25,11 +25,15 @@ import org.junit.rules.ExpectedException;
 import org.junit.runner.RunWith;
 import org.junit.runners.Parameterized;
 
+import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Date;
 import java.util.List;
 import java.util.Set;
 
+import javax.annotation.Nullable;
+
+import io.realm.MigrationProgressListener.SchemaChange;
 import io.realm.entities.AllJavaTypes;
 import io.realm.entities.CyclicType;
 import io.realm.entities.Dog;
@@ -886,6 +890,46 @@ public class RealmObjectSchemaTests {
         assertArrayEquals(new byte[] {1, 2, 3}, list.get(1));
     }
 
+    @Test
+    public void migrationProgressListener() {
+        if (type == ObjectSchemaType.IMMUTABLE) {
+            return;
+        }
+        final List<String> events = new ArrayList<>();
+        realmSchema.setMigrationProgressListener(new MigrationProgressListener() {
+            @Override
+            public void onProgress(SchemaChange change, String className, @Nullable String fieldName,
+                                   long processedObjects, long totalObjects) {
+                events.add(change + " " + className + "." + fieldName + " " + processedObjects + "/" + totalObjects);
+            }
+        });
+        DynamicRealm dynamicRealm = (DynamicRealm) realm;
+        dynamicRealm.createObject(schema.getClassName());
+        dynamicRealm.createObject(schema.getClassName());
+
+        schema.addField("foo", String.class, FieldAttribute.INDEXED);
+        schema.setRequired("foo", true);
+        schema.setNullable("foo", true);
+        schema.transform(new RealmObjectSchema.Function() {
+            @Override
+            public void apply(DynamicRealmObject obj) {
+                obj.setString("foo", "bar");
+            }
+        });
+
+        assertEquals(Arrays.asList(
+                "ADD_FIELD NewClass.foo 0/2", "ADD_FIELD NewClass.foo 2/2",
+                "ADD_INDEX NewClass.foo 0/2", "ADD_INDEX NewClass.foo 2/2",
+                "SET_REQUIRED NewClass.foo 0/2", "SET_REQUIRED NewClass.foo 2/2",
+                "SET_NULLABLE NewClass.foo 0/2", "SET_NULLABLE NewClass.foo 2/2",
+                "TRANSFORM NewClass.null 0/2", "TRANSFORM NewClass.null 2/2"), events);
+
+        events.clear();
+        realmSchema.setMigrationProgressListener(null);
+        schema.setRequired("foo", true);
+        assertTrue(events.isEmpty());
+    }
+
     @Test
     public void setRequired_true_onPrimaryKeyField_containsNullValues_shouldThrow() {
         if (type == ObjectSchemaType.IMMUTABLE) {
@@ -4000,6 +4000,169 @@ public class RealmQueryTests extends QueryTests {
         }
     }
 
+    @Test
+    public void deleteAllInChunks() {
+        populateTestRealm(realm, 100);
+        final List<Long> progress = new ArrayList<>();
+        long deleted = realm.where(AllTypes.class).lessThan(AllTypes.FIELD_LONG, 50)
+                .deleteAllInChunks(20, new ChunkedDeleteCallback() {
+                    @Override
+                    public boolean onChunkDeleted(long deletedObjects, long totalObjects) {
+                        assertFalse(realm.isInTransaction());
+                        assertEquals(50, totalObjects);
+                        progress.add(deletedObjects);
+                        return true;
+                    }
+                });
+
+        assertEquals(50, deleted);
+        assertEquals(Arrays.asList(20L, 40L, 50L), progress);
+        assertEquals(50, realm.where(AllTypes.class).count());
+        assertEquals(0, realm.where(AllTypes.class).lessThan(AllTypes.FIELD_LONG, 50).count());
+    }
+
+    @Test
+    @RunTestInLooperThread
+    public void deleteAllInChunks_notifiesResultsListenersOnce() {
+        final Realm realm = looperThread.getRealm();
+        populateTestRealm(realm, 100);
+        final AtomicInteger listenerCalls = new AtomicInteger(0);
+        final AtomicInteger chunks = new AtomicInteger(0);
+        final RealmResults<AllTypes> results = realm.where(AllTypes.class).findAll();
+        looperThread.keepStrongReference(results);
+        results.addChangeListener(new RealmChangeListener<RealmResults<AllTypes>>() {
+            @Override
+            public void onChange(RealmResults<AllTypes> results) {
+                listenerCalls.incrementAndGet();
+            }
+        });
+
+        long deleted = realm.where(AllTypes.class).deleteAllInChunks(20, new ChunkedDeleteCallback() {
+            @Override
+            public boolean onChunkDeleted(long deletedObjects, long totalObjects) {
+                chunks.incrementAndGet();
+                return true;
+            }
+        });
+        assertEquals(100, deleted);
+        assertEquals(5, chunks.get());
+        assertTrue(results.isEmpty());
+        assertEquals(1, listenerCalls.get());
+
+        // The commits of the chunks must not trigger any further notifications later on.
+        looperThread.postRunnable(new Runnable() {
+            @Override
+            public void run() {
+                assertEquals(1, listenerCalls.get());
+                looperThread.testComplete();
+            }
+        });
+    }
+
+    @Test
+    public void deleteAllInChunks_stoppedByCallback() {
+        populateTestRealm(realm, 100);
+        long deleted = realm.where(AllTypes.class).deleteAllInChunks(30, new ChunkedDeleteCallback() {
+            @Override
+            public boolean onChunkDeleted(long deletedObjects, long totalObjects) {
+                return deletedObjects < 60;
+            }
+        });
+
+        assertEquals(60, deleted);
+        assertEquals(40, realm.where(AllTypes.class).count());
+    }
+
+    @Test
+    public void deleteAllInChunks_invalidArgumentsThrows() {
+        populateTestRealm();
+        try {
+            realm.where(AllTypes.class).deleteAllInChunks(0, null);
+            fail();
+        } catch (IllegalArgumentException ignored) {
+        }
+
+        try {
+            realm.where(AllTypes.class).sort(AllTypes.FIELD_LONG).deleteAllInChunks(10, null);
+            fail();
+        } catch (IllegalStateException ignored) {
+        }
+
+        realm.beginTransaction();
+        try {
+            realm.where(AllTypes.class).deleteAllInChunks(10, null);
+            fail();
+        } catch (IllegalStateException ignored) {
+        } finally {
+            realm.cancelTransaction();
+        }
+        assertEquals(TEST_DATA_SIZE, realm.where(AllTypes.class).count());
+    }
+
+    @Test
+    public void indexAdvisor_recordsUnindexedPredicates() {
+        populateTestRealm();
+        IndexAdvisor.reset();
+        IndexAdvisor.setEnabled(true);
+        try {
+            realm.where(AllTypes.class).equalTo(AllTypes.FIELD_STRING, "test data 0").findAll();
+            realm.where(AllTypes.class).in(AllTypes.FIELD_LONG, new Long[] {1L, 2L, 3L}).findAll();
+            realm.where(AllTypes.class).greaterThan(AllTypes.FIELD_DATE, new Date(0)).findAll();
+            // Double fields cannot be indexed.
+            realm.where(AllTypes.class).equalTo(AllTypes.FIELD_DOUBLE, Math.PI).findAll();
+        } finally {
+            IndexAdvisor.setEnabled(false);
+        }
+
+        List<IndexAdvisor.Recommendation> recommendations = IndexAdvisor.getRecommendations();
+        assertEquals(3, recommendations.size());
+
+        IndexAdvisor.Recommendation string = findRecommendation(recommendations, AllTypes.FIELD_STRING);
+        assertEquals(AllTypes.CLASS_NAME, string.getClassName());
+        assertEquals(1, string.getEqualityPredicates());
+        assertEquals(0, string.getInPredicates());
+        assertEquals(TEST_DATA_SIZE, string.getRowsScanned());
+
+        IndexAdvisor.Recommendation in = findRecommendation(recommendations, AllTypes.FIELD_LONG);
+        assertEquals(0, in.getEqualityPredicates());
+        assertEquals(1, in.getInPredicates());
+        assertEquals(TEST_DATA_SIZE, in.getRowsScanned());
+
+        // Range predicates are not sped up by an index, so they are ranked last.
+        IndexAdvisor.Recommendation range = recommendations.get(2);
+        assertEquals(AllTypes.FIELD_DATE, range.getFieldName());
+        assertEquals(1, range.getRangePredicates());
+        assertEquals(0, range.getRowsScanned());
+        assertEquals(TEST_DATA_SIZE, range.getRangeRowsScanned());
+
+        DynamicRealm dynamicRealm = DynamicRealm.getInstance(realm.getConfiguration());
+        try {
+            dynamicRealm.beginTransaction();
+            List<IndexAdvisor.Recommendation> indexed = IndexAdvisor.addIndexes(dynamicRealm, TEST_DATA_SIZE);
+            assertEquals(2, indexed.size());
+            RealmObjectSchema schema = dynamicRealm.getSchema().get(AllTypes.CLASS_NAME);
+            assertTrue(schema.hasIndex(AllTypes.FIELD_STRING));
+            assertTrue(schema.hasIndex(AllTypes.FIELD_LONG));
+            assertFalse(schema.hasIndex(AllTypes.FIELD_DATE));
+            dynamicRealm.cancelTransaction();
+        } finally {
+            dynamicRealm.close();
+            IndexAdvisor.reset();
+        }
+        assertTrue(IndexAdvisor.getRecommendations().isEmpty());
+    }
+
+    private static IndexAdvisor.Recommendation findRecommendation(List<IndexAdvisor.Recommendation> recommendations,
+                                                                  String fieldName) {
+        for (IndexAdvisor.Recommendation recommendation : recommendations) {
+            if (recommendation.getFieldName().equals(fieldName)) {
+                return recommendation;
+            }
+        }
+        fail("No recommendation for " + fieldName);
+        return null;
+    }
+
     // FIXME Maybe move to QueryDescriptor or maybe even to RealmFieldType?
     private boolean supportDistinct(RealmFieldType type) {
         switch (type) {
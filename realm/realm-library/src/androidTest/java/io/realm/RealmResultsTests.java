@@ -37,7 +37,9 @@ import java.util.Arrays;
 import java.util.Calendar;
 import java.util.Collections;
 import java.util.Date;
+import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.TimeZone;
 import java.util.concurrent.TimeUnit;
 import java.util.concurrent.atomic.AtomicInteger;
@@ -1504,6 +1506,75 @@ public class RealmResultsTests extends CollectionTests {
 
     }
 
+    @Test
+    public void setValues() {
+        populateAllJavaTypes(5);
+        RealmResults<AllJavaTypes> collection = realm.where(AllJavaTypes.class).findAll();
+        realm.beginTransaction();
+        AllJavaTypes target = realm.createObject(AllJavaTypes.class, 42);
+        Map<String, Object> values = new HashMap<>();
+        values.put(AllJavaTypes.FIELD_STRING, "updated");
+        values.put(AllJavaTypes.FIELD_LONG, 7);
+        values.put(AllJavaTypes.FIELD_DOUBLE, "1.5");
+        values.put(AllJavaTypes.FIELD_DATE, new Date(1000));
+        values.put(AllJavaTypes.FIELD_OBJECT, target);
+        collection.setValues(values);
+        realm.commitTransaction();
+
+        assertEquals(6, collection.size());
+        for (AllJavaTypes obj : collection) {
+            assertEquals("updated", obj.getFieldString());
+            assertEquals(7, obj.getFieldLong());
+            assertEquals(1.5D, obj.getFieldDouble(), 0D);
+            assertEquals(new Date(1000), obj.getFieldDate());
+            assertEquals(target, obj.getFieldObject());
+        }
+    }
+
+    @Test
+    public void setValues_invalidValuesThrows() {
+        populateAllJavaTypes(5);
+        RealmResults<AllJavaTypes> collection = realm.where(AllJavaTypes.class).findAll();
+        realm.beginTransaction();
+        Map<String, Object> values = new HashMap<>();
+        values.put(AllJavaTypes.FIELD_STRING, "updated");
+        values.put(AllJavaTypes.FIELD_LONG, "foo");
+        try {
+            collection.setValues(values);
+            fail();
+        } catch (IllegalArgumentException ignore) {
+        }
+
+        values.remove(AllJavaTypes.FIELD_LONG);
+        values.put("unknownField", 42);
+        try {
+            collection.setValues(values);
+            fail();
+        } catch (IllegalArgumentException ignore) {
+        }
+
+        values.remove("unknownField");
+        values.put(AllJavaTypes.FIELD_LIST, new RealmList<AllJavaTypes>());
+        try {
+            collection.setValues(values);
+            fail();
+        } catch (IllegalArgumentException ignore) {
+        }
+
+        values.remove(AllJavaTypes.FIELD_LIST);
+        values.put(AllJavaTypes.FIELD_ID, 42);
+        try {
+            collection.setValues(values);
+            fail();
+        } catch (IllegalStateException ignore) {
+        }
+        realm.cancelTransaction();
+
+        for (AllJavaTypes obj : collection) {
+            assertTrue(obj.getFieldString().startsWith("test data "));
+        }
+    }
+
     @Test
     public void setValue_specificType_modelClassNameOnTypedRealms() {
         populateMappedAllJavaTypes(5);
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm.internal;
+
+import androidx.test.ext.junit.runners.AndroidJUnit4;
+import androidx.test.platform.app.InstrumentationRegistry;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.rules.TemporaryFolder;
+import org.junit.runner.RunWith;
+
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+
+import io.realm.Realm;
+import io.realm.RealmConfiguration;
+import io.realm.RealmFieldType;
+import io.realm.TestHelper;
+import io.realm.rule.TestRealmConfigurationFactory;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+import static org.junit.Assume.assumeTrue;
+
+@RunWith(AndroidJUnit4.class)
+public class JniProbesTests {
+
+    private static final String HEADER = "function\tcalls\ttotal_ns\tmax_ns\texceptions\n";
+    private static final String TABLE_SIZE = "Java_io_realm_internal_Table_nativeSize";
+
+    @Rule
+    public final TestRealmConfigurationFactory configFactory = new TestRealmConfigurationFactory();
+
+    @Rule
+    public final TemporaryFolder tempFolder = new TemporaryFolder();
+
+    private OsSharedRealm sharedRealm;
+    private Table table;
+
+    @Before
+    public void setUp() {
+        Realm.init(InstrumentationRegistry.getInstrumentation().getContext());
+        RealmConfiguration config = configFactory.createConfiguration();
+        sharedRealm = OsSharedRealm.getInstance(config, OsSharedRealm.VersionID.LIVE);
+        table = TestHelper.createTable(sharedRealm, "temp", new TestHelper.AdditionalTableSetup() {
+            @Override
+            public void execute(Table table) {
+                table.addColumn(RealmFieldType.INTEGER, "number");
+            }
+        });
+        JniProbes.reset();
+    }
+
+    @After
+    public void tearDown() {
+        JniProbes.setEnabled(false);
+        JniProbes.reset();
+        if (sharedRealm != null && !sharedRealm.isClosed()) {
+            sharedRealm.close();
+        }
+    }
+
+    @Test
+    public void disabled_recordsNothing() {
+        JniProbes.setEnabled(false);
+        for (int i = 0; i < 10; i++) {
+            table.size();
+        }
+        assertEquals(HEADER, JniProbes.dump());
+    }
+
+    @Test
+    public void enabled_recordsCalls() {
+        assumeTrue(JniProbes.isAvailable());
+        JniProbes.setEnabled(true);
+        assertTrue(JniProbes.isEnabled());
+        for (int i = 0; i < 10; i++) {
+            table.size();
+        }
+        JniProbes.setEnabled(false);
+
+        String line = findLine(JniProbes.dump(), TABLE_SIZE);
+        String[] columns = line.split("\t");
+        assertEquals(5, columns.length);
+        assertEquals(10, Long.parseLong(columns[1]));
+        assertTrue(Long.parseLong(columns[2]) >= Long.parseLong(columns[3]));
+        assertEquals(0, Long.parseLong(columns[4]));
+
+        JniProbes.reset();
+        assertEquals(HEADER, JniProbes.dump());
+    }
+
+    @Test
+    public void enabled_countsConvertedExceptions() {
+        assumeTrue(JniProbes.isAvailable());
+        JniProbes.setEnabled(true);
+        try {
+            // Adding a column outside of a write transaction fails in Core.
+            table.addColumn(RealmFieldType.STRING, "name");
+            fail();
+        } catch (RuntimeException ignored) {
+        }
+        JniProbes.setEnabled(false);
+
+        String[] columns = findLine(JniProbes.dump(), "Java_io_realm_internal_Table_nativeAddColumn").split("\t");
+        assertEquals(1, Long.parseLong(columns[4]));
+    }
+
+    @Test
+    public void dumpToFile() throws IOException {
+        assumeTrue(JniProbes.isAvailable());
+        JniProbes.setEnabled(true);
+        table.size();
+        JniProbes.setEnabled(false);
+
+        File file = tempFolder.newFile("probes.tsv");
+        JniProbes.dumpToFile(file.getAbsolutePath());
+        byte[] content = new byte[(int) file.length()];
+        try (FileInputStream input = new FileInputStream(file)) {
+            assertEquals(content.length, input.read(content));
+        }
+        assertTrue(new String(content, "UTF-8").startsWith(HEADER));
+        assertFalse(findLine(new String(content, "UTF-8"), TABLE_SIZE).isEmpty());
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void dumpToFile_invalidPathThrows() {
+        JniProbes.dumpToFile(new File(tempFolder.getRoot(), "missing/probes.tsv").getAbsolutePath());
+    }
+
+    private static String findLine(String dump, String function) {
+        for (String line : dump.split("\n")) {
+            if (line.startsWith(function + "\t")) {
+                return line;
+            }
+        }
+        throw new AssertionError(function + " not found in: " + dump);
+    }
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm.internal;
+
+import androidx.test.ext.junit.runners.AndroidJUnit4;
+import androidx.test.platform.app.InstrumentationRegistry;
+
+import org.junit.After;
+import org.junit.Before;
+import org.junit.Rule;
+import org.junit.Test;
+import org.junit.runner.RunWith;
+
+import java.util.ArrayList;
+import java.util.List;
+
+import io.realm.Realm;
+import io.realm.RealmConfiguration;
+import io.realm.RealmFieldType;
+import io.realm.TestHelper;
+import io.realm.rule.TestRealmConfigurationFactory;
+
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assert.fail;
+
+@RunWith(AndroidJUnit4.class)
+public class NativeObjectCountersTests {
+
+    @Rule
+    public final TestRealmConfigurationFactory configFactory = new TestRealmConfigurationFactory();
+
+    private OsSharedRealm sharedRealm;
+    private Table table;
+
+    @Before
+    public void setUp() {
+        Realm.init(InstrumentationRegistry.getInstrumentation().getContext());
+        RealmConfiguration config = configFactory.createConfiguration();
+        sharedRealm = OsSharedRealm.getInstance(config, OsSharedRealm.VersionID.LIVE);
+        table = TestHelper.createTable(sharedRealm, "temp", new TestHelper.AdditionalTableSetup() {
+            @Override
+            public void execute(Table table) {
+                long colKey = table.addColumn(RealmFieldType.INTEGER, "number");
+                TestHelper.addRowWithValues(table, new long[]{colKey}, new Object[]{42});
+            }
+        });
+    }
+
+    @After
+    public void tearDown() {
+        if (sharedRealm != null && !sharedRealm.isClosed()) {
+            sharedRealm.close();
+        }
+    }
+
+    // Other objects may be finalized concurrently, so only objects held by the test can be relied upon.
+    @Test
+    public void countsLiveQueriesAndRows() {
+        List<TableQuery> queries = new ArrayList<>();
+        List<UncheckedRow> rows = new ArrayList<>();
+        long rowKey = table.where().find();
+        for (int i = 0; i < 100; i++) {
+            queries.add(table.where());
+            rows.add(table.getUncheckedRow(rowKey));
+        }
+
+        assertTrue(NativeObjectCounters.getCount(NativeObjectCounters.KIND_QUERY) >= queries.size());
+        assertTrue(NativeObjectCounters.getCount(NativeObjectCounters.KIND_OBJ) >= rows.size());
+        assertTrue(NativeObjectCounters.getHighWaterMark(NativeObjectCounters.KIND_QUERY) >= queries.size());
+        assertTrue(NativeObjectCounters.getHighWaterMark(NativeObjectCounters.KIND_OBJ) >= rows.size());
+    }
+
+    @Test
+    public void globalRefsAreCounted() {
+        // The callback classes resolved in JNI_OnLoad are held as global refs for the lifetime of the library.
+        assertTrue(NativeObjectCounters.getCount(NativeObjectCounters.KIND_GLOBAL_REF) > 0);
+        assertTrue(NativeObjectCounters.getCount(NativeObjectCounters.KIND_GLOBAL_REF)
+                >= NativeObjectCounters.getCount(NativeObjectCounters.KIND_KEPT_GLOBAL_REF));
+    }
+
+    @Test
+    public void resetHighWaterMarks() {
+        List<TableQuery> queries = new ArrayList<>();
+        for (int i = 0; i < 10; i++) {
+            queries.add(table.where());
+        }
+        NativeObjectCounters.resetHighWaterMarks();
+        assertTrue(NativeObjectCounters.getHighWaterMark(NativeObjectCounters.KIND_QUERY) >= queries.size());
+    }
+
+    @Test
+    public void dump() {
+        String dump = NativeObjectCounters.dump();
+        assertTrue(dump.contains("Query="));
+        assertTrue(dump.contains("GlobalRef="));
+        assertTrue(dump.contains("AttachedThreads="));
+    }
+
+    @Test
+    public void invalidKindThrows() {
+        for (int kind : new int[]{-1, NativeObjectCounters.KIND_COUNT}) {
+            try {
+                NativeObjectCounters.getCount(kind);
+                fail();
+            } catch (IllegalArgumentException ignored) {
+            }
+            try {
+                NativeObjectCounters.getHighWaterMark(kind);
+                fail();
+            } catch (IllegalArgumentException ignored) {
+            }
+        }
+    }
+}
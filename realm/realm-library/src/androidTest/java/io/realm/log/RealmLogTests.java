@@ -109,4 +109,29 @@ public class RealmLogTests {
         assertTrue(testLogger.message.equals("45"));
         RealmLog.nativeCloseCoreLoggerBridge(ptr);
     }
+
+    @Test
+    public void asyncDelivery() {
+        TestHelper.TestLogger testLogger = new TestHelper.TestLogger();
+        RealmLog.setLevel(LogLevel.INFO);
+        RealmLog.add(testLogger);
+        RealmLog.setAsyncDelivery(true);
+        try {
+            long ptr = RealmLog.nativeCreateCoreLoggerBridge("TEST");
+            RealmLog.nativeLogToCoreLoggerBridge(ptr, LogLevel.INFO, "42");
+            RealmLog.nativeLogToCoreLoggerBridge(ptr, LogLevel.INFO, "43");
+            RealmLog.nativeFlushAsyncDelivery();
+            assertEquals("42", testLogger.previousMessage);
+            assertEquals("43", testLogger.message);
+            RealmLog.nativeCloseCoreLoggerBridge(ptr);
+
+            // Throwables can't be passed across threads, so those are still delivered synchronously.
+            Throwable throwable = new RuntimeException("Test exception.");
+            RealmLog.fatal(throwable);
+            assertEquals(throwable, testLogger.throwable);
+        } finally {
+            RealmLog.setAsyncDelivery(false);
+            RealmLog.remove(testLogger);
+        }
+    }
 }
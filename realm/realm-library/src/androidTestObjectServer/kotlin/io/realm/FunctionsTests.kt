@@ -19,6 +19,8 @@ package io.realm
 import androidx.test.ext.junit.runners.AndroidJUnit4
 import androidx.test.platform.app.InstrumentationRegistry
 import io.realm.admin.ServerAdmin
+import io.realm.internal.network.OkHttpNetworkTransport
+import io.realm.internal.objectstore.OsJavaNetworkTransport.Response
 import io.realm.mongodb.*
 import io.realm.mongodb.functions.Functions
 import io.realm.rule.BlockingLooperThread
@@ -40,8 +42,11 @@ import org.junit.Test
 import org.junit.runner.RunWith
 import java.lang.RuntimeException
 import java.util.*
+import java.util.concurrent.TimeUnit
+import java.util.concurrent.atomic.AtomicInteger
 import kotlin.test.assertEquals
 import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
 import kotlin.test.assertNotNull
 import kotlin.test.assertTrue
 
@@ -194,17 +199,25 @@ class FunctionsTests {
                     val now = Date(System.currentTimeMillis())
                     assertEquals(now, functions.callFunction(FIRST_ARG_FUNCTION, listOf(now), Date::class.java))
                 }
+                BsonType.REGULAR_EXPRESSION -> {
+                    assertTypeOfFirstArgFunction(BsonRegularExpression("^Re.*m$", "im"), BsonRegularExpression::class.java)
+                }
+                BsonType.TIMESTAMP -> {
+                    assertTypeOfFirstArgFunction(BsonTimestamp(1600000000, 7), BsonTimestamp::class.java)
+                }
+                BsonType.MIN_KEY -> {
+                    assertTypeOfFirstArgFunction(BsonMinKey(), BsonMinKey::class.java)
+                }
+                BsonType.MAX_KEY -> {
+                    assertTypeOfFirstArgFunction(BsonMaxKey(), BsonMaxKey::class.java)
+                }
                 BsonType.UNDEFINED,
                 BsonType.NULL,
-                BsonType.REGULAR_EXPRESSION,
                 BsonType.SYMBOL,
                 BsonType.DB_POINTER,
                 BsonType.JAVASCRIPT,
                 BsonType.JAVASCRIPT_WITH_SCOPE,
-                BsonType.TIMESTAMP,
-                BsonType.END_OF_DOCUMENT,
-                BsonType.MIN_KEY,
-                BsonType.MAX_KEY -> {
+                BsonType.END_OF_DOCUMENT -> {
                     // Relying on org.bson codec providers for conversion, so skipping explicit
                     // tests for these more exotic types
                 }
@@ -424,6 +437,54 @@ class FunctionsTests {
         assertNotNull(authorizedUser.functions.callFunction("authorizedOnly", listOf(1, 2, 3), Document::class.java))
     }
 
+    @Test
+    fun callFunction_functionCallCache() {
+        val requests = AtomicInteger(0)
+        app.close()
+        Realm.init(InstrumentationRegistry.getInstrumentation().targetContext)
+        app = TestApp(object : OkHttpNetworkTransport(null) {
+            override fun sendRequest(method: String, url: String, timeoutMs: Long, headers: MutableMap<String, String>, body: ByteArray?): Response {
+                if (url.contains("/functions/call")) {
+                    requests.incrementAndGet()
+                }
+                return super.sendRequest(method, url, timeoutMs, headers, body)
+            }
+        }, builder = { it.functionCallCache(1, TimeUnit.MINUTES) })
+        assertTrue(app.configuration.isFunctionCallCacheEnabled)
+        val functions = app.login(Credentials.anonymous()).functions
+
+        // Identical calls are answered from the cache
+        assertEquals(1, functions.callFunction(FIRST_ARG_FUNCTION, listOf(1, 2), Integer::class.java).toInt())
+        assertEquals(1, functions.callFunction(FIRST_ARG_FUNCTION, listOf(1, 2), Integer::class.java).toInt())
+        assertEquals(1, requests.get())
+
+        // Different arguments or function names are not
+        assertEquals(2, functions.callFunction(FIRST_ARG_FUNCTION, listOf(2, 1), Integer::class.java).toInt())
+        assertEquals(2, requests.get())
+
+        // Errors are not cached
+        assertFailsWithErrorCode(ErrorCode.FUNCTION_EXECUTION_ERROR) {
+            functions.callFunction("authorizedOnly", listOf(1, 2, 3), Document::class.java)
+        }
+        assertFailsWithErrorCode(ErrorCode.FUNCTION_EXECUTION_ERROR) {
+            functions.callFunction("authorizedOnly", listOf(1, 2, 3), Document::class.java)
+        }
+        assertEquals(4, requests.get())
+
+        // Results are not shared with other users
+        val otherFunctions = app.registerUserAndLogin("functioncache@example.org", "123456").functions
+        assertEquals(1, otherFunctions.callFunction(FIRST_ARG_FUNCTION, listOf(1, 2), Integer::class.java).toInt())
+        assertEquals(5, requests.get())
+    }
+
+    @Test
+    fun functionCallCache_invalidArgumentsThrows() {
+        val builder = AppConfiguration.Builder("app-id")
+        assertFailsWith<IllegalArgumentException> { builder.functionCallCache(-1, TimeUnit.SECONDS) }
+        assertFailsWith<IllegalArgumentException> { builder.functionCallCache(1, TestHelper.getNull()) }
+        assertFalse(builder.build().isFunctionCallCacheEnabled)
+    }
+
     @Test
     fun getApp() {
         assertEquals(app, functions.app)
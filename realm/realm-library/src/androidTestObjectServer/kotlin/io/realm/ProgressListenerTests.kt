@@ -94,6 +94,66 @@ class ProgressListenerTests {
         }
     }
 
+    @Test
+    fun downloadProgressListener_throttled() {
+        val allChangesDownloaded = CountDownLatch(1)
+        val notifications = AtomicInteger(0)
+        val user1: User = app.registerUserAndLogin(TestHelper.getRandomEmail(), "123456")
+        val user1Config = createSyncConfig(user1)
+        createRemoteData(user1Config)
+        val user2: User = app.registerUserAndLogin(TestHelper.getRandomEmail(), "123456")
+        val user2Config = createSyncConfig(user2)
+        Realm.getInstance(user2Config).use { realm ->
+            // Only the first event and the completion get through
+            realm.syncSession.addDownloadProgressListener(ProgressMode.CURRENT_CHANGES, 1, TimeUnit.HOURS, Long.MAX_VALUE) { progress ->
+                notifications.incrementAndGet()
+                if (progress.isTransferComplete) {
+                    assertTransferComplete(progress, true)
+                    assertEquals(TEST_SIZE, getStoreTestDataSize(user2Config))
+                    allChangesDownloaded.countDown()
+                }
+            }
+            TestHelper.awaitOrFail(allChangesDownloaded)
+            assertTrue(notifications.get() <= 2)
+        }
+    }
+
+    @Test
+    fun initialRemoteDataProgressListener() {
+        val allChangesDownloaded = CountDownLatch(1)
+        val user1: User = app.registerUserAndLogin(TestHelper.getRandomEmail(), "123456")
+        val user1Config = createSyncConfig(user1)
+        createRemoteData(user1Config)
+        val user2: User = app.registerUserAndLogin(TestHelper.getRandomEmail(), "123456")
+        val user2Config = SyncConfiguration.Builder(user2, getTestPartitionValue())
+                .modules(DefaultSyncSchema())
+                .waitForInitialRemoteData()
+                .initialRemoteDataProgressListener { progress ->
+                    if (progress.isTransferComplete) {
+                        assertTransferComplete(progress, true)
+                        allChangesDownloaded.countDown()
+                    }
+                }
+                .build()
+        Realm.getInstance(user2Config).use { realm ->
+            TestHelper.awaitOrFail(allChangesDownloaded)
+            assertEquals(TEST_SIZE, realm.where<SyncDog>().count())
+        }
+    }
+
+    @Test
+    fun addProgressListener_throttled_invalidArgumentsThrows() {
+        Realm.getInstance(createSyncConfig()).use { realm ->
+            val session = realm.syncSession
+            assertFailsWith<IllegalArgumentException> {
+                session.addDownloadProgressListener(ProgressMode.INDEFINITELY, -1, TimeUnit.SECONDS, 0) { }
+            }
+            assertFailsWith<IllegalArgumentException> {
+                session.addUploadProgressListener(ProgressMode.INDEFINITELY, 0, TimeUnit.SECONDS, -1) { }
+            }
+        }
+    }
+
     @Test
     fun downloadProgressListener_indefinitely() {
         val transferCompleted = AtomicInteger(0)
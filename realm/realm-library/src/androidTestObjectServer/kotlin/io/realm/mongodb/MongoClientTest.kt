@@ -25,6 +25,8 @@ import io.realm.mongodb.mongo.events.BaseChangeEvent.OperationType
 import io.realm.mongodb.mongo.options.CountOptions
 import io.realm.mongodb.mongo.options.FindOneAndModifyOptions
 import io.realm.mongodb.mongo.options.FindOptions
+import io.realm.mongodb.mongo.options.InsertManyException
+import io.realm.mongodb.mongo.options.InsertManyOptions
 import io.realm.mongodb.mongo.options.UpdateOptions
 import io.realm.rule.BlockingLooperThread
 import io.realm.util.assertFailsWithErrorCode
@@ -265,6 +267,40 @@ class MongoClientTest {
         }
     }
 
+    @Test
+    fun find_batchSize() {
+        with(getCollectionInternal()) {
+            // Paging an empty collection
+            assertFalse(find().batchSize(10).iterator().get()!!.hasNext())
+
+            val documents = (0 until 25).map { i -> Document("index", i % 5).apply { this["_id"] = ObjectId() } }
+            insertMany(documents).get()
+
+            // Pages continue after duplicate sort values and stop at the limit
+            val expected = documents.sortedWith(compareBy({ -(it["index"] as Int) }, { it.getObjectId("_id") }))
+            val cursor = find()
+                    .sort(Document("index", -1))
+                    .batchSize(4)
+                    .limit(22)
+                    .iterator().get()!!
+            val actual = cursor.asSequence().toList()
+            cursor.close()
+            assertEquals(expected.take(22), actual)
+
+            // The projection must keep the sort fields
+            assertFailsWith<AppException> {
+                find().sort(Document("index", 1))
+                        .projection(Document("_id", 1))
+                        .batchSize(4)
+                        .iterator().get()
+            }
+
+            assertFailsWith<IllegalArgumentException> {
+                find().batchSize(-1)
+            }
+        }
+    }
+
     @Test
     fun aggregate() {
         with(getCollectionInternal()) {
@@ -304,6 +340,21 @@ class MongoClientTest {
         }
     }
 
+    @Test
+    fun aggregate_batchSize() {
+        with(getCollectionInternal()) {
+            val documents = (0 until 25).map { i -> Document("index", i).apply { this["_id"] = ObjectId() } }
+            insertMany(documents).get()
+
+            // Pages are ordered by "_id"
+            val cursor = aggregate(listOf(Document("\$match", Document("index", Document("\$gte", 5)))))
+                    .batchSize(10)
+                    .iterator().get()!!
+            assertEquals(documents.drop(5).sortedBy { it.getObjectId("_id") }, cursor.asSequence().toList())
+            cursor.close()
+        }
+    }
+
     @Test
     fun insertOne() {
         with(getCollectionInternal()) {
@@ -460,6 +511,59 @@ class MongoClientTest {
         }
     }
 
+    @Test
+    fun insertMany_batches() {
+        with(getCollectionInternal()) {
+            val documents = (0 until 100).map { i -> Document("index", i).apply { this["_id"] = ObjectId() } }
+            var lastProgress = 0L
+            val options = InsertManyOptions()
+                    .maxBatchSize(10)
+                    .maxRequestsInFlight(3)
+                    .progressListener { inserted, total ->
+                        assertEquals(100, total)
+                        assertTrue(inserted > lastProgress)
+                        lastProgress = inserted
+                    }
+
+            val insertedIds = insertMany(documents, options).get()!!.insertedIds
+            assertEquals(100, insertedIds.size)
+            insertedIds.forEach { entry ->
+                assertEquals(documents[entry.key.toInt()]["_id"], entry.value.asObjectId().value)
+            }
+            assertEquals(100, lastProgress)
+            assertEquals(100, count().get())
+        }
+    }
+
+    @Test
+    fun insertMany_batches_fails() {
+        with(getCollectionInternal()) {
+            val documents = (0 until 20).map { i -> Document("index", i).apply { this["_id"] = ObjectId() } }
+            insertMany(documents.subList(15, 16)).get()
+
+            assertFailsWithErrorCode(ErrorCode.MONGODB_ERROR) {
+                insertMany(documents, InsertManyOptions().maxBatchSize(5)).get()
+            }.also { e ->
+                assertTrue(e.errorMessage!!.contains("duplicate", true))
+                // Batches are inserted one after another by default, so the three before the duplicate succeeded
+                val insertedIds = (e as InsertManyException).partialResult.insertedIds
+                assertEquals((0L until 15L).toSet(), insertedIds.keys)
+                insertedIds.forEach { entry ->
+                    assertEquals(documents[entry.key.toInt()]["_id"], entry.value.asObjectId().value)
+                }
+            }
+        }
+    }
+
+    @Test
+    fun insertMany_emptyListThrows() {
+        with(getCollectionInternal()) {
+            assertFailsWith<IllegalArgumentException> {
+                insertMany(listOf()).get()
+            }
+        }
+    }
+
     @Test
     fun deleteOne_singleDocument() {
         with(getCollectionInternal()) {
@@ -21,6 +21,7 @@ import androidx.test.platform.app.InstrumentationRegistry
 import io.realm.*
 import io.realm.TestHelper.TestLogger
 import io.realm.entities.DefaultSyncSchema
+import io.realm.entities.SyncDog
 import io.realm.entities.SyncStringOnly
 import io.realm.entities.SyncStringOnlyModule
 import io.realm.exceptions.RealmFileException
@@ -123,6 +124,79 @@ class SessionTests {
         }
     }
 
+    @Test
+    fun getMetrics() {
+        Realm.getInstance(configuration).use { realm ->
+            val session = realm.syncSession
+            realm.executeTransaction {
+                for (i in 0 until 10) {
+                    realm.createObject(SyncDog::class.java, ObjectId()).name = "Fido $i"
+                }
+            }
+            session.uploadAllLocalChanges()
+            // The progress notification completing the upload can arrive just after the wait returns
+            val deadline = System.currentTimeMillis() + 5000
+            while (session.metrics.uploadRoundTrips == 0L && System.currentTimeMillis() < deadline) {
+                Thread.sleep(10)
+            }
+
+            val metrics = session.metrics
+            assertTrue(metrics.bytesUploaded > 0)
+            assertTrue(metrics.uploadBatches > 0)
+            assertTrue(metrics.uploadRoundTrips > 0)
+            assertTrue(metrics.maxUploadLatencyMs >= metrics.averageUploadLatencyMs)
+            assertTrue(metrics.getTimeInStateMs(ConnectionState.CONNECTED) >= 0)
+
+            session.resetMetrics()
+            assertEquals(0, session.metrics.bytesUploaded)
+            assertEquals(0, session.metrics.uploadRoundTrips)
+        }
+    }
+
+    @Test
+    fun getMetrics_sessionCreatedBeforeRealm() {
+        // The native session created along with this one is not kept alive, opening the Realm creates another one
+        val session = app.sync.getOrCreateSession(configuration)
+        Realm.getInstance(configuration).use { realm ->
+            assertTrue(session === realm.syncSession)
+            realm.executeTransaction {
+                realm.createObject(SyncDog::class.java, ObjectId()).name = "Fido"
+            }
+            // Uploaded before the metrics are read, which would also attach them to the session of the Realm
+            session.uploadAllLocalChanges()
+            val deadline = System.currentTimeMillis() + 5000
+            while (session.metrics.uploadRoundTrips == 0L && System.currentTimeMillis() < deadline) {
+                Thread.sleep(10)
+            }
+            assertTrue(session.metrics.bytesUploaded > 0)
+        }
+    }
+
+    @Test
+    fun getMetrics_afterReopen() {
+        Realm.getInstance(configuration).use { realm ->
+            realm.executeTransaction {
+                realm.createObject(SyncDog::class.java, ObjectId()).name = "Fido"
+            }
+            realm.syncSession.uploadAllLocalChanges()
+        }
+
+        // Closing the Realm ended the session, the new one records from the start
+        Realm.getInstance(configuration).use { realm ->
+            val session = realm.syncSession
+            realm.executeTransaction {
+                realm.createObject(SyncDog::class.java, ObjectId()).name = "Rex"
+            }
+            session.uploadAllLocalChanges()
+            val deadline = System.currentTimeMillis() + 5000
+            while (session.metrics.uploadRoundTrips == 0L && System.currentTimeMillis() < deadline) {
+                Thread.sleep(10)
+            }
+            assertTrue(session.metrics.bytesUploaded > 0)
+            assertTrue(session.metrics.uploadRoundTrips > 0)
+        }
+    }
+
     // Check that a Client Reset is correctly reported.
     @Test
     fun errorHandler_clientResetReported() = looperThread.runBlocking {
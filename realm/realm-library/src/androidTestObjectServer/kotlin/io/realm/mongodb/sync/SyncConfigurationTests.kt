@@ -416,6 +416,22 @@ class SyncConfigurationTests {
         assertTrue(configuration.isAllowQueriesOnUiThread)
     }
 
+    @Test
+    fun initialRemoteDataProgressListener() {
+        val listener = ProgressListener { }
+        val configuration = SyncConfiguration.Builder(createTestUser(app), DEFAULT_PARTITION)
+                .waitForInitialRemoteData()
+                .initialRemoteDataProgressListener(listener)
+                .build()
+        assertEquals(listener, configuration.initialRemoteDataProgressListener)
+    }
+
+    @Test
+    fun initialRemoteDataProgressListener_nullThrows() {
+        val builder = SyncConfiguration.Builder(createTestUser(app), DEFAULT_PARTITION)
+        assertFailsWith<IllegalArgumentException> { builder.initialRemoteDataProgressListener(TestHelper.getNull()) }
+    }
+
     @Test
     fun allowWritesOnUiThread_defaultsToFalse() {
         val builder: SyncConfiguration.Builder = SyncConfiguration.Builder(createTestUser(app), DEFAULT_PARTITION)
@@ -20,12 +20,14 @@ import androidx.test.platform.app.InstrumentationRegistry
 import io.realm.Realm
 import io.realm.internal.network.OkHttpNetworkTransport
 import io.realm.internal.objectstore.OsJavaNetworkTransport
+import org.junit.Assert.assertArrayEquals
 import org.junit.Assert.assertEquals
 import org.junit.Assert.assertTrue
 import org.junit.Before
 import org.junit.Ignore
 import org.junit.Test
 import org.junit.runner.RunWith
+import java.nio.ByteBuffer
 
 /**
  * This class is responsible for testing the OkHttp implementation of the network layer.
@@ -93,6 +95,28 @@ class OkHttpNetworkTransportTests {
         }
     }
 
+    @Test
+    fun requestSuccessful_bytes() {
+        val url = "$baseUrl/okhttp?success=true"
+        for (method in HTTPMethod.values()) {
+            val body = if (method == HTTPMethod.GET) "" else "{ \"body\" : \"søme cöntent\" }"
+            val headers = mapOf(
+                    Pair("Content-Type", "application/json;charset=utf-8"),
+                    Pair("Accept", "application/json")
+            )
+
+            val response: OsJavaNetworkTransport.Response = transport.sendRequest(method.nativeKey,
+                    url,
+                    5000,
+                    headers,
+                    body.toByteArray(Charsets.UTF_8))
+            assertEquals(200, response.httpResponseCode)
+            assertEquals(0, response.customResponseCode)
+            assertArrayEquals("${method.name}-success".toByteArray(Charsets.UTF_8), response.bodyBytes)
+            assertEquals("${method.name}-success", response.body)
+        }
+    }
+
     // Make sure that the client doesn't crash if attempting to send invalid JSON
     // This is mostly a guard against Java crashing if ObjectStore serializes the wrong
     // way by accident.
@@ -139,6 +163,34 @@ class OkHttpNetworkTransportTests {
     }
 
 
+    // Validate that a streamed response can be read in chunks of raw bytes
+    @Test
+    fun streamRequest_readBody() {
+        val url = "$baseUrl/watcher"
+
+        val headers = mapOf(
+                Pair("Accept", "text/event-stream")
+        )
+
+        val request = OsJavaNetworkTransport.Request("get", url, headers, "")
+        val response = transport.sendStreamingRequest(request)
+
+        assertEquals(200, response.httpResponseCode)
+        val buffer = ByteBuffer.allocateDirect(1024)
+        val body = StringBuilder()
+        while (!body.contains("hello world 2")) {
+            buffer.clear()
+            val length = response.readBody(buffer)
+            assertTrue(length > 0)
+            buffer.flip()
+            body.append(Charsets.UTF_8.decode(buffer))
+        }
+        assertTrue(body.startsWith("hello world 1"))
+
+        response.close()
+    }
+
+
     @Test
     fun requestInterrupted() {
         val url = "$baseUrl/okhttp?success=true"
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+package io.realm.transport
+
+import androidx.test.ext.junit.runners.AndroidJUnit4
+import androidx.test.platform.app.InstrumentationRegistry
+import io.realm.DATABASE_NAME
+import io.realm.Realm
+import io.realm.SERVICE_NAME
+import io.realm.TestApp
+import io.realm.TestHelper
+import io.realm.internal.network.OkHttpNetworkTransport
+import io.realm.internal.objectstore.OsJavaNetworkTransport
+import io.realm.internal.objectstore.OsNativeNetworkTransport
+import io.realm.mongodb.AppConfiguration
+import io.realm.mongodb.close
+import io.realm.mongodb.registerUserAndLogin
+import org.bson.Document
+import org.junit.Assert.assertEquals
+import org.junit.Assert.assertNotNull
+import org.junit.Assert.assertTrue
+import org.junit.Before
+import org.junit.Test
+import org.junit.runner.RunWith
+import java.util.concurrent.Callable
+import java.util.concurrent.Executors
+import java.util.concurrent.TimeUnit
+
+/**
+ * Tests the native implementation of the network layer against the command server, which must be running when
+ * executing these tests. See [OkHttpNetworkTransportTests].
+ */
+@RunWith(AndroidJUnit4::class)
+class OsNativeNetworkTransportTests {
+
+    private lateinit var transport: OsNativeNetworkTransport
+    private val baseUrl = "http://127.0.0.1:8888" // URL to command server
+
+    enum class HTTPMethod(val nativeKey: String) {
+        GET("get"), POST("post"), PATCH("patch"), PUT("put"), DELETE("delete");
+    }
+
+    private val headers = mapOf(
+            Pair("Content-Type", "application/json;charset=utf-8"),
+            Pair("Accept", "application/json")
+    )
+
+    @Before
+    fun setUp() {
+        Realm.init(InstrumentationRegistry.getInstrumentation().targetContext)
+        transport = OsNativeNetworkTransport(AppConfiguration.DEFAULT_AUTHORIZATION_HEADER_NAME,
+                emptyMap(),
+                OkHttpNetworkTransport(null))
+    }
+
+    @Test
+    fun requestSuccessful() {
+        val url = "$baseUrl/okhttp?success=true"
+        for (method in HTTPMethod.values()) {
+            val body = if (method == HTTPMethod.GET) "" else "{ \"body\" : \"some content\" }"
+            val response: OsJavaNetworkTransport.Response = transport.sendRequest(method.nativeKey, url, 5000, headers, body)
+            assertEquals(200, response.httpResponseCode)
+            assertEquals(0, response.customResponseCode)
+            assertEquals("${method.name}-success", response.body)
+            assertEquals("text/plain", response.headers["Content-Type"] ?: response.headers["content-type"])
+        }
+    }
+
+    @Test
+    fun requestFailedOnServer() {
+        val url = "$baseUrl/okhttp?success=false"
+        for (method in HTTPMethod.values()) {
+            val body = if (method == HTTPMethod.GET) "" else "{ \"body\" : \"some content\" }"
+            val response: OsJavaNetworkTransport.Response = transport.sendRequest(method.nativeKey, url, 5000, headers, body)
+            assertEquals(500, response.httpResponseCode)
+            assertEquals(0, response.customResponseCode)
+            assertEquals("${method.name}-failure", response.body)
+        }
+    }
+
+    // Sequential requests reuse the pooled connection.
+    @Test
+    fun manySequentialRequests() {
+        val url = "$baseUrl/okhttp?success=true"
+        for (i in 0 until 100) {
+            val response = transport.sendRequest("post", url, 5000, headers, "{ \"i\" : $i }")
+            assertEquals(200, response.httpResponseCode)
+            assertEquals("POST-success", response.body)
+        }
+    }
+
+    // More concurrent requests than connections per server, so some of them are queued.
+    @Test
+    fun concurrentRequests() {
+        val url = "$baseUrl/okhttp?success=true"
+        val executor = Executors.newFixedThreadPool(16)
+        try {
+            val results = executor.invokeAll((0 until 64).map {
+                Callable { transport.sendRequest("get", url, 5000, headers, "") }
+            }, 30, TimeUnit.SECONDS)
+            for (result in results) {
+                val response = result.get()
+                assertEquals(200, response.httpResponseCode)
+                assertEquals("GET-success", response.body)
+            }
+        } finally {
+            executor.shutdownNow()
+        }
+    }
+
+    @Test
+    fun connectionRefused() {
+        // Nothing listens on port 1.
+        val response = transport.sendRequest("get", "http://127.0.0.1:1/okhttp?success=true", 5000, headers, "")
+        assertEquals(0, response.httpResponseCode)
+        assertEquals(OsJavaNetworkTransport.ERROR_IO, response.customResponseCode)
+    }
+
+    @Test
+    fun unsupportedUrl() {
+        val response = transport.sendRequest("get", "ftp://127.0.0.1/file", 5000, headers, "")
+        assertEquals(0, response.httpResponseCode)
+        assertEquals(OsJavaNetworkTransport.ERROR_UNKNOWN, response.customResponseCode)
+    }
+
+    // Streaming requests are delegated to OkHttp.
+    @Test
+    fun streamRequest() {
+        val request = OsJavaNetworkTransport.Request("get", "$baseUrl/watcher", mapOf(Pair("Accept", "text/event-stream")), "")
+        val response = transport.sendStreamingRequest(request)
+
+        assertEquals(200, response.httpResponseCode)
+        assertEquals("hello world 1", response.readBodyLine())
+        assertEquals("hello world 2", response.readBodyLine())
+
+        response.close()
+    }
+
+    // The synchronous App APIs must see the result of requests sent by the native transport when they return.
+    @Test
+    fun app_loginAndMongoCall() {
+        val app = TestApp(builder = { it.nativeNetworkTransport(true) })
+        try {
+            assertTrue(app.configuration.isNativeNetworkTransportEnabled)
+            val user = app.registerUserAndLogin(TestHelper.getRandomEmail(), "123456")
+            assertNotNull(user.accessToken)
+            val collection = user.getMongoClient(SERVICE_NAME).getDatabase(DATABASE_NAME).getCollection("mongo_data")
+            val result = collection.insertOne(Document("hello", "native")).get()
+            assertNotNull(result!!.insertedId)
+            assertEquals(1L, collection.count(Document("_id", result.insertedId)).get())
+            collection.deleteMany(Document()).get()
+        } finally {
+            app.close()
+        }
+    }
+}
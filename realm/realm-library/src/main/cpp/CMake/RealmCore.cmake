@@ -25,11 +25,17 @@ function(build_existing_realm_core core_source_path)
         add_compile_options(-DNDEBUG)
     endif()
 
+    if (ANDROID)
+        set(core_build_NAME "android-${ANDROID_ABI}")
+    else()
+        set(core_build_NAME "host")
+    endif()
+
     # We mirror relevant flags from this script
     # https://github.com/realm/realm-core/blob/master/tools/cross_compile.sh#L68
     ExternalProject_Add(realm-core
         SOURCE_DIR ${core_source_path}
-        PREFIX ${core_source_path}/build-android-${ANDROID_ABI}-${CMAKE_BUILD_TYPE}
+        PREFIX ${core_source_path}/build-${core_build_NAME}-${CMAKE_BUILD_TYPE}
         CMAKE_ARGS  -DCMAKE_TOOLCHAIN_FILE=${CMAKE_TOOLCHAIN_FILE}
                     -DANDROID_ABI=${ANDROID_ABI}
                     -DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE}
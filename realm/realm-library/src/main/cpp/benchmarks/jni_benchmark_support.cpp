@@ -0,0 +1,50 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jni_benchmark_support.hpp"
+
+#include <object_schema.hpp>
+#include <property.hpp>
+#include <shared_realm.hpp>
+
+#include "util.hpp"
+
+using namespace realm;
+
+jlong realm_jni_benchmark_open_realm(const char* path)
+{
+    Realm::Config config;
+    config.path = path;
+    config.schema_version = 0;
+    config.schema = Schema{
+        ObjectSchema("Item", {
+            {"id", PropertyType::Int, Property::IsPrimary{false}, Property::IsIndexed{true}},
+            {"name", PropertyType::String},
+        }),
+    };
+    return reinterpret_cast<jlong>(new SharedRealm(Realm::get_shared_realm(std::move(config))));
+}
+
+size_t realm_jni_benchmark_read_string(JNIEnv* env, jstring str)
+{
+    JStringAccessor accessor(env, str);
+    return StringData(accessor).size();
+}
+
+jstring realm_jni_benchmark_to_jstring(JNIEnv* env, const char* data, size_t size)
+{
+    return to_jstring(env, StringData(data, size));
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REALM_JNI_BENCHMARK_SUPPORT_HPP
+#define REALM_JNI_BENCHMARK_SUPPORT_HPP
+
+#include <jni.h>
+
+#include <cstddef>
+
+// Entry points compiled into the realm-jni library of benchmark builds. The benchmarks run against the shared library
+// loaded by the JVM, so everything which isn't a JNI function has to be reached through these.
+extern "C" {
+
+// Opens a Realm at the given path with the single class "Item" { long id (indexed); String name; } and returns a
+// SharedRealm pointer as used by OsSharedRealm. Free it with the OsSharedRealm finalizer.
+JNIEXPORT jlong realm_jni_benchmark_open_realm(const char* path);
+
+// Reads the given string with JStringAccessor and returns its size in bytes.
+JNIEXPORT size_t realm_jni_benchmark_read_string(JNIEnv* env, jstring str);
+
+// Converts the given UTF-8 data with to_jstring.
+JNIEXPORT jstring realm_jni_benchmark_to_jstring(JNIEnv* env, const char* data, size_t size);
+}
+
+#endif // REALM_JNI_BENCHMARK_SUPPORT_HPP
@@ -0,0 +1,267 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <jni.h>
+#include <stdlib.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "io_realm_internal_OsResults.h"
+#include "io_realm_internal_OsSharedRealm.h"
+#include "io_realm_internal_Table.h"
+#include "io_realm_internal_TableQuery.h"
+#include "io_realm_internal_UncheckedRow.h"
+#include "io_realm_internal_core_DescriptorOrdering.h"
+#include "io_realm_internal_objectstore_OsObjectBuilder.h"
+
+#include "jni_benchmark_support.hpp"
+
+namespace {
+
+typedef void (*FinalizeFunc)(jlong);
+
+// Shared by all benchmarks. Everything runs on the main thread, which is the thread that created the JVM.
+struct BenchmarkEnv {
+    JavaVM* vm = nullptr;
+    JNIEnv* env = nullptr;
+    jlong shared_realm_ptr = 0;
+    jlong table_ref_ptr = 0;
+    jlong id_col_key = 0;
+    jlong name_col_key = 0;
+    FinalizeFunc finalize_row = nullptr;
+    FinalizeFunc finalize_query = nullptr;
+    FinalizeFunc finalize_results = nullptr;
+    FinalizeFunc finalize_descriptor_ordering = nullptr;
+    FinalizeFunc finalize_table = nullptr;
+    FinalizeFunc finalize_shared_realm = nullptr;
+};
+BenchmarkEnv s_env;
+
+// Number of objects in the Realm which the query and results benchmarks run on.
+constexpr jlong s_object_count = 10000;
+
+bool check_exception(JNIEnv* env, const char* what)
+{
+    if (env->ExceptionCheck()) {
+        fprintf(stderr, "%s failed:\n", what);
+        env->ExceptionDescribe();
+        env->ExceptionClear();
+        return false;
+    }
+    return true;
+}
+
+jstring new_string(JNIEnv* env, size_t length)
+{
+    return env->NewStringUTF(std::string(length, 'x').c_str());
+}
+
+jlong create_object(JNIEnv* env, jlong id, jstring name)
+{
+    jlong builder_ptr = Java_io_realm_internal_objectstore_OsObjectBuilder_nativeCreateBuilder(env, nullptr);
+    Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddInteger(env, nullptr, builder_ptr, s_env.id_col_key,
+                                                                        id);
+    Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddString(env, nullptr, builder_ptr, s_env.name_col_key,
+                                                                       name);
+    jlong row_ptr = Java_io_realm_internal_objectstore_OsObjectBuilder_nativeCreateOrUpdateTopLevelObject(
+        env, nullptr, s_env.shared_realm_ptr, s_env.table_ref_ptr, builder_ptr, JNI_FALSE, JNI_FALSE);
+    Java_io_realm_internal_objectstore_OsObjectBuilder_nativeDestroyBuilder(env, nullptr, builder_ptr);
+    return row_ptr;
+}
+
+bool setup(const char* realm_path)
+{
+    JavaVMOption options[1];
+    std::string class_path = std::string("-Djava.class.path=") + REALM_JNI_BENCHMARK_CLASSPATH;
+    options[0].optionString = const_cast<char*>(class_path.c_str());
+    JavaVMInitArgs vm_args;
+    vm_args.version = JNI_VERSION_1_6;
+    vm_args.nOptions = 1;
+    vm_args.options = options;
+    vm_args.ignoreUnrecognized = JNI_FALSE;
+    if (JNI_CreateJavaVM(&s_env.vm, reinterpret_cast<void**>(&s_env.env), &vm_args) != JNI_OK) {
+        fprintf(stderr, "Failed to create the JVM.\n");
+        return false;
+    }
+    JNIEnv* env = s_env.env;
+
+    // Load the library into the JVM, so JNI_OnLoad runs and the natives of the Realm classes are resolved.
+    jclass system_class = env->FindClass("java/lang/System");
+    jmethodID load_method = env->GetStaticMethodID(system_class, "load", "(Ljava/lang/String;)V");
+    env->CallStaticVoidMethod(system_class, load_method, env->NewStringUTF(REALM_JNI_LIBRARY_PATH));
+    if (!check_exception(env, "Loading " REALM_JNI_LIBRARY_PATH)) {
+        return false;
+    }
+
+    s_env.finalize_row = reinterpret_cast<FinalizeFunc>(
+        Java_io_realm_internal_UncheckedRow_nativeGetFinalizerPtr(env, nullptr));
+    s_env.finalize_query = reinterpret_cast<FinalizeFunc>(
+        Java_io_realm_internal_TableQuery_nativeGetFinalizerPtr(env, nullptr));
+    s_env.finalize_results = reinterpret_cast<FinalizeFunc>(
+        Java_io_realm_internal_OsResults_nativeGetFinalizerPtr(env, nullptr));
+    s_env.finalize_descriptor_ordering = reinterpret_cast<FinalizeFunc>(
+        Java_io_realm_internal_core_DescriptorOrdering_nativeGetFinalizerMethodPtr(env, nullptr));
+    s_env.finalize_table = reinterpret_cast<FinalizeFunc>(
+        Java_io_realm_internal_Table_nativeGetFinalizerPtr(env, nullptr));
+    s_env.finalize_shared_realm = reinterpret_cast<FinalizeFunc>(
+        Java_io_realm_internal_OsSharedRealm_nativeGetFinalizerPtr(env, nullptr));
+
+    s_env.shared_realm_ptr = realm_jni_benchmark_open_realm(realm_path);
+    s_env.table_ref_ptr =
+        Java_io_realm_internal_OsSharedRealm_nativeGetTableRef(env, nullptr, s_env.shared_realm_ptr,
+                                                               env->NewStringUTF("class_Item"));
+    s_env.id_col_key =
+        Java_io_realm_internal_Table_nativeGetColumnKey(env, nullptr, s_env.table_ref_ptr, env->NewStringUTF("id"));
+    s_env.name_col_key =
+        Java_io_realm_internal_Table_nativeGetColumnKey(env, nullptr, s_env.table_ref_ptr, env->NewStringUTF("name"));
+    if (!check_exception(env, "Opening the Realm")) {
+        return false;
+    }
+
+    Java_io_realm_internal_OsSharedRealm_nativeBeginTransaction(env, nullptr, s_env.shared_realm_ptr);
+    jstring name = new_string(env, 16);
+    for (jlong i = 0; i < s_object_count; ++i) {
+        s_env.finalize_row(create_object(env, i, name));
+    }
+    env->DeleteLocalRef(name);
+    Java_io_realm_internal_OsSharedRealm_nativeCommitTransaction(env, nullptr, s_env.shared_realm_ptr);
+    return check_exception(env, "Populating the Realm");
+}
+
+void tear_down()
+{
+    JNIEnv* env = s_env.env;
+    if (s_env.shared_realm_ptr) {
+        s_env.finalize_table(s_env.table_ref_ptr);
+        Java_io_realm_internal_OsSharedRealm_nativeCloseSharedRealm(env, nullptr, s_env.shared_realm_ptr);
+        s_env.finalize_shared_realm(s_env.shared_realm_ptr);
+    }
+    if (s_env.vm) {
+        s_env.vm->DestroyJavaVM();
+    }
+}
+
+void BM_JStringAccessor(benchmark::State& state)
+{
+    JNIEnv* env = s_env.env;
+    jstring str = new_string(env, static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(realm_jni_benchmark_read_string(env, str));
+    }
+    env->DeleteLocalRef(str);
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_JStringAccessor)->Arg(8)->Arg(64)->Arg(1024)->Arg(64 * 1024);
+
+void BM_ToJString(benchmark::State& state)
+{
+    JNIEnv* env = s_env.env;
+    std::string data(static_cast<size_t>(state.range(0)), 'x');
+    for (auto _ : state) {
+        jstring str = realm_jni_benchmark_to_jstring(env, data.data(), data.size());
+        env->DeleteLocalRef(str);
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ToJString)->Arg(8)->Arg(64)->Arg(1024)->Arg(64 * 1024);
+
+void BM_OsObjectBuilderCreate(benchmark::State& state)
+{
+    JNIEnv* env = s_env.env;
+    jstring name = new_string(env, 16);
+    Java_io_realm_internal_OsSharedRealm_nativeBeginTransaction(env, nullptr, s_env.shared_realm_ptr);
+    jlong id = s_object_count;
+    for (auto _ : state) {
+        s_env.finalize_row(create_object(env, id++, name));
+    }
+    Java_io_realm_internal_OsSharedRealm_nativeCancelTransaction(env, nullptr, s_env.shared_realm_ptr);
+    env->DeleteLocalRef(name);
+    check_exception(env, "BM_OsObjectBuilderCreate");
+}
+BENCHMARK(BM_OsObjectBuilderCreate);
+
+void BM_TableQueryConstruction(benchmark::State& state)
+{
+    JNIEnv* env = s_env.env;
+    jlongArray col_keys = env->NewLongArray(1);
+    env->SetLongArrayRegion(col_keys, 0, 1, &s_env.id_col_key);
+    jlongArray table_ptrs = env->NewLongArray(1);
+    for (auto _ : state) {
+        jlong query_ptr = Java_io_realm_internal_Table_nativeWhere(env, nullptr, s_env.table_ref_ptr);
+        Java_io_realm_internal_TableQuery_nativeEqual__J_3J_3JJ(env, nullptr, query_ptr, col_keys, table_ptrs, 42);
+        s_env.finalize_query(query_ptr);
+    }
+    env->DeleteLocalRef(col_keys);
+    env->DeleteLocalRef(table_ptrs);
+    check_exception(env, "BM_TableQueryConstruction");
+}
+BENCHMARK(BM_TableQueryConstruction);
+
+void BM_OsResultsIteration(benchmark::State& state)
+{
+    JNIEnv* env = s_env.env;
+    jlong query_ptr = Java_io_realm_internal_Table_nativeWhere(env, nullptr, s_env.table_ref_ptr);
+    jlong descriptor_ptr = Java_io_realm_internal_core_DescriptorOrdering_nativeCreate(env, nullptr);
+    jlong rows = 0;
+    for (auto _ : state) {
+        jlong results_ptr =
+            Java_io_realm_internal_OsResults_nativeCreateResults(env, nullptr, s_env.shared_realm_ptr, query_ptr,
+                                                                 descriptor_ptr);
+        jlong size = Java_io_realm_internal_OsResults_nativeSize(env, nullptr, results_ptr);
+        for (jlong i = 0; i < size; ++i) {
+            s_env.finalize_row(Java_io_realm_internal_OsResults_nativeGetRow(env, nullptr, results_ptr,
+                                                                             static_cast<jint>(i)));
+        }
+        s_env.finalize_results(results_ptr);
+        rows += size;
+    }
+    s_env.finalize_descriptor_ordering(descriptor_ptr);
+    s_env.finalize_query(query_ptr);
+    state.SetItemsProcessed(rows);
+    check_exception(env, "BM_OsResultsIteration");
+}
+BENCHMARK(BM_OsResultsIteration);
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+
+    char dir_template[] = "/tmp/realm-jni-benchmarks-XXXXXX";
+    const char* dir = mkdtemp(dir_template);
+    if (!dir) {
+        perror("mkdtemp");
+        return 1;
+    }
+    std::string realm_path = std::string(dir) + "/benchmark.realm";
+
+    int ret = 1;
+    if (setup(realm_path.c_str())) {
+        benchmark::RunSpecifiedBenchmarks();
+        ret = 0;
+    }
+    tear_down();
+
+    // The Realm leaves its lock and management files next to it.
+    std::error_code ec;
+    std::filesystem::remove_all(dir, ec);
+    return ret;
+}
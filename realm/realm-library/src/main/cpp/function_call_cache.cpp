@@ -0,0 +1,186 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "function_call_cache.hpp"
+
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+using namespace realm;
+using namespace realm::app;
+using namespace realm::bson;
+
+struct FunctionCallCache::State {
+    using Clock = std::chrono::steady_clock;
+
+    struct Result {
+        Bson value;
+        Clock::time_point expires;
+    };
+
+    explicit State(std::chrono::milliseconds ttl)
+        : ttl(ttl)
+    {
+    }
+
+    // Makes room for a new result, dropping the expired ones and then the one expiring first. Requires the lock.
+    void evict(Clock::time_point now)
+    {
+        for (auto it = results.begin(); it != results.end();) {
+            it = (it->second.expires <= now) ? results.erase(it) : std::next(it);
+        }
+        if (results.size() >= max_results) {
+            auto oldest = results.begin();
+            for (auto it = results.begin(); it != results.end(); ++it) {
+                if (it->second.expires < oldest->second.expires) {
+                    oldest = it;
+                }
+            }
+            results.erase(oldest);
+        }
+    }
+
+    const std::chrono::milliseconds ttl;
+    std::mutex mutex;
+    std::map<std::string, std::vector<Handler>> in_flight;
+    std::map<std::string, Result> results;
+    std::string current_user;
+    // Incremented when the results are dropped, so calls sent before do not store their result.
+    uint64_t generation = 0;
+};
+
+// Describes the exception being handled as an error which can be passed to handlers.
+static AppError current_exception_to_app_error()
+{
+    try {
+        throw;
+    }
+    catch (const AppError& e) {
+        return e;
+    }
+    catch (const std::exception& e) {
+        return AppError(make_custom_error_code(-1), e.what());
+    }
+    catch (...) {
+        return AppError(make_custom_error_code(-1), "Unknown error while sending the function call.");
+    }
+}
+
+FunctionCallCache::FunctionCallCache(std::chrono::milliseconds ttl)
+    : m_state(std::make_shared<State>(ttl))
+{
+}
+
+std::string FunctionCallCache::make_key(const std::string& user_identity, const std::string& refresh_token,
+                                        const std::string& name, const std::string& encoded_args)
+{
+    // Length prefixed, so different parts can never produce the same key.
+    std::string key;
+    key.reserve(user_identity.size() + refresh_token.size() + name.size() + encoded_args.size() + 32);
+    for (const std::string* part : {&user_identity, &refresh_token, &name, &encoded_args}) {
+        key.append(std::to_string(part->size())).append(1, ':').append(*part);
+    }
+    return key;
+}
+
+void FunctionCallCache::call(const std::string& key, const Send& send, Handler handler)
+{
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    if (m_state->ttl.count() > 0) {
+        auto cached = m_state->results.find(key);
+        if (cached != m_state->results.end()) {
+            if (cached->second.expires > State::Clock::now()) {
+                Bson result = cached->second.value;
+                lock.unlock();
+                handler(util::none, std::move(result));
+                return;
+            }
+            m_state->results.erase(cached);
+        }
+    }
+
+    auto pending = m_state->in_flight.find(key);
+    if (pending != m_state->in_flight.end()) {
+        pending->second.push_back(std::move(handler));
+        return;
+    }
+    m_state->in_flight[key].push_back(std::move(handler));
+    uint64_t generation = m_state->generation;
+    lock.unlock();
+
+    std::shared_ptr<State> state = m_state;
+    auto completion = [state, key, generation](util::Optional<AppError> error, util::Optional<Bson> response) {
+        std::vector<Handler> handlers;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            auto pending = state->in_flight.find(key);
+            if (pending != state->in_flight.end()) {
+                handlers = std::move(pending->second);
+                state->in_flight.erase(pending);
+            }
+            if (!error && response && state->ttl.count() > 0 && generation == state->generation) {
+                auto now = State::Clock::now();
+                state->evict(now);
+                state->results[key] = State::Result{*response, now + state->ttl};
+            }
+        }
+        for (auto& handler : handlers) {
+            handler(error, response);
+        }
+    };
+    try {
+        send(std::move(completion));
+    }
+    catch (...) {
+        // Nothing will complete the call, so later calls must send their own request and the calls which joined this
+        // one are completed with the error. The first handler is the one of this call, which gets the exception.
+        std::vector<Handler> handlers;
+        {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            auto pending = m_state->in_flight.find(key);
+            if (pending != m_state->in_flight.end()) {
+                handlers = std::move(pending->second);
+                m_state->in_flight.erase(pending);
+            }
+        }
+        if (handlers.size() > 1) {
+            AppError error = current_exception_to_app_error();
+            for (size_t i = 1; i < handlers.size(); ++i) {
+                handlers[i](error, util::none);
+            }
+        }
+        throw;
+    }
+}
+
+void FunctionCallCache::set_current_user(const std::string& user_identity)
+{
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    if (m_state->current_user != user_identity) {
+        m_state->current_user = user_identity;
+        m_state->results.clear();
+        ++m_state->generation;
+    }
+}
+
+void FunctionCallCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->results.clear();
+    ++m_state->generation;
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REALM_FUNCTION_CALL_CACHE_HPP
+#define REALM_FUNCTION_CALL_CACHE_HPP
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "sync/app.hpp"
+
+namespace realm {
+
+// Coalesces calls of MongoDB Realm functions and optionally caches their results.
+//
+// A call is identified by a key made of the user, the function name and the encoded arguments, see make_key(). A
+// call with the key of a call which is still in flight does not send a request, it completes with the result of the
+// pending call. If the time to live is positive, successful results are also kept for that long and later calls
+// with the same key complete immediately with them. Errors are never cached.
+//
+// Cached results are dropped when the current user of the app changes, see set_current_user(). As the refresh token
+// is part of the key, results are never shared across logins of the same user either.
+class FunctionCallCache {
+public:
+    using Handler = std::function<void(util::Optional<app::AppError>, util::Optional<bson::Bson>)>;
+    // Sends the request of a call, the handler must be called exactly once.
+    using Send = std::function<void(Handler)>;
+
+    static constexpr size_t max_results = 256;
+
+    explicit FunctionCallCache(std::chrono::milliseconds ttl);
+
+    FunctionCallCache(const FunctionCallCache&) = delete;
+    FunctionCallCache& operator=(const FunctionCallCache&) = delete;
+
+    static std::string make_key(const std::string& user_identity, const std::string& refresh_token,
+                                const std::string& name, const std::string& encoded_args);
+
+    // Completes the handler with a cached result or with the result of the pending call with the same key, otherwise
+    // sends the call. Cached results are delivered on the calling thread, all others on the thread completing the
+    // request. Thread safe.
+    void call(const std::string& key, const Send& send, Handler handler);
+
+    // Drops the cached results if the user differs from the one given last time. Thread safe.
+    void set_current_user(const std::string& user_identity);
+
+    // Drops the cached results. Calls in flight still complete, but their results are not cached. Thread safe.
+    void clear();
+
+private:
+    struct State;
+    // Shared with the completion handlers of the requests in flight, which can outlive the cache.
+    std::shared_ptr<State> m_state;
+};
+
+} // namespace realm
+
+#endif // REALM_FUNCTION_CALL_CACHE_HPP
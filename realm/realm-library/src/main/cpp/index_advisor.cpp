@@ -0,0 +1,147 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "index_advisor.hpp"
+
+#include <algorithm>
+
+#include <realm/table.hpp>
+
+#include <object_store.hpp>
+
+using namespace realm;
+
+namespace {
+
+// The last equality predicate reported on this thread, to recognize the `or` separated equality predicates of
+// RealmQuery.in(). Queries are built on a single thread, so this needs no synchronization.
+struct EqualChain {
+    const Query* query = nullptr;
+    ColKey col_key;
+    bool after_or = false;
+    bool is_in = false;
+};
+
+thread_local EqualChain t_equal_chain;
+
+// Must match the types accepted by Table.addSearchIndex().
+bool is_indexable(DataType type)
+{
+    return type == type_String || type == type_Int || type == type_Bool || type == type_Timestamp ||
+           type == type_OldDateTime || type == type_ObjectId;
+}
+
+} // anonymous namespace
+
+IndexAdvisor& IndexAdvisor::shared()
+{
+    static IndexAdvisor advisor;
+    return advisor;
+}
+
+void IndexAdvisor::on_predicate(const Query& query, ColKey col_key, Predicate predicate)
+{
+    if (!is_enabled()) {
+        return;
+    }
+
+    EqualChain& chain = t_equal_chain;
+    bool continues_in = predicate == Predicate::equal && chain.query == &query && chain.col_key == col_key &&
+                        chain.after_or;
+    chain.after_or = false;
+    if (!continues_in) {
+        chain.query = nullptr;
+    }
+
+    ConstTableRef table = query.get_table();
+    if (!table || !is_indexable(table->get_column_type(col_key)) || table->has_search_index(col_key) ||
+        table->get_primary_key_column() == col_key) {
+        return;
+    }
+
+    Key key(ObjectStore::object_type_for_table_name(table->get_name()), table->get_column_name(col_key));
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ColumnStats& stats = m_stats[key];
+    if (stats.class_name.empty()) {
+        stats.class_name = key.first;
+        stats.column_name = key.second;
+    }
+
+    if (continues_in) {
+        // The first equality predicate of the chain was counted as such, the values it adds do not cause another
+        // scan of the table.
+        if (!chain.is_in && stats.equal_predicates > 0) {
+            --stats.equal_predicates;
+            ++stats.in_predicates;
+        }
+        chain.is_in = true;
+        return;
+    }
+
+    uint64_t rows = table->size();
+    if (predicate == Predicate::equal) {
+        ++stats.equal_predicates;
+        stats.rows_scanned += rows;
+        chain.query = &query;
+        chain.col_key = col_key;
+        chain.is_in = false;
+    }
+    else {
+        ++stats.range_predicates;
+        stats.range_rows_scanned += rows;
+    }
+}
+
+void IndexAdvisor::on_or(const Query& query)
+{
+    if (!is_enabled()) {
+        return;
+    }
+    EqualChain& chain = t_equal_chain;
+    if (chain.query == &query) {
+        chain.after_or = true;
+    }
+}
+
+std::vector<IndexAdvisor::ColumnStats> IndexAdvisor::recommendations() const
+{
+    std::vector<ColumnStats> result;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        result.reserve(m_stats.size());
+        for (const auto& entry : m_stats) {
+            result.push_back(entry.second);
+        }
+    }
+    std::stable_sort(result.begin(), result.end(), [](const ColumnStats& a, const ColumnStats& b) {
+        if (a.rows_scanned != b.rows_scanned) {
+            return a.rows_scanned > b.rows_scanned;
+        }
+        uint64_t a_predicates = a.equal_predicates + a.in_predicates;
+        uint64_t b_predicates = b.equal_predicates + b.in_predicates;
+        if (a_predicates != b_predicates) {
+            return a_predicates > b_predicates;
+        }
+        return a.range_rows_scanned > b.range_rows_scanned;
+    });
+    return result;
+}
+
+void IndexAdvisor::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.clear();
+}
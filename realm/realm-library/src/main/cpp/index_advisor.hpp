@@ -0,0 +1,90 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REALM_INDEX_ADVISOR_HPP
+#define REALM_INDEX_ADVISOR_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <realm/query.hpp>
+
+namespace realm {
+
+// Records how often query predicates hit columns without a search index, to tell which columns are worth indexing.
+//
+// The predicate builders of TableQuery report every predicate on a column of the queried table. Predicates on
+// columns which are indexed, part of the primary key or of a type which cannot be indexed are ignored, as are
+// predicates through links. Equality predicates separated by `or` on the same column, which is how
+// RealmQuery.in() is built, are counted as a single IN predicate.
+//
+// An unindexed predicate has to visit every object of the table, so the number of objects in the table when the
+// predicate is added is counted as the rows scanned by it.
+//
+// Recording is disabled by default, reporting a predicate is then a single atomic load.
+class IndexAdvisor {
+public:
+    enum class Predicate { equal, range };
+
+    struct ColumnStats {
+        std::string class_name;
+        std::string column_name;
+        uint64_t equal_predicates = 0;
+        uint64_t in_predicates = 0;
+        uint64_t range_predicates = 0;
+        // Scanned by equality and IN predicates, which a search index replaces with a lookup.
+        uint64_t rows_scanned = 0;
+        // Scanned by range predicates, which are not sped up by a search index.
+        uint64_t range_rows_scanned = 0;
+    };
+
+    static IndexAdvisor& shared();
+
+    void set_enabled(bool enabled)
+    {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool is_enabled() const
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    // Called after a predicate on the given column of the queried table has been added to the query.
+    void on_predicate(const Query& query, ColKey col_key, Predicate predicate);
+    // Called after `or` has been added to the query.
+    void on_or(const Query& query);
+
+    // Columns with recorded predicates, the columns which would gain the most from an index first.
+    std::vector<ColumnStats> recommendations() const;
+    void reset();
+
+private:
+    using Key = std::pair<std::string, std::string>;
+
+    std::atomic<bool> m_enabled{false};
+    mutable std::mutex m_mutex;
+    std::map<Key, ColumnStats> m_stats;
+};
+
+} // namespace realm
+
+#endif // REALM_INDEX_ADVISOR_HPP
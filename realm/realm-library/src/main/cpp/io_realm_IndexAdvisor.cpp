@@ -0,0 +1,72 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io_realm_IndexAdvisor.h"
+
+#include "index_advisor.hpp"
+#include "util.hpp"
+#include "jni_util/java_class.hpp"
+#include "jni_util/java_local_frame.hpp"
+#include "jni_util/java_method.hpp"
+
+using namespace realm;
+using namespace realm::jni_util;
+
+JNIEXPORT void JNICALL Java_io_realm_IndexAdvisor_nativeSetEnabled(JNIEnv*, jclass, jboolean j_enabled)
+{
+    JNI_PROBE();
+    IndexAdvisor::shared().set_enabled(to_bool(j_enabled));
+}
+
+JNIEXPORT jboolean JNICALL Java_io_realm_IndexAdvisor_nativeIsEnabled(JNIEnv*, jclass)
+{
+    JNI_PROBE();
+    return to_jbool(IndexAdvisor::shared().is_enabled());
+}
+
+JNIEXPORT jobjectArray JNICALL Java_io_realm_IndexAdvisor_nativeGetRecommendations(JNIEnv* env, jclass)
+{
+    JNI_PROBE();
+    try {
+        static JavaClass recommendation_class(env, "io/realm/IndexAdvisor$Recommendation");
+        static JavaMethod recommendation_constructor(env, recommendation_class, "<init>",
+                                                     "(Ljava/lang/String;Ljava/lang/String;JJJJJ)V");
+
+        std::vector<IndexAdvisor::ColumnStats> recommendations = IndexAdvisor::shared().recommendations();
+        jobjectArray j_recommendations =
+            env->NewObjectArray(static_cast<jsize>(recommendations.size()), recommendation_class, nullptr);
+        JavaLocalFrame frame(env);
+        jsize i = 0;
+        for (const auto& stats : recommendations) {
+            jobject j_recommendation = env->NewObject(
+                recommendation_class, recommendation_constructor, to_jstring(env, stats.class_name),
+                to_jstring(env, stats.column_name), static_cast<jlong>(stats.equal_predicates),
+                static_cast<jlong>(stats.in_predicates), static_cast<jlong>(stats.range_predicates),
+                static_cast<jlong>(stats.rows_scanned), static_cast<jlong>(stats.range_rows_scanned));
+            env->SetObjectArrayElement(j_recommendations, i++, j_recommendation);
+            frame.step(3);
+        }
+        return j_recommendations;
+    }
+    CATCH_STD()
+    return nullptr;
+}
+
+JNIEXPORT void JNICALL Java_io_realm_IndexAdvisor_nativeReset(JNIEnv*, jclass)
+{
+    JNI_PROBE();
+    IndexAdvisor::shared().reset();
+}
@@ -26,6 +26,7 @@ using namespace realm;
 
 JNIEXPORT jstring JNICALL Java_io_realm_RealmQuery_nativeSerializeQuery(JNIEnv* env, jclass, jlong table_query_ptr, jlong descriptor_ptr)
 {
+    JNI_PROBE();
     try {
         auto query = reinterpret_cast<Query*>(table_query_ptr);
         auto descriptor = reinterpret_cast<DescriptorOrdering*>(descriptor_ptr);
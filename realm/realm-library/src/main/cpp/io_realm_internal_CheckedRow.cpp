@@ -24,6 +24,7 @@ using namespace realm;
 JNIEXPORT jlong JNICALL Java_io_realm_internal_CheckedRow_nativeGetColumnCount(JNIEnv* env, jobject obj,
                                                                                jlong nativeRowPtr)
 {
+    JNI_PROBE();
     if (!OBJ(nativeRowPtr)->is_valid()) {
         return 0;
     }
@@ -34,6 +35,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_CheckedRow_nativeGetColumnCount(J
 JNIEXPORT jlong JNICALL Java_io_realm_internal_CheckedRow_nativeGetColumnKey(JNIEnv* env, jobject obj,
                                                                                jlong nativeRowPtr, jstring columnName)
 {
+    JNI_PROBE();
     if (!OBJ(nativeRowPtr)->is_valid()) {
         ThrowException(env, IllegalArgument, "Object passed is not valid");
     }
@@ -49,12 +51,14 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_CheckedRow_nativeGetColumnKey(JNI
 JNIEXPORT jint JNICALL Java_io_realm_internal_CheckedRow_nativeGetColumnType(JNIEnv* env, jobject obj,
                                                                              jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     return Java_io_realm_internal_UncheckedRow_nativeGetColumnType(env, obj, nativeRowPtr, columnKey);
 }
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_CheckedRow_nativeGetLong(JNIEnv* env, jobject obj, jlong nativeRowPtr,
                                                                         jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Int)) {
         return 0;
     }
@@ -65,6 +69,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_CheckedRow_nativeGetLong(JNIEnv*
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_CheckedRow_nativeGetBoolean(JNIEnv* env, jobject obj,
                                                                               jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Bool)) {
         return JNI_FALSE;
     }
@@ -75,6 +80,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_CheckedRow_nativeGetBoolean(JN
 JNIEXPORT jfloat JNICALL Java_io_realm_internal_CheckedRow_nativeGetFloat(JNIEnv* env, jobject obj,
                                                                           jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Float)) {
         return 0;
     }
@@ -85,6 +91,7 @@ JNIEXPORT jfloat JNICALL Java_io_realm_internal_CheckedRow_nativeGetFloat(JNIEnv
 JNIEXPORT jdouble JNICALL Java_io_realm_internal_CheckedRow_nativeGetDouble(JNIEnv* env, jobject obj,
                                                                             jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Double)) {
         return 0;
     }
@@ -95,6 +102,7 @@ JNIEXPORT jdouble JNICALL Java_io_realm_internal_CheckedRow_nativeGetDouble(JNIE
 JNIEXPORT jlong JNICALL Java_io_realm_internal_CheckedRow_nativeGetTimestamp(JNIEnv* env, jobject obj,
                                                                              jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Timestamp)) {
         return 0;
     }
@@ -105,6 +113,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_CheckedRow_nativeGetTimestamp(JNI
 JNIEXPORT jstring JNICALL Java_io_realm_internal_CheckedRow_nativeGetString(JNIEnv* env, jobject obj,
                                                                             jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_String)) {
         return nullptr;
     }
@@ -116,6 +125,7 @@ JNIEXPORT jbyteArray JNICALL Java_io_realm_internal_CheckedRow_nativeGetByteArra
                                                                                   jlong nativeRowPtr,
                                                                                   jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Binary)) {
         return nullptr;
     }
@@ -126,6 +136,7 @@ JNIEXPORT jbyteArray JNICALL Java_io_realm_internal_CheckedRow_nativeGetByteArra
 JNIEXPORT jlong JNICALL Java_io_realm_internal_CheckedRow_nativeGetLink(JNIEnv* env, jobject obj, jlong nativeRowPtr,
                                                                         jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Link)) {
         return 0;
     }
@@ -136,6 +147,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_CheckedRow_nativeGetLink(JNIEnv*
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_CheckedRow_nativeIsNullLink(JNIEnv* env, jobject obj,
                                                                               jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Link)) {
         return JNI_FALSE;
     }
@@ -146,6 +158,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_CheckedRow_nativeIsNullLink(JN
 JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetLong(JNIEnv* env, jobject obj, jlong nativeRowPtr,
                                                                        jlong columnKey, jlong value)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Int)) {
         return;
     }
@@ -157,6 +170,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetBoolean(JNIEnv
                                                                           jlong nativeRowPtr, jlong columnKey,
                                                                           jboolean value)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Bool)) {
         return;
     }
@@ -167,6 +181,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetBoolean(JNIEnv
 JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetFloat(JNIEnv* env, jobject obj, jlong nativeRowPtr,
                                                                         jlong columnKey, jfloat value)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Float)) {
         return;
     }
@@ -177,6 +192,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetFloat(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetDouble(JNIEnv* env, jobject obj, jlong nativeRowPtr,
                                                                          jlong columnKey, jdouble value)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Double)) {
         return;
     }
@@ -188,6 +204,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetTimestamp(JNIE
                                                                             jlong nativeRowPtr, jlong columnKey,
                                                                             jlong value)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Timestamp)) {
         return;
     }
@@ -198,6 +215,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetTimestamp(JNIE
 JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetString(JNIEnv* env, jobject obj, jlong nativeRowPtr,
                                                                          jlong columnKey, jstring value)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_String)) {
         return;
     }
@@ -209,6 +227,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetByteArray(JNIE
                                                                             jlong nativeRowPtr, jlong columnKey,
                                                                             jbyteArray value)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Binary)) {
         return;
     }
@@ -219,6 +238,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetByteArray(JNIE
 JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetLink(JNIEnv* env, jobject obj, jlong nativeRowPtr,
                                                                        jlong columnKey, jlong value)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Link)) {
         return;
     }
@@ -229,6 +249,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetLink(JNIEnv* e
 JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeNullifyLink(JNIEnv* env, jobject obj,
                                                                            jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Link)) {
         return;
     }
@@ -239,6 +260,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeNullifyLink(JNIEn
 
 JNIEXPORT jlongArray JNICALL Java_io_realm_internal_CheckedRow_nativeGetDecimal128(JNIEnv* env, jobject obj, jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Decimal)) {
         return nullptr;
     }
@@ -248,6 +270,7 @@ JNIEXPORT jlongArray JNICALL Java_io_realm_internal_CheckedRow_nativeGetDecimal1
 
 JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetDecimal128(JNIEnv* env, jobject obj, jlong nativeRowPtr, jlong columnKey, jlong low, jlong high)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_Decimal)) {
         return;
     }
@@ -259,6 +282,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_CheckedRow_nativeGetObjectId(JN
                                                                                     jlong nativeRowPtr,
                                                                                     jlong columnKey)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_ObjectId)) {
         return nullptr;
     }
@@ -270,6 +294,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_CheckedRow_nativeSetObjectId(JNIEn
                                                                               jlong nativeRowPtr, jlong columnKey,
                                                                               jstring j_value)
 {
+    JNI_PROBE();
     if (!TYPE_VALID(env, OBJ(nativeRowPtr)->get_table(), columnKey, type_ObjectId)) {
         return;
     }
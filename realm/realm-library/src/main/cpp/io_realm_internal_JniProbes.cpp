@@ -0,0 +1,69 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io_realm_internal_JniProbes.h"
+
+#include "util.hpp"
+#include "jni_util/jni_probe.hpp"
+
+using namespace realm;
+using namespace realm::jni_util;
+
+// These functions are not probed themselves, so reading the statistics doesn't add to them.
+
+JNIEXPORT jboolean JNICALL Java_io_realm_internal_JniProbes_nativeIsAvailable(JNIEnv*, jclass)
+{
+#if REALM_JNI_PROBES
+    return JNI_TRUE;
+#else
+    return JNI_FALSE;
+#endif
+}
+
+JNIEXPORT void JNICALL Java_io_realm_internal_JniProbes_nativeSetEnabled(JNIEnv*, jclass, jboolean enabled)
+{
+    JniProbe::set_enabled(enabled == JNI_TRUE);
+}
+
+JNIEXPORT jboolean JNICALL Java_io_realm_internal_JniProbes_nativeIsEnabled(JNIEnv*, jclass)
+{
+    return to_jbool(JniProbe::enabled());
+}
+
+JNIEXPORT void JNICALL Java_io_realm_internal_JniProbes_nativeReset(JNIEnv*, jclass)
+{
+    JniProbe::reset();
+}
+
+JNIEXPORT jstring JNICALL Java_io_realm_internal_JniProbes_nativeDump(JNIEnv* env, jclass)
+{
+    try {
+        return to_jstring(env, JniProbe::dump());
+    }
+    CATCH_STD()
+    return nullptr;
+}
+
+JNIEXPORT void JNICALL Java_io_realm_internal_JniProbes_nativeDumpToFile(JNIEnv* env, jclass, jstring j_path)
+{
+    try {
+        JStringAccessor path(env, j_path); // throws
+        if (!JniProbe::dump_to_file(path)) {
+            ThrowException(env, IllegalArgument, "Cannot write the JNI probes to: " + std::string(path));
+        }
+    }
+    CATCH_STD()
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io_realm_internal_NativeObjectCounters.h"
+
+#include "jni_util/jni_probe.hpp"
+#include "jni_util/jni_utils.hpp"
+#include "jni_util/native_object_counter.hpp"
+
+using namespace realm::jni_util;
+
+static_assert(io_realm_internal_NativeObjectCounters_KIND_OBJ == NativeObjectCounter::obj, "");
+static_assert(io_realm_internal_NativeObjectCounters_KIND_QUERY == NativeObjectCounter::query, "");
+static_assert(io_realm_internal_NativeObjectCounters_KIND_RESULTS == NativeObjectCounter::results, "");
+static_assert(io_realm_internal_NativeObjectCounters_KIND_LIST == NativeObjectCounter::list, "");
+static_assert(io_realm_internal_NativeObjectCounters_KIND_OBJECT == NativeObjectCounter::object, "");
+static_assert(io_realm_internal_NativeObjectCounters_KIND_COLLECTION_CHANGE_SET ==
+                  NativeObjectCounter::collection_change, "");
+static_assert(io_realm_internal_NativeObjectCounters_KIND_OBJECT_BUILDER == NativeObjectCounter::object_builder, "");
+static_assert(io_realm_internal_NativeObjectCounters_KIND_GLOBAL_REF == NativeObjectCounter::global_ref, "");
+static_assert(io_realm_internal_NativeObjectCounters_KIND_WEAK_GLOBAL_REF == NativeObjectCounter::weak_global_ref,
+              "");
+static_assert(io_realm_internal_NativeObjectCounters_KIND_KEPT_GLOBAL_REF == NativeObjectCounter::kept_global_ref,
+              "");
+
+// The kind is validated on the Java side.
+JNIEXPORT jlong JNICALL Java_io_realm_internal_NativeObjectCounters_nativeGetCount(JNIEnv*, jclass, jint kind)
+{
+    JNI_PROBE();
+    return static_cast<jlong>(NativeObjectCounter::count(static_cast<NativeObjectCounter::Kind>(kind)));
+}
+
+JNIEXPORT jlong JNICALL Java_io_realm_internal_NativeObjectCounters_nativeGetHighWaterMark(JNIEnv*, jclass,
+                                                                                           jint kind)
+{
+    JNI_PROBE();
+    return static_cast<jlong>(NativeObjectCounter::high_water_mark(static_cast<NativeObjectCounter::Kind>(kind)));
+}
+
+JNIEXPORT void JNICALL Java_io_realm_internal_NativeObjectCounters_nativeResetHighWaterMarks(JNIEnv*, jclass)
+{
+    JNI_PROBE();
+    NativeObjectCounter::reset_high_water_marks();
+}
+
+JNIEXPORT jlong JNICALL Java_io_realm_internal_NativeObjectCounters_nativeGetAttachedThreadCount(JNIEnv*, jclass)
+{
+    JNI_PROBE();
+    return static_cast<jlong>(JniUtils::attach_count() - JniUtils::detach_count());
+}
@@ -19,6 +19,7 @@
 #include <collection_notifications.hpp>
 
 #include "util.hpp"
+#include "jni_util/native_object_counter.hpp"
 
 using namespace realm;
 
@@ -29,6 +30,7 @@ static jintArray index_set_to_indices_array(JNIEnv* env, const IndexSet& index_s
 static void finalize_changeset(jlong ptr)
 {
     delete reinterpret_cast<CollectionChangeSet*>(ptr);
+    jni_util::NativeObjectCounter::destroyed(jni_util::NativeObjectCounter::collection_change);
 }
 
 static jintArray index_set_to_jint_array(JNIEnv* env, const IndexSet& index_set)
@@ -81,12 +83,14 @@ static jintArray index_set_to_indices_array(JNIEnv* env, const IndexSet& index_s
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsCollectionChangeSet_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_changeset);
 }
 
 JNIEXPORT jintArray JNICALL Java_io_realm_internal_OsCollectionChangeSet_nativeGetRanges(JNIEnv* env, jclass,
                                                                                          jlong native_ptr, jint type)
 {
+    JNI_PROBE();
     // no throws
     auto& change_set = *reinterpret_cast<CollectionChangeSet*>(native_ptr);
     switch (type) {
@@ -104,6 +108,7 @@ JNIEXPORT jintArray JNICALL Java_io_realm_internal_OsCollectionChangeSet_nativeG
 JNIEXPORT jintArray JNICALL Java_io_realm_internal_OsCollectionChangeSet_nativeGetIndices(JNIEnv* env, jclass,
                                                                                           jlong native_ptr, jint type)
 {
+    JNI_PROBE();
     // no throws
     auto& change_set = *reinterpret_cast<CollectionChangeSet*>(native_ptr);
     switch (type) {
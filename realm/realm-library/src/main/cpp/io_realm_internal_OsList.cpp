@@ -25,11 +25,13 @@
 #include "java_object_accessor.hpp"
 #include "java_exception_def.hpp"
 #include "jni_util/java_exception_thrower.hpp"
+#include "jni_util/native_object_counter.hpp"
 #include "util.hpp"
 
 using namespace realm;
 using namespace realm::util;
 using namespace realm::_impl;
+using namespace realm::jni_util;
 
 typedef ObservableCollectionWrapper<List> ListWrapper;
 
@@ -76,12 +78,14 @@ inline void check_nullable(JNIEnv* env, jlong list_ptr, jobject jobject_ptr = nu
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_list);
 }
 
 JNIEXPORT jlongArray JNICALL Java_io_realm_internal_OsList_nativeCreate(JNIEnv* env, jclass, jlong shared_realm_ptr,
                                                                         jlong obj_ptr, jlong column_key)
 {
+    JNI_PROBE();
     try {
         auto& obj = *reinterpret_cast<realm::Obj*>(obj_ptr);
 
@@ -117,10 +121,11 @@ JNIEXPORT jlongArray JNICALL Java_io_realm_internal_OsList_nativeCreate(JNIEnv*
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeGetRow(JNIEnv* env, jclass, jlong list_ptr,
                                                                    jlong column_index)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         auto obj = wrapper.collection().get(column_index);
-        return reinterpret_cast<jlong>(new Obj(std::move(obj)));
+        return reinterpret_cast<jlong>(NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(std::move(obj))));
     }
     CATCH_STD()
     return reinterpret_cast<jlong>(nullptr);
@@ -129,6 +134,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeGetRow(JNIEnv* env,
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddRow(JNIEnv* env, jclass, jlong list_ptr,
                                                                   jlong target_obj_key)
 {
+    JNI_PROBE();
 
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
@@ -140,6 +146,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddRow(JNIEnv* env, j
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertRow(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                      jlong target_obj_key)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         wrapper.collection().insert(static_cast<size_t>(pos), ObjKey(target_obj_key));
@@ -150,6 +157,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertRow(JNIEnv* env
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetRow(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                   jlong target_obj_key)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         wrapper.collection().set(static_cast<size_t>(pos), ObjKey(target_obj_key));
@@ -160,6 +168,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetRow(JNIEnv* env, j
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeMove(JNIEnv* env, jclass, jlong list_ptr,
                                                                 jlong source_index, jlong target_index)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         wrapper.collection().move(source_index, target_index);
@@ -169,6 +178,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeMove(JNIEnv* env, jcl
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeRemove(JNIEnv* env, jclass, jlong list_ptr, jlong index)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         wrapper.collection().remove(index);
@@ -178,6 +188,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeRemove(JNIEnv* env, j
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeRemoveAll(JNIEnv* env, jclass, jlong list_ptr)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         wrapper.collection().remove_all();
@@ -187,6 +198,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeRemoveAll(JNIEnv* env
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeSize(JNIEnv* env, jclass, jlong list_ptr)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         return wrapper.collection().size();
@@ -197,10 +209,12 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeSize(JNIEnv* env, jc
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeGetQuery(JNIEnv* env, jclass, jlong list_ptr)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         auto query = wrapper.collection().get_query();
-        return reinterpret_cast<jlong>(new Query(std::move(query)));
+        return reinterpret_cast<jlong>(
+            NativeObjectCounter::created(NativeObjectCounter::query, new Query(std::move(query))));
     }
     CATCH_STD()
     return reinterpret_cast<jlong>(nullptr);
@@ -208,6 +222,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeGetQuery(JNIEnv* env
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsList_nativeIsValid(JNIEnv* env, jclass, jlong list_ptr)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         return wrapper.collection().is_valid();
@@ -218,6 +233,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsList_nativeIsValid(JNIEnv* e
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeDelete(JNIEnv* env, jclass, jlong list_ptr, jlong index)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         wrapper.collection().delete_at(S(index));
@@ -227,6 +243,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeDelete(JNIEnv* env, j
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeDeleteAll(JNIEnv* env, jclass, jlong list_ptr)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         wrapper.collection().delete_all();
@@ -237,6 +254,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeDeleteAll(JNIEnv* env
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeStartListening(JNIEnv* env, jobject instance,
                                                                               jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ListWrapper*>(native_ptr);
         wrapper->start_listening(env, instance);
@@ -246,6 +264,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeStartListening(JNIEnv
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeStopListening(JNIEnv* env, jobject, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ListWrapper*>(native_ptr);
         wrapper->stop_listening();
@@ -255,6 +274,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeStopListening(JNIEnv*
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddNull(JNIEnv* env, jclass, jlong list_ptr)
 {
+    JNI_PROBE();
     try {
         check_nullable(env, list_ptr);
         add_value(env, list_ptr, Any());
@@ -264,6 +284,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddNull(JNIEnv* env,
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertNull(JNIEnv* env, jclass, jlong list_ptr, jlong pos)
 {
+    JNI_PROBE();
     try {
         check_nullable(env, list_ptr);
         insert_value(env, list_ptr, pos, Any());
@@ -273,6 +294,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertNull(JNIEnv* en
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetNull(JNIEnv* env, jclass, jlong list_ptr, jlong pos)
 {
+    JNI_PROBE();
     try {
         check_nullable(env, list_ptr);
         set_value(env, list_ptr, pos, Any());
@@ -282,6 +304,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetNull(JNIEnv* env,
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddLong(JNIEnv* env, jclass, jlong list_ptr, jlong value)
 {
+    JNI_PROBE();
     try {
         add_value(env, list_ptr, Any(value));
     }
@@ -291,6 +314,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddLong(JNIEnv* env,
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertLong(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                       jlong value)
 {
+    JNI_PROBE();
     try {
         insert_value(env, list_ptr, pos, Any(value));
     }
@@ -300,6 +324,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertLong(JNIEnv* en
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetLong(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                    jlong value)
 {
+    JNI_PROBE();
     try {
         set_value(env, list_ptr, pos, Any(value));
     }
@@ -309,6 +334,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetLong(JNIEnv* env,
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddDouble(JNIEnv* env, jclass, jlong list_ptr,
                                                                      jdouble value)
 {
+    JNI_PROBE();
     try {
         add_value(env, list_ptr, Any(value));
     }
@@ -318,6 +344,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddDouble(JNIEnv* env
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertDouble(JNIEnv* env, jclass, jlong list_ptr,
                                                                         jlong pos, jdouble value)
 {
+    JNI_PROBE();
     try {
         insert_value(env, list_ptr, pos, Any(value));
     }
@@ -327,6 +354,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertDouble(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetDouble(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                      jdouble value)
 {
+    JNI_PROBE();
     try {
         set_value(env, list_ptr, pos, Any(value));
     }
@@ -335,6 +363,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetDouble(JNIEnv* env
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddFloat(JNIEnv* env, jclass, jlong list_ptr, jfloat value)
 {
+    JNI_PROBE();
     try {
         add_value(env, list_ptr, Any(value));
     }
@@ -344,6 +373,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddFloat(JNIEnv* env,
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertFloat(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                        jfloat value)
 {
+    JNI_PROBE();
     try {
         insert_value(env, list_ptr, pos, Any(value));
     }
@@ -353,6 +383,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertFloat(JNIEnv* e
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetFloat(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                     jfloat value)
 {
+    JNI_PROBE();
     try {
         set_value(env, list_ptr, pos, Any(value));
     }
@@ -362,6 +393,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetFloat(JNIEnv* env,
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddBoolean(JNIEnv* env, jclass, jlong list_ptr,
                                                                       jboolean value)
 {
+    JNI_PROBE();
     try {
         add_value(env, list_ptr, Any(value));
     }
@@ -371,6 +403,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddBoolean(JNIEnv* en
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertBoolean(JNIEnv* env, jclass, jlong list_ptr,
                                                                          jlong pos, jboolean value)
 {
+    JNI_PROBE();
     try {
         insert_value(env, list_ptr, pos, Any(value));
     }
@@ -380,6 +413,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertBoolean(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetBoolean(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                       jboolean value)
 {
+    JNI_PROBE();
     try {
         set_value(env, list_ptr, pos, Any(value));
     }
@@ -389,6 +423,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetBoolean(JNIEnv* en
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddBinary(JNIEnv* env, jclass, jlong list_ptr,
                                                                      jbyteArray value)
 {
+    JNI_PROBE();
     try {
         check_nullable(env, list_ptr, value);
         JByteArrayAccessor accessor(env, value);
@@ -400,6 +435,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddBinary(JNIEnv* env
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertBinary(JNIEnv* env, jclass, jlong list_ptr,
                                                                         jlong pos, jbyteArray value)
 {
+    JNI_PROBE();
     try {
         check_nullable(env, list_ptr, value);
         JByteArrayAccessor accessor(env, value);
@@ -411,6 +447,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertBinary(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetBinary(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                      jbyteArray value)
 {
+    JNI_PROBE();
     try {
         check_nullable(env, list_ptr, value);
         JByteArrayAccessor accessor(env, value);
@@ -421,6 +458,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetBinary(JNIEnv* env
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddDate(JNIEnv* env, jclass, jlong list_ptr, jlong value)
 {
+    JNI_PROBE();
     try {
         add_value(env, list_ptr, Any(value));
     }
@@ -430,6 +468,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddDate(JNIEnv* env,
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertDate(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                       jlong value)
 {
+    JNI_PROBE();
     try {
         insert_value(env, list_ptr, pos, Any(value));
     }
@@ -439,6 +478,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertDate(JNIEnv* en
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetDate(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                    jlong value)
 {
+    JNI_PROBE();
     try {
         set_value(env, list_ptr, pos, Any(value));
     }
@@ -448,6 +488,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetDate(JNIEnv* env,
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddString(JNIEnv* env, jclass, jlong list_ptr,
                                                                      jstring value)
 {
+    JNI_PROBE();
     try {
         check_nullable(env, list_ptr, value);
         JStringAccessor accessor(env, value);
@@ -459,6 +500,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddString(JNIEnv* env
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertString(JNIEnv* env, jclass, jlong list_ptr,
                                                                         jlong pos, jstring value)
 {
+    JNI_PROBE();
     try {
         check_nullable(env, list_ptr, value);
         JStringAccessor accessor(env, value);
@@ -470,6 +512,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertString(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetString(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                      jstring value)
 {
+    JNI_PROBE();
     try {
         check_nullable(env, list_ptr, value);
         JStringAccessor accessor(env, value);
@@ -481,6 +524,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetString(JNIEnv* env
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddDecimal128(JNIEnv* env, jclass, jlong list_ptr,
                                                                          jlong j_low_value, jlong j_high_value)
 {
+    JNI_PROBE();
     try {
           Decimal128::Bid128 raw {static_cast<uint64_t>(j_low_value), static_cast<uint64_t>(j_high_value)};
           add_value(env, list_ptr, Any(Decimal128(raw)));
@@ -491,6 +535,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddDecimal128(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertDecimal128(JNIEnv* env, jclass, jlong list_ptr,
                                                                             jlong pos, jlong j_low_value, jlong j_high_value)
 {
+    JNI_PROBE();
     try {
         Decimal128::Bid128 raw {static_cast<uint64_t>(j_low_value), static_cast<uint64_t>(j_high_value)};
         insert_value(env, list_ptr, pos, Any(Decimal128(raw)));
@@ -501,6 +546,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertDecimal128(JNIE
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetDecimal128(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                          jlong j_high_value, jlong j_low_value)
 {
+    JNI_PROBE();
     try {
         Decimal128::Bid128 raw {static_cast<uint64_t>(j_low_value), static_cast<uint64_t>(j_high_value)};
         set_value(env, list_ptr, pos, Any(Decimal128(raw)));
@@ -511,6 +557,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetDecimal128(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddObjectId(JNIEnv* env, jclass, jlong list_ptr,
                                                                          jstring j_value)
 {
+    JNI_PROBE();
 
     try {
         JStringAccessor value(env, j_value);
@@ -522,6 +569,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeAddObjectId(JNIEnv* e
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertObjectId(JNIEnv* env, jclass, jlong list_ptr,
                                                                             jlong pos, jstring j_value)
 {
+    JNI_PROBE();
     try {
         JStringAccessor value(env, j_value);
         insert_value(env, list_ptr, pos, Any(ObjectId(StringData(value).data())));
@@ -532,6 +580,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeInsertObjectId(JNIEnv
 JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetObjectId(JNIEnv* env, jclass, jlong list_ptr, jlong pos,
                                                                          jstring j_value)
 {
+    JNI_PROBE();
     try {
         JStringAccessor value(env, j_value);
         set_value(env, list_ptr, pos, Any(ObjectId(StringData(value).data())));
@@ -541,6 +590,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsList_nativeSetObjectId(JNIEnv* e
 
 JNIEXPORT jobject JNICALL Java_io_realm_internal_OsList_nativeGetValue(JNIEnv* env, jclass, jlong list_ptr, jlong pos)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(list_ptr);
         JavaAccessorContext context(env);
@@ -553,6 +603,7 @@ JNIEXPORT jobject JNICALL Java_io_realm_internal_OsList_nativeGetValue(JNIEnv* e
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeCreateAndAddEmbeddedObject(JNIEnv* env, jclass, jlong native_list_ptr, jlong j_index)
 {
+    JNI_PROBE();
     try {
         List& list = reinterpret_cast<ListWrapper*>(native_list_ptr)->collection();
         auto& realm = list.get_realm();
@@ -572,6 +623,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeCreateAndAddEmbedded
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeCreateAndSetEmbeddedObject(JNIEnv* env, jclass, jlong native_list_ptr, jlong j_index)
 {
+    JNI_PROBE();
     try {
         List& list = reinterpret_cast<ListWrapper*>(native_list_ptr)->collection();
         auto& realm = list.get_realm();
@@ -590,6 +642,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeCreateAndSetEmbedded
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsList_nativeFreeze(JNIEnv* env, jclass, jlong native_list_ptr, jlong frozen_realm_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto& wrapper = *reinterpret_cast<ListWrapper*>(native_list_ptr);
         auto frozen_realm = *(reinterpret_cast<SharedRealm*>(frozen_realm_native_ptr));
@@ -31,6 +31,7 @@
 #include "jni_util/java_method.hpp"
 #include "jni_util/java_class.hpp"
 #include "jni_util/java_exception_thrower.hpp"
+#include "jni_util/native_object_counter.hpp"
 
 using namespace realm;
 using namespace realm::jni_util;
@@ -51,6 +52,7 @@ struct ObjectWrapper {
         , m_notification_token()
         , m_object(std::move(object))
     {
+        NativeObjectCounter::created(NativeObjectCounter::object);
     }
 
     ObjectWrapper(ObjectWrapper&&) = delete;
@@ -61,6 +63,7 @@ struct ObjectWrapper {
 
     ~ObjectWrapper()
     {
+        NativeObjectCounter::destroyed(NativeObjectCounter::object);
     }
 };
 
@@ -246,12 +249,14 @@ static inline Obj do_create_row_with_object_id_primary_key(JNIEnv* env, jlong sh
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_object);
 }
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreate(JNIEnv*, jclass, jlong shared_realm_ptr,
                                                                      jlong obj_ptr)
 {
+    JNI_PROBE();
     // FIXME: Currently OsObject is only used for object notifications. Since the Object Store's schema has not been
     // fully integrated with realm-java, we pass a dummy ObjectSchema to create Object.
     static const ObjectSchema dummy_object_schema;
@@ -265,25 +270,24 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreate(JNIEnv*, jc
 JNIEXPORT void JNICALL Java_io_realm_internal_OsObject_nativeStartListening(JNIEnv* env, jobject instance,
                                                                             jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ObjectWrapper*>(native_ptr);
         if (!wrapper->m_row_object_weak_ref) {
             wrapper->m_row_object_weak_ref = JavaGlobalWeakRef(env, instance);
         }
 
-        static JavaClass os_object_class(env, "io/realm/internal/OsObject");
-        static JavaMethod notify_change_listeners(env, os_object_class, "notifyChangeListeners",
-                                                  "([Ljava/lang/String;)V");
         // The wrapper pointer will be used in the callback. But it should never become an invalid pointer when the
         // notification block gets called. This should be guaranteed by the Object Store that after the notification
         // token is destroyed, the block shouldn't be called.
-        wrapper->m_notification_token = wrapper->m_object.add_notification_callback(ChangeCallback(wrapper, notify_change_listeners));
+        wrapper->m_notification_token = wrapper->m_object.add_notification_callback(ChangeCallback(wrapper, JavaClassGlobalDef::os_object_notify_change_listeners(env)));
     }
     CATCH_STD()
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsObject_nativeStopListening(JNIEnv* env, jobject, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ObjectWrapper*>(native_ptr);
         wrapper->m_notification_token = {};
@@ -293,6 +297,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsObject_nativeStopListening(JNIEn
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateRow(JNIEnv* env, jclass, jlong table_ref_ptr)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(table_ref_ptr);
         Obj obj = table->create_object();
@@ -304,9 +309,10 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateRow(JNIEnv*
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateNewObject(JNIEnv* env, jclass, jlong table_ref_ptr)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(table_ref_ptr);
-        Obj* obj = new Obj(table->create_object());
+        Obj* obj = NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(table->create_object()));
         return reinterpret_cast<jlong>(obj);
     }
     CATCH_STD()
@@ -317,11 +323,12 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateNewObjectWit
     JNIEnv* env, jclass, jlong shared_realm_ptr, jlong table_ref_ptr, jlong pk_column_ndx, jlong pk_value,
     jboolean is_pk_null)
 {
+    JNI_PROBE();
     try {
         Obj obj =
             do_create_row_with_primary_key(env, shared_realm_ptr, table_ref_ptr, pk_column_ndx, pk_value, is_pk_null);
         if (bool(obj)) {
-            return reinterpret_cast<jlong>(new Obj(obj));
+            return reinterpret_cast<jlong>(NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(obj)));
         }
     }
     CATCH_STD()
@@ -332,6 +339,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateRowWithLongP
     JNIEnv* env, jclass, jlong shared_realm_ptr, jlong table_ref_ptr, jlong pk_column_ndx, jlong pk_value,
     jboolean is_pk_null)
 {
+    JNI_PROBE();
     try {
         Obj obj = do_create_row_with_primary_key(env, shared_realm_ptr, table_ref_ptr, pk_column_ndx, pk_value, is_pk_null);
         return (jlong)(obj.get_key().value);
@@ -343,10 +351,11 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateRowWithLongP
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateNewObjectWithStringPrimaryKey(
     JNIEnv* env, jclass, jlong shared_realm_ptr, jlong table_ref_ptr, jlong pk_column_ndx, jstring pk_value)
 {
+    JNI_PROBE();
     try {
         Obj obj = do_create_row_with_primary_key(env, shared_realm_ptr, table_ref_ptr, pk_column_ndx, pk_value);
         if (bool(obj)) {
-            return reinterpret_cast<jlong>(new Obj(obj));
+            return reinterpret_cast<jlong>(NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(obj)));
         }
     }
     CATCH_STD()
@@ -356,6 +365,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateNewObjectWit
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateRowWithStringPrimaryKey(
     JNIEnv* env, jclass, jlong shared_realm_ptr, jlong table_ref_ptr, jlong pk_column_ndx, jstring pk_value)
 {
+    JNI_PROBE();
     try {
         Obj obj = do_create_row_with_primary_key(env, shared_realm_ptr, table_ref_ptr, pk_column_ndx, pk_value);
         return (jlong)(obj.get_key().value);
@@ -367,6 +377,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateRowWithStrin
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateRowWithObjectIdPrimaryKey(
     JNIEnv* env, jclass, jlong shared_realm_ptr, jlong table_ref_ptr, jlong pk_column_ndx, jstring pk_value)
 {
+    JNI_PROBE();
     try {
         Obj obj = do_create_row_with_object_id_primary_key(env, shared_realm_ptr, table_ref_ptr, pk_column_ndx, pk_value);
         return (jlong)(obj.get_key().value);
@@ -378,10 +389,11 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateRowWithObjec
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateNewObjectWithObjectIdPrimaryKey(
     JNIEnv* env, jclass, jlong shared_realm_ptr, jlong table_ref_ptr, jlong pk_column_ndx, jstring pk_value)
 {
+    JNI_PROBE();
     try {
         Obj obj = do_create_row_with_object_id_primary_key(env, shared_realm_ptr, table_ref_ptr, pk_column_ndx, pk_value);
         if (bool(obj)) {
-            return reinterpret_cast<jlong>(new Obj(obj));
+            return reinterpret_cast<jlong>(NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(obj)));
         }
     }
     CATCH_STD()
@@ -391,6 +403,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateNewObjectWit
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObject_nativeCreateEmbeddedObject(
     JNIEnv* env, jclass, jlong j_parent_table_ptr, jlong j_parent_object_key, jlong j_parent_column_key)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(j_parent_table_ptr);
         ObjKey obj_key(static_cast<int64_t>(j_parent_object_key));
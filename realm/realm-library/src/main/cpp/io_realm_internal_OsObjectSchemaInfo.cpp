@@ -39,6 +39,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeCreateRe
                                                                                                 jstring j_name_str,
                                                                                                 jboolean j_embedded)
 {
+    JNI_PROBE();
     try {
         JStringAccessor name(env, j_name_str);
         ObjectSchema* object_schema = new ObjectSchema();
@@ -52,6 +53,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeCreateRe
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_object_schema);
 }
 
@@ -60,6 +62,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeAddProper
                                                                                      jlongArray j_persisted_properties,
                                                                                      jlongArray j_computed_properties)
 {
+    JNI_PROBE();
     try {
         ObjectSchema& object_schema = *reinterpret_cast<ObjectSchema*>(native_ptr);
         JLongArrayAccessor persisted_properties(env, j_persisted_properties);
@@ -89,6 +92,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeAddProper
 JNIEXPORT jstring JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeGetClassName(JNIEnv* env, jclass,
                                                                                        jlong nativePtr)
 {
+    JNI_PROBE();
     try {
         ObjectSchema* object_schema = reinterpret_cast<ObjectSchema*>(nativePtr);
         auto name = object_schema->name;
@@ -103,6 +107,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeGetPrope
                                                                                     jlong native_ptr,
                                                                                     jstring j_property_name)
 {
+    JNI_PROBE();
     try {
         auto& object_schema = *reinterpret_cast<ObjectSchema*>(native_ptr);
         JStringAccessor property_name_accessor(env, j_property_name);
@@ -121,6 +126,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeGetPrope
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeGetPrimaryKeyProperty(JNIEnv* env, jclass,
                                                                                               jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto& object_schema = *reinterpret_cast<ObjectSchema*>(native_ptr);
         auto* property = object_schema.primary_key_property();
@@ -134,6 +140,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeGetPrima
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsObjectSchemaInfo_nativeIsEmbedded(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto& object_schema = *reinterpret_cast<ObjectSchema*>(native_ptr);
         return to_jbool(object_schema.is_embedded);
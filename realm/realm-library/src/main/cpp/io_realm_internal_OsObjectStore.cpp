@@ -37,6 +37,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsObjectStore_nativeSetPrimaryKeyF
                                                                                           jstring j_class_name,
                                                                                           jstring j_pk_field_name)
 {
+    JNI_PROBE();
     try {
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         JStringAccessor class_name_accessor(env, j_class_name);
@@ -86,6 +87,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_OsObjectStore_nativeGetPrimaryK
                                                                                              jlong shared_realm_ptr,
                                                                                              jstring j_class_name)
 {
+    JNI_PROBE();
     try {
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         JStringAccessor class_name_accessor(env, j_class_name);
@@ -100,6 +102,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsObjectStore_nativeSetSchemaVersi
                                                                                    jlong shared_realm_ptr,
                                                                                    jlong schema_version)
 {
+    JNI_PROBE();
     try {
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         shared_realm->verify_in_write();
@@ -111,6 +114,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsObjectStore_nativeSetSchemaVersi
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsObjectStore_nativeGetSchemaVersion(JNIEnv* env, jclass,
                                                                                     jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     try {
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         return ObjectStore::get_schema_version(shared_realm->read_group());
@@ -123,6 +127,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsObjectStore_nativeDeleteTabl
                                                                                         jlong shared_realm_ptr,
                                                                                         jstring j_class_name)
 {
+    JNI_PROBE();
     try {
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         JStringAccessor class_name_accessor(env, j_class_name);
@@ -141,6 +146,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsObjectStore_nativeCallWithLo
                                                                                    jstring j_realm_path,
                                                                                    jobject j_runnable)
 {
+    JNI_PROBE();
     try {
         JStringAccessor path_accessor(env, j_realm_path);
         std::string realm_path(path_accessor);
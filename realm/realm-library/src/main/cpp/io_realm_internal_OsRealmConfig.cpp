@@ -72,6 +72,7 @@ static JavaClass& get_shared_realm_class(JNIEnv* env)
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsRealmConfig_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_realm_config);
 }
 
@@ -80,6 +81,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsRealmConfig_nativeCreate(JNIEnv
                                                                           jboolean enable_format_upgrade,
                                                                           jlong j_max_number_of_active_versions)
 {
+    JNI_PROBE();
     try {
         JStringAccessor realm_path(env, j_realm_path);
         JStringAccessor fifo_fallback_dir(env, j_fifo_fallback_dir);
@@ -98,6 +100,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeSetEncryptionK
                                                                                    jlong native_ptr,
                                                                                    jbyteArray j_key_array)
 {
+    JNI_PROBE();
     try {
         JByteArrayAccessor jarray_accessor(env, j_key_array);
         auto& config = *reinterpret_cast<Realm::Config*>(native_ptr);
@@ -111,6 +114,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeSetEncryptionK
 JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeSetInMemory(JNIEnv*, jclass, jlong native_ptr,
                                                                               jboolean in_mem)
 {
+    JNI_PROBE();
     auto& config = *reinterpret_cast<Realm::Config*>(native_ptr);
     config.in_memory = in_mem; // no throw
 }
@@ -121,6 +125,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeSetSchemaConfi
                                                                                   jlong schema_info_ptr,
                                                                                   jobject j_migration_callback)
 {
+    JNI_PROBE();
     try {
         auto& config = *reinterpret_cast<Realm::Config*>(native_ptr);
         config.schema_mode = static_cast<SchemaMode>(schema_mode);
@@ -170,6 +175,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeSetSchemaConfi
 JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeSetCompactOnLaunchCallback(
     JNIEnv* env, jclass, jlong native_ptr, jobject j_compact_on_launch)
 {
+    JNI_PROBE();
     try {
         auto& config = *reinterpret_cast<Realm::Config*>(native_ptr);
         if (j_compact_on_launch) {
@@ -202,6 +208,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeSetInitializat
                                                                                             jlong native_ptr,
                                                                                             jobject j_init_callback)
 {
+    JNI_PROBE();
     try {
         auto& config = *reinterpret_cast<Realm::Config*>(native_ptr);
 
@@ -238,6 +245,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeSetInitializat
 JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeEnableChangeNotification(
     JNIEnv*, jclass, jlong native_ptr, jboolean enable_auto_change_notification)
 {
+    JNI_PROBE();
     // No throws
     auto& config = *reinterpret_cast<Realm::Config*>(native_ptr);
     config.automatic_change_notifications = enable_auto_change_notification;
@@ -250,6 +258,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_OsRealmConfig_nativeCreateAndSe
     jstring j_custom_auth_header_name, jobjectArray j_custom_headers_array, jbyte j_client_reset_mode,
     jstring j_partion_key_value, jobject j_java_sync_service)
 {
+    JNI_PROBE();
     auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
     auto& config = *reinterpret_cast<Realm::Config*>(j_config_ptr);
     // sync_config should only be initialized once!
@@ -386,6 +395,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeSetSyncConfigS
     JNIEnv* env, jclass, jlong native_ptr, jboolean sync_client_validate_ssl,
     jstring j_sync_ssl_trust_certificate_path)
 {
+    JNI_PROBE();
     auto& config = *reinterpret_cast<Realm::Config*>(native_ptr);
     // To ensure the sync_config has been created and this function won't be called multiple time on the same config.
     REALM_ASSERT(config.sync_config);
@@ -437,6 +447,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsRealmConfig_nativeSetSyncConfigP
     JNIEnv* env, jclass, jlong native_ptr, jbyte proxy_type,
     jstring j_proxy_address, jint proxy_port)
 {
+    JNI_PROBE();
     auto& config = *reinterpret_cast<Realm::Config*>(native_ptr);
     // To ensure the sync_config has been created and this function won't be called multiple time on the same config.
     REALM_ASSERT(config.sync_config);
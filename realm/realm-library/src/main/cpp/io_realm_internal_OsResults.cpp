@@ -18,6 +18,7 @@
 
 #include <shared_realm.hpp>
 #include <results.hpp>
+#include <object_store.hpp>
 #include <list.hpp>
 #include <realm/util/optional.hpp>
 
@@ -45,6 +46,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeCreateResults(JNI
                                                                              jlong query_ptr,
                                                                              jlong descriptor_ordering_ptr)
 {
+    JNI_PROBE();
     try {
         auto query = reinterpret_cast<Query*>(query_ptr);
         if (!TABLE_VALID(env, query->get_table())) {
@@ -64,6 +66,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeCreateResults(JNI
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeCreateSnapshot(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         auto snapshot_results = wrapper->collection().snapshot();
@@ -77,6 +80,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeCreateSnapshot(JN
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsResults_nativeContains(JNIEnv* env, jclass, jlong native_ptr,
                                                                             jlong native_obj_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         const Obj* obj = reinterpret_cast<Obj*>(native_obj_ptr);
@@ -90,10 +94,11 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsResults_nativeContains(JNIEn
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeGetRow(JNIEnv* env, jclass, jlong native_ptr,
                                                                        jint index)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         auto obj = wrapper->collection().get(static_cast<size_t>(index));
-        return reinterpret_cast<jlong>(new Obj(std::move(obj)));
+        return reinterpret_cast<jlong>(NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(std::move(obj))));
     }
     CATCH_STD()
     return reinterpret_cast<jlong>(nullptr);
@@ -101,11 +106,13 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeGetRow(JNIEnv* en
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeFirstRow(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         auto optional_obj = wrapper->collection().first();
         if (optional_obj) {
-            return reinterpret_cast<jlong>(new Obj(std::move(optional_obj.value())));
+            return reinterpret_cast<jlong>(
+                NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(std::move(optional_obj.value()))));
         }
     }
     CATCH_STD()
@@ -115,11 +122,13 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeFirstRow(JNIEnv*
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeLastRow(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         auto optional_obj = wrapper->collection().last();
         if (optional_obj) {
-            return reinterpret_cast<jlong>(new Obj(optional_obj.value()));
+            return reinterpret_cast<jlong>(
+                NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(optional_obj.value())));
         }
     }
     CATCH_STD()
@@ -128,6 +137,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeLastRow(JNIEnv* e
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeClear(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         wrapper->collection().clear();
@@ -137,6 +147,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeClear(JNIEnv* env,
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeSize(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         return static_cast<jlong>(wrapper->collection().size());
@@ -148,6 +159,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeSize(JNIEnv* env,
 JNIEXPORT jobject JNICALL Java_io_realm_internal_OsResults_nativeAggregate(JNIEnv* env, jclass, jlong native_ptr,
                                                                             jlong column_key, jbyte agg_func)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
 
@@ -202,6 +214,7 @@ JNIEXPORT jobject JNICALL Java_io_realm_internal_OsResults_nativeAggregate(JNIEn
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeSort(JNIEnv* env, jclass, jlong native_ptr,
                                                                      jobject j_sort_desc)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         auto sorted_result = wrapper->collection().sort(JavaQueryDescriptor(env, j_sort_desc).sort_descriptor());
@@ -214,6 +227,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeSort(JNIEnv* env,
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeDistinct(JNIEnv* env, jclass, jlong native_ptr,
                                                                          jobject j_distinct_desc)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         auto distinct_result =
@@ -227,6 +241,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeDistinct(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeStartListening(JNIEnv* env, jobject instance,
                                                                               jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         wrapper->start_listening(env, instance);
@@ -236,6 +251,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeStartListening(JNI
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeStopListening(JNIEnv* env, jobject, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         wrapper->stop_listening();
@@ -245,17 +261,20 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeStopListening(JNIE
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_results);
 }
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeWhere(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
 
         auto table_view = wrapper->collection().get_tableview();
         Query* query =
             new Query(table_view.get_parent(), std::unique_ptr<ConstTableView>(new TableView(std::move(table_view))));
+        NativeObjectCounter::created(NativeObjectCounter::query);
         return reinterpret_cast<jlong>(query);
     }
     CATCH_STD()
@@ -264,6 +283,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeWhere(JNIEnv* env
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_OsResults_toJSON(JNIEnv* env, jclass, jlong native_ptr, jint maxDepth)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
 
@@ -279,6 +299,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_OsResults_toJSON(JNIEnv* env, j
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeIndexOf(JNIEnv* env, jclass, jlong native_ptr,
                                                                         jlong obj_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         Obj* obj = reinterpret_cast<Obj*>(obj_native_ptr);
@@ -291,6 +312,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeIndexOf(JNIEnv* e
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsResults_nativeDeleteLast(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         auto obj = wrapper->collection().last();
@@ -305,6 +327,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsResults_nativeDeleteLast(JNI
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsResults_nativeDeleteFirst(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         auto obj = wrapper->collection().first();
@@ -330,36 +353,42 @@ static inline void update_objects(JNIEnv* env, jlong results_ptr, jstring& j_fie
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetNull(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name)
 {
+    JNI_PROBE();
     auto value = JavaValue();
     update_objects(env, native_ptr, j_field_name, value);
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetBoolean(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jboolean j_value)
 {
+    JNI_PROBE();
     JavaValue value(j_value);
     update_objects(env, native_ptr, j_field_name, value);
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetInt(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jlong j_value)
 {
+    JNI_PROBE();
     JavaValue value(j_value);
     update_objects(env, native_ptr, j_field_name, value);
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetFloat(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jfloat j_value)
 {
+    JNI_PROBE();
     JavaValue value(j_value);
     update_objects(env, native_ptr, j_field_name, value);
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetDouble(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jdouble j_value)
 {
+    JNI_PROBE();
     JavaValue value(j_value);
     update_objects(env, native_ptr, j_field_name, value);
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetString(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jstring j_value)
 {
+    JNI_PROBE();
     JStringAccessor str(env, j_value);
     JavaValue value = str.is_null() ? JavaValue() : JavaValue(std::string(str));
     update_objects(env, native_ptr, j_field_name, value);
@@ -367,19 +396,22 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetString(JNIEnv*
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetBinary(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jbyteArray j_value)
 {
-    auto data = OwnedBinaryData(JByteArrayAccessor(env, j_value).transform<BinaryData>());
+    JNI_PROBE();
+    auto data = OwnedBinaryData(JByteArrayCriticalAccessor(env, j_value).transform<BinaryData>());
     JavaValue value(data);
     update_objects(env, native_ptr, j_field_name, value);
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetTimestamp(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jlong j_value)
 {
+    JNI_PROBE();
     JavaValue value(from_milliseconds(j_value));
     update_objects(env, native_ptr, j_field_name, value);
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetDecimal128(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jlong low, jlong high)
 {
+    JNI_PROBE();
 
     Decimal128::Bid128 raw = {static_cast<uint64_t>(low), static_cast<uint64_t>(high)};
     Decimal128 decimal128 = Decimal128(raw);
@@ -389,6 +421,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetDecimal128(JNIE
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetObjectId(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jstring j_value)
 {
+    JNI_PROBE();
     JStringAccessor data(env, j_value);
     ObjectId objectId = ObjectId(StringData(data).data());
     JavaValue value(objectId);
@@ -397,12 +430,14 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetObjectId(JNIEnv
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetObject(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jlong row_ptr)
 {
+    JNI_PROBE();
     JavaValue value(reinterpret_cast<Obj*>(row_ptr));
     update_objects(env, native_ptr, j_field_name, value);
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetList(JNIEnv* env, jclass, jlong native_ptr, jstring j_field_name, jlong builder_ptr)
 {
+    JNI_PROBE();
     // OsObjectBuilder has been used to build up the list we want to insert. This means the
     // fake object described by the OsObjectBuilder only contains one property, namely the list we
     // want to insert and this list is assumed to be at index = 0.
@@ -411,9 +446,154 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetList(JNIEnv* en
     update_objects(env, native_ptr, j_field_name, builder.begin()->second);
 }
 
+static DataType to_data_type(JavaValueType type)
+{
+    switch (type) {
+        case JavaValueType::Integer:
+            return type_Int;
+        case JavaValueType::String:
+            return type_String;
+        case JavaValueType::Boolean:
+            return type_Bool;
+        case JavaValueType::Float:
+            return type_Float;
+        case JavaValueType::Double:
+            return type_Double;
+        case JavaValueType::Date:
+            return type_Timestamp;
+        case JavaValueType::ObjectId:
+            return type_ObjectId;
+        case JavaValueType::Decimal:
+            return type_Decimal;
+        case JavaValueType::Binary:
+            return type_Binary;
+        case JavaValueType::Object:
+            return type_Link;
+        default:
+            throw util::invalid_argument("Lists cannot be set together with other fields.");
+    }
+}
+
+// Checks up front what Object Store checks per object when setting a property by name, so no object is modified
+// if any of the values cannot be set.
+static void check_settable(const Table& table, ColKey col_key, const JavaValue& value)
+{
+    std::string class_name = ObjectStore::object_type_for_table_name(table.get_name());
+    if (!table.valid_column(col_key)) {
+        throw util::invalid_argument(util::format("Invalid column in class '%1'.", class_name));
+    }
+    std::string field = util::format("%1.%2", class_name, std::string(table.get_column_name(col_key)));
+    if (col_key.is_list()) {
+        throw util::invalid_argument(
+            util::format("'%1' is a list and cannot be set together with other fields.", field));
+    }
+    if (table.get_primary_key_column() == col_key) {
+        throw std::logic_error(util::format("Cannot modify primary key after creation: '%1'", field));
+    }
+    if (!value.has_value()) {
+        if (!col_key.is_nullable() && table.get_column_type(col_key) != type_Link) {
+            throw util::invalid_argument(util::format("'%1' is required and cannot be set to null.", field));
+        }
+        return;
+    }
+    if (to_data_type(value.get_type()) != table.get_column_type(col_key)) {
+        throw util::invalid_argument(util::format("The value of '%1' is of the wrong type.", field));
+    }
+    if (value.get_type() == JavaValueType::Object) {
+        ConstTableRef target = table.get_link_target(col_key);
+        if (target->is_embedded()) {
+            throw util::invalid_argument(
+                util::format("'%1' links to embedded objects, which cannot be shared.", field));
+        }
+        if (value.get_object()->get_table()->get_key() != target->get_key()) {
+            throw util::invalid_argument(util::format("The object set to '%1' is of the wrong class.", field));
+        }
+    }
+}
+
+static void set_value(Obj& obj, ColKey col_key, const JavaValue& value)
+{
+    switch (value.get_type()) {
+        case JavaValueType::Empty:
+            if (obj.get_table()->get_column_type(col_key) == type_Link) {
+                obj.set(col_key, ObjKey());
+            }
+            else {
+                obj.set_null(col_key);
+            }
+            break;
+        case JavaValueType::Integer:
+            obj.set(col_key, static_cast<int64_t>(value.get_int()));
+            break;
+        case JavaValueType::String:
+            obj.set(col_key, StringData(value.get_string()));
+            break;
+        case JavaValueType::Boolean:
+            obj.set(col_key, value.get_boolean() == JNI_TRUE);
+            break;
+        case JavaValueType::Float:
+            obj.set(col_key, static_cast<float>(value.get_float()));
+            break;
+        case JavaValueType::Double:
+            obj.set(col_key, static_cast<double>(value.get_double()));
+            break;
+        case JavaValueType::Date:
+            obj.set(col_key, value.get_date());
+            break;
+        case JavaValueType::ObjectId:
+            obj.set(col_key, value.get_object_id());
+            break;
+        case JavaValueType::Decimal:
+            obj.set(col_key, value.get_decimal128());
+            break;
+        case JavaValueType::Binary:
+            obj.set(col_key, value.get_binary().get());
+            break;
+        case JavaValueType::Object:
+            obj.set(col_key, value.get_object()->get_key());
+            break;
+        default:
+            REALM_UNREACHABLE();
+    }
+}
+
+// Sets the values of an OsObjectBuilder, keyed by column, on every object of the results. Unlike update_objects(),
+// which walks all objects once per field and resolves the property by name through a JavaContext, the objects are
+// walked once and the values are written straight to the columns.
+JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeSetMany(JNIEnv* env, jclass, jlong native_ptr,
+                                                                      jlong builder_ptr)
+{
+    JNI_PROBE();
+    try {
+        auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
+        Results& results = wrapper->collection();
+        auto& values = *reinterpret_cast<std::map<ColKey, JavaValue>*>(builder_ptr);
+
+        auto realm = results.get_realm();
+        realm->verify_in_write();
+        ConstTableRef table = results.get_table();
+        for (const auto& entry : values) {
+            check_settable(*table, entry.first, entry.second);
+        }
+
+        // Like Results::set_property_value(), update a snapshot, so objects which no longer match the query after
+        // the first values have been set are still updated.
+        Results snapshot = results.snapshot();
+        size_t size = snapshot.size();
+        for (size_t i = 0; i < size; ++i) {
+            Obj obj = snapshot.get(i);
+            for (const auto& entry : values) {
+                set_value(obj, entry.first, entry.second);
+            }
+        }
+    }
+    CATCH_STD()
+}
+
 JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeDelete(JNIEnv* env, jclass, jlong native_ptr,
                                                                       jlong index)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         auto obj = wrapper->collection().get(index);
@@ -426,6 +606,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeDelete(JNIEnv* env
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsResults_nativeIsValid(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         return wrapper->collection().is_valid();
@@ -436,6 +617,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsResults_nativeIsValid(JNIEnv
 
 JNIEXPORT jbyte JNICALL Java_io_realm_internal_OsResults_nativeGetMode(JNIEnv* env, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         switch (wrapper->collection().get_mode()) {
@@ -465,6 +647,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeCreateResultsFrom
                                                                                            jlong src_table_ref_ptr,
                                                                                            jlong src_col_key)
 {
+    JNI_PROBE();
     Obj* obj = OBJ(obj_ptr);
     if (!ROW_VALID(env, obj)) {
         return reinterpret_cast<jlong>(nullptr);
@@ -485,6 +668,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeEvaluateQueryIfNee
                                                                                     jlong native_ptr,
                                                                                     jboolean wants_notifications)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         wrapper->collection().evaluate_query_if_needed(wants_notifications);
@@ -495,6 +679,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsResults_nativeEvaluateQueryIfNee
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsResults_nativeFreeze(JNIEnv* env, jclass, jlong native_ptr, jlong frozen_realm_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto wrapper = reinterpret_cast<ResultsWrapper*>(native_ptr);
         auto frozen_realm = *(reinterpret_cast<SharedRealm*>(frozen_realm_native_ptr));
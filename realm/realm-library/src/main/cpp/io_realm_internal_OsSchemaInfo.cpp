@@ -37,6 +37,7 @@ static void finalize_schema(jlong ptr)
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSchemaInfo_nativeCreateFromList(JNIEnv* env, jclass,
                                                                                  jlongArray objectSchemaPtrs_)
 {
+    JNI_PROBE();
     try {
         std::vector<ObjectSchema> object_schemas;
         JLongArrayAccessor array(env, objectSchemaPtrs_);
@@ -52,6 +53,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSchemaInfo_nativeCreateFromList
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSchemaInfo_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_schema);
 }
 
@@ -59,6 +61,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSchemaInfo_nativeGetObjectSchem
                                                                                       jlong native_ptr,
                                                                                       jstring j_class_name)
 {
+    JNI_PROBE();
     try {
         JStringAccessor class_name_accessor(env, j_class_name);
         StringData class_name(class_name_accessor);
@@ -30,6 +30,7 @@
 
 #include "java_accessor.hpp"
 #include "java_binding_context.hpp"
+#include "java_class_global_def.hpp"
 #include "java_exception_def.hpp"
 #include "object_store.hpp"
 #include "util.hpp"
@@ -51,9 +52,12 @@ typedef ObservableCollectionWrapper<Results> ResultsWrapper;
 JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeInit(JNIEnv* env, jclass,
                                                                      jstring temporary_directory_path)
 {
+    JNI_PROBE();
     try {
         JStringAccessor path(env, temporary_directory_path);    // throws
         DBOptions::set_sys_tmp_dir(std::string(path)); // throws
+        // Realm.init() runs after JNI_OnLoad, so the io.realm classes can be initialized now.
+        JavaClassGlobalDef::initialize_realm_methods(env);
     }
     CATCH_STD()
 }
@@ -62,6 +66,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeGetSharedReal
                                                                                 jlong j_version_no, jlong j_version_index,
                                                                                 jobject realm_notifier)
 {
+    JNI_PROBE();
     auto& config = *reinterpret_cast<Realm::Config*>(config_ptr);
     try {
         SharedRealm shared_realm;
@@ -110,6 +115,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeGetSharedReal
 JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeCloseSharedRealm(JNIEnv*, jclass,
                                                                                  jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     // Close the SharedRealm only. Let the finalizer daemon thread free the SharedRealm
     if (!shared_realm->is_closed()) {
@@ -120,6 +126,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeCloseSharedRea
 JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeBeginTransaction(JNIEnv* env, jclass,
                                                                                  jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         shared_realm->begin_transaction();
@@ -130,6 +137,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeBeginTransacti
 JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeCommitTransaction(JNIEnv* env, jclass,
                                                                                   jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         shared_realm->commit_transaction();
@@ -146,6 +154,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeCommitTransact
 JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeCancelTransaction(JNIEnv* env, jclass,
                                                                                   jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         shared_realm->cancel_transaction();
@@ -157,6 +166,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeCancelTransact
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsInTransaction(JNIEnv*, jclass,
                                                                                     jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     return static_cast<jboolean>(shared_realm->is_in_transaction());
 }
@@ -164,6 +174,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsInTransa
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsEmpty(JNIEnv* env, jclass,
                                                                             jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         return static_cast<jboolean>(ObjectStore::is_empty(shared_realm->read_group()));
@@ -174,6 +185,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsEmpty(JN
 
 JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeRefresh(JNIEnv* env, jclass, jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         shared_realm->refresh();
@@ -184,6 +196,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeRefresh(JNIEnv
 JNIEXPORT jlongArray JNICALL Java_io_realm_internal_OsSharedRealm_nativeGetVersionID(JNIEnv* env, jclass,
                                                                                    jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         util::Optional<DB::VersionID> opt_version_id = shared_realm->current_transaction_version();
@@ -212,6 +225,7 @@ JNIEXPORT jlongArray JNICALL Java_io_realm_internal_OsSharedRealm_nativeGetVersi
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsClosed(JNIEnv*, jclass, jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     return static_cast<jboolean>(shared_realm->is_closed());
 }
@@ -220,6 +234,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsClosed(J
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeGetTableRef(JNIEnv* env, jclass, jlong shared_realm_ptr,
                                                                           jstring table_name)
 {
+    JNI_PROBE();
     try {
         JStringAccessor name(env, table_name); // throws
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
@@ -245,6 +260,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeCreateTable(J
                                                                              jlong shared_realm_ptr,
                                                                              jstring j_table_name)
 {
+    JNI_PROBE();
     std::string table_name;
     try {
         table_name = JStringAccessor(env, j_table_name); // throws
@@ -278,6 +294,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeCreateTableWi
     JNIEnv* env, jclass, jlong shared_realm_ptr, jstring j_table_name, jstring j_field_name, jint j_field_type,
     jboolean is_nullable)
 {
+    JNI_PROBE();
     std::string class_name_str;
     try {
         std::string table_name(JStringAccessor(env, j_table_name));
@@ -315,6 +332,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeCreateTableWi
 JNIEXPORT jobjectArray JNICALL Java_io_realm_internal_OsSharedRealm_nativeGetTablesName(JNIEnv* env, jclass,
                                                                                         jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
 
     auto& group = shared_realm->read_group();
@@ -343,6 +361,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeHasTable(J
                                                                              jlong shared_realm_ptr,
                                                                              jstring table_name)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         JStringAccessor name(env, table_name);
@@ -357,6 +376,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeRenameTable(JN
                                                                             jstring old_table_name,
                                                                             jstring new_table_name)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         JStringAccessor old_name(env, old_table_name);
@@ -374,6 +394,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeRenameTable(JN
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeSize(JNIEnv* env, jclass, jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         return static_cast<jlong>(shared_realm->read_group().size());
@@ -386,6 +407,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeSize(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeWriteCopy(JNIEnv* env, jclass, jlong shared_realm_ptr,
                                                                           jstring path, jbyteArray key)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         JStringAccessor path_str(env, path);
@@ -398,6 +420,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeWriteCopy(JNIE
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeWaitForChange(JNIEnv* env, jclass,
                                                                                   jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         return static_cast<jboolean>(shared_realm->wait_for_change());
@@ -410,6 +433,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeWaitForCha
 JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeStopWaitForChange(JNIEnv* env, jclass,
                                                                                   jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         shared_realm->wait_for_change_release();
@@ -420,6 +444,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeStopWaitForCha
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeCompact(JNIEnv* env, jclass,
                                                                             jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     try {
         return static_cast<jboolean>(shared_realm->compact());
@@ -436,6 +461,7 @@ static void finalize_shared_realm(jlong ptr)
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_shared_realm);
 }
 
@@ -443,6 +469,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeSetAutoRefresh
                                                                                jlong shared_realm_ptr,
                                                                                jboolean enabled)
 {
+    JNI_PROBE();
     try {
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         shared_realm->set_auto_refresh(to_bool(enabled));
@@ -453,6 +480,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeSetAutoRefresh
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsAutoRefresh(JNIEnv* env, jclass,
                                                                                   jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     try {
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         return to_jbool(shared_realm->auto_refresh());
@@ -464,6 +492,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsAutoRefr
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeGetSchemaInfo(JNIEnv*, jclass,
                                                                                jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     // No throws
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     return reinterpret_cast<jlong>(&shared_realm->schema());
@@ -472,6 +501,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeGetSchemaInfo
 JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeRegisterSchemaChangedCallback(
     JNIEnv* env, jclass, jlong shared_realm_ptr, jobject j_schema_changed_callback)
 {
+    JNI_PROBE();
     // No throws
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     JavaGlobalWeakRef callback_weak_ref(env, j_schema_changed_callback);
@@ -484,6 +514,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_OsSharedRealm_nativeRegisterSchema
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsPartial(JNIEnv*, jclass, jlong /*shared_realm_ptr*/)
 {
+    JNI_PROBE();
     // No throws
     // auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
     return to_jbool(false);
@@ -491,6 +522,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsPartial(
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsFrozen(JNIEnv* env, jclass, jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     try {
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         return to_jbool(shared_realm->is_frozen());
@@ -501,6 +533,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_OsSharedRealm_nativeIsFrozen(J
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeFreeze(JNIEnv* env, jclass, jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     try {
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         return reinterpret_cast<jlong>(new SharedRealm(shared_realm->freeze()));
@@ -511,6 +544,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeFreeze(JNIEnv
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_OsSharedRealm_nativeNumberOfVersions(JNIEnv* env, jclass, jlong shared_realm_ptr)
 {
+    JNI_PROBE();
     try {
         auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         return to_jlong_or_not_found(shared_realm->get_number_of_versions());
@@ -46,6 +46,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Property_nativeCreatePersistedPro
                                                                                       jboolean is_primary,
                                                                                       jboolean is_indexed)
 {
+    JNI_PROBE();
     try {
         JStringAccessor str(env, j_name_str);
         PropertyType p_type = static_cast<PropertyType>(static_cast<int>(type));
@@ -70,6 +71,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Property_nativeCreatePersistedLin
                                                                                           jint type,
                                                                                           jstring j_target_class_name)
 {
+    JNI_PROBE();
     try {
         JStringAccessor name(env, j_name_str);
         JStringAccessor link_name(env, j_target_class_name);
@@ -85,6 +87,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Property_nativeCreateComputedLink
                                                                                          jstring j_source_class_name,
                                                                                          jstring j_source_field_name)
 {
+    JNI_PROBE();
     try {
         JStringAccessor name(env, j_name_str);
         JStringAccessor target_class_name(env, j_source_class_name);
@@ -99,17 +102,20 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Property_nativeCreateComputedLink
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Property_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_property);
 }
 
 JNIEXPORT jint JNICALL Java_io_realm_internal_Property_nativeGetType(JNIEnv*, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     auto& property = *reinterpret_cast<Property*>(native_ptr);
     return static_cast<jint>(property.type);
 }
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Property_nativeGetColumnKey(JNIEnv*, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     auto& property = *reinterpret_cast<Property*>(native_ptr);
     return static_cast<jlong>(property.column_key.value);
 }
@@ -117,6 +123,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Property_nativeGetColumnKey(JNIEn
 JNIEXPORT jstring JNICALL Java_io_realm_internal_Property_nativeGetLinkedObjectName(JNIEnv* env, jclass,
                                                                                     jlong native_ptr)
 {
+    JNI_PROBE();
     try {
         auto& property = *reinterpret_cast<Property*>(native_ptr);
         std::string name = property.object_type;
@@ -24,6 +24,8 @@
 #include "java_exception_def.hpp"
 #include "shared_realm.hpp"
 #include "jni_util/java_exception_thrower.hpp"
+#include "jni_util/java_local_frame.hpp"
+#include "jni_util/native_object_counter.hpp"
 
 #include <realm/util/to_string.hpp>
 
@@ -61,6 +63,7 @@ inline static bool is_allowed_to_index(JNIEnv* env, DataType column_type)
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeAddColumn(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                      jint colType, jstring name, jboolean isNullable)
 {
+    JNI_PROBE();
     try {
         JStringAccessor name2(env, name); // throws
         bool is_column_nullable = to_bool(isNullable);
@@ -80,6 +83,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeAddPrimitiveListColum
                                                                                   jlong native_table_ptr, jint j_col_type,
                                                                                   jstring j_name, jboolean j_is_nullable)
 {
+    JNI_PROBE();
     try {
         JStringAccessor name(env, j_name); // throws
         bool is_column_nullable = to_bool(j_is_nullable);
@@ -95,6 +99,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeAddColumnLink(JNIEnv*
                                                                          jint colType, jstring name,
                                                                          jlong targetTableRefPtr)
 {
+    JNI_PROBE();
     TableRef targetTableRef = TBL_REF(targetTableRefPtr);
     if (!targetTableRef->is_group_level()) {
         ThrowException(env, UnsupportedOperation, "Links can only be made to toplevel tables.");
@@ -113,6 +118,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeAddColumnLink(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeRemoveColumn(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                        jlong columnKey)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(nativeTableRefPtr);
         table->remove_column(ColKey(columnKey));
@@ -123,6 +129,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeRemoveColumn(JNIEnv* e
 JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeRenameColumn(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                        jlong columnKey, jstring name)
 {
+    JNI_PROBE();
     try {
         JStringAccessor name2(env, name); // throws
         TableRef table = TBL_REF(nativeTableRefPtr);
@@ -135,6 +142,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeIsColumnNullable(J
                                                                                jlong nativeTableRefPtr,
                                                                                jlong columnKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     return to_jbool(table->is_nullable(ColKey(columnKey))); // noexcept
 }
@@ -144,6 +152,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeConvertColumnToNullabl
                                                                                   jlong j_column_key,
                                                                                   jboolean is_primary_key)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(native_table_ref_ptr);
         ColKey col_key(j_column_key);
@@ -163,6 +172,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeConvertColumnToNotNull
                                                                                      jlong j_column_key,
                                                                                      jboolean is_primary_key)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(native_table_ref_ptr);
         ColKey col_key(j_column_key);
@@ -178,12 +188,14 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeConvertColumnToNotNull
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeSize(JNIEnv*, jobject, jlong nativeTableRefPtr)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     return static_cast<jlong>(table->size()); // noexcept
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeClear(JNIEnv* env, jobject, jlong nativeTableRefPtr)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(nativeTableRefPtr);
         table->clear();
@@ -197,6 +209,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeClear(JNIEnv* env, job
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetColumnCount(JNIEnv*, jobject, jlong nativeTableRefPtr)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     return static_cast<jlong>(table->get_column_count()); // noexcept
 }
@@ -204,6 +217,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetColumnCount(JNIEnv
 JNIEXPORT jstring JNICALL Java_io_realm_internal_Table_nativeGetColumnName(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                            jlong columnKey)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(nativeTableRefPtr);
         ColKey col_key(columnKey);
@@ -216,6 +230,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_Table_nativeGetColumnName(JNIEn
 
 JNIEXPORT jobjectArray JNICALL Java_io_realm_internal_Table_nativeGetColumnNames(JNIEnv* env, jobject, jlong nativeTableRefPtr)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(nativeTableRefPtr);
         ColKeys col_keys = table->get_column_keys();
@@ -225,8 +240,10 @@ JNIEXPORT jobjectArray JNICALL Java_io_realm_internal_Table_nativeGetColumnNames
             ThrowException(env, OutOfMemory, "Could not allocate memory to return column names.");
             return NULL;
         }
+        JavaLocalFrame frame(env);
         for (size_t i = 0; i < size; ++i) {
             env->SetObjectArrayElement(col_keys_array, i, to_jstring(env,  table->get_column_name(col_keys[i])));
+            frame.step();
         }
 
         return col_keys_array;
@@ -238,6 +255,7 @@ JNIEXPORT jobjectArray JNICALL Java_io_realm_internal_Table_nativeGetColumnNames
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetColumnKey(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                           jstring columnName)
 {
+    JNI_PROBE();
     try {
         JStringAccessor columnName2(env, columnName);                                     // throws
         TableRef table = TBL_REF(nativeTableRefPtr);
@@ -254,6 +272,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetColumnKey(JNIEnv*
 JNIEXPORT jint JNICALL Java_io_realm_internal_Table_nativeGetColumnType(JNIEnv*, jobject, jlong nativeTableRefPtr,
                                                                         jlong columnKey)
 {
+    JNI_PROBE();
     ColKey column_key (columnKey);
     TableRef table = TBL_REF(nativeTableRefPtr);
     jint column_type = table->get_column_type(column_key);
@@ -274,6 +293,7 @@ JNIEXPORT jint JNICALL Java_io_realm_internal_Table_nativeGetColumnType(JNIEnv*,
 JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeMoveLastOver(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                        jlong rowKey)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(nativeTableRefPtr);
         table->remove_object(ObjKey(rowKey));
@@ -286,6 +306,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeMoveLastOver(JNIEnv* e
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetLong(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                    jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Int)) {
         return 0;
@@ -296,6 +317,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetLong(JNIEnv* env,
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeGetBoolean(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                          jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Bool)) {
         return JNI_FALSE;
@@ -307,6 +329,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeGetBoolean(JNIEnv*
 JNIEXPORT jfloat JNICALL Java_io_realm_internal_Table_nativeGetFloat(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                      jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Float)) {
         return 0;
@@ -318,6 +341,7 @@ JNIEXPORT jfloat JNICALL Java_io_realm_internal_Table_nativeGetFloat(JNIEnv* env
 JNIEXPORT jdouble JNICALL Java_io_realm_internal_Table_nativeGetDouble(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                        jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Double)) {
         return 0;
@@ -329,6 +353,7 @@ JNIEXPORT jdouble JNICALL Java_io_realm_internal_Table_nativeGetDouble(JNIEnv* e
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetTimestamp(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                         jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Timestamp)) {
         return 0;
@@ -343,6 +368,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetTimestamp(JNIEnv*
 JNIEXPORT jstring JNICALL Java_io_realm_internal_Table_nativeGetString(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                        jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_String)) {
         return nullptr;
@@ -357,6 +383,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_Table_nativeGetString(JNIEnv* e
 JNIEXPORT jlongArray JNICALL Java_io_realm_internal_Table_nativeGetDecimal128(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                        jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Decimal)) {
         return nullptr;
@@ -372,6 +399,7 @@ JNIEXPORT jlongArray JNICALL Java_io_realm_internal_Table_nativeGetDecimal128(JN
 JNIEXPORT jstring JNICALL Java_io_realm_internal_Table_nativeGetObjectId(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                        jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_ObjectId)) {
         return nullptr;
@@ -387,6 +415,7 @@ JNIEXPORT jbyteArray JNICALL Java_io_realm_internal_Table_nativeGetByteArray(JNI
                                                                              jlong nativeTableRefPtr, jlong columnKey,
                                                                              jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Binary)) {
         return nullptr;
@@ -402,6 +431,7 @@ JNIEXPORT jbyteArray JNICALL Java_io_realm_internal_Table_nativeGetByteArray(JNI
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetLink(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                    jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Link)) {
         return 0;
@@ -412,6 +442,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetLink(JNIEnv* env,
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetLinkTarget(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                          jlong columnKey)
 {
+    JNI_PROBE();
     try {
         TableRef table_ref = TBL_REF(nativeTableRefPtr);
         return reinterpret_cast<jlong>(new TableRef(table_ref->get_link_target(ColKey(columnKey))));
@@ -423,6 +454,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetLinkTarget(JNIEnv*
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeIsNull(JNIEnv*, jobject, jlong nativeTableRefPtr,
                                                                      jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     return to_jbool(table->get_object(ObjKey(rowKey)).is_null(ColKey(columnKey))); // noexcept
 }
@@ -433,6 +465,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetLink(JNIEnv* env, j
                                                                   jlong columnKey, jlong rowKey,
                                                                   jlong targetRowKey, jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Link)) {
         return;
@@ -447,6 +480,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetLong(JNIEnv* env, j
                                                                   jlong columnKey, jlong rowKey, jlong value,
                                                                   jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Int)) {
         return;
@@ -460,6 +494,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetLong(JNIEnv* env, j
 JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeIncrementLong(JNIEnv* env, jclass, jlong nativeTableRefPtr,
                                                                   jlong columnKey, jlong rowKey, jlong value)
 {
+    JNI_PROBE();
 
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Int)) {
@@ -482,6 +517,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetBoolean(JNIEnv* env
                                                                      jlong columnKey, jlong rowKey,
                                                                      jboolean value, jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Bool)) {
         return;
@@ -496,6 +532,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetFloat(JNIEnv* env,
                                                                    jlong columnKey, jlong rowKey, jfloat value,
                                                                    jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Float)) {
         return;
@@ -510,6 +547,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetDouble(JNIEnv* env,
                                                                     jlong columnKey, jlong rowKey, jdouble value,
                                                                     jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Double)) {
         return;
@@ -524,6 +562,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetString(JNIEnv* env,
                                                                     jlong columnKey, jlong rowKey, jstring value,
                                                                     jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_String)) {
         return;
@@ -544,6 +583,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetTimestamp(JNIEnv* e
                                                                        jlong columnKey, jlong rowKey,
                                                                        jlong timestampValue, jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Timestamp)) {
         return;
@@ -558,6 +598,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetByteArray(JNIEnv* e
                                                                        jlong columnKey, jlong rowKey,
                                                                        jbyteArray dataArray, jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Binary)) {
         return;
@@ -567,7 +608,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetByteArray(JNIEnv* e
             return;
         }
 
-        JByteArrayAccessor jarray_accessor(env, dataArray);
+        JByteArrayCriticalAccessor jarray_accessor(env, dataArray);
         table->get_object(ObjKey(rowKey)).set(ColKey(columnKey), jarray_accessor.transform<BinaryData>(), B(isDefault));
     }
     CATCH_STD()
@@ -577,6 +618,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetDecimal128(JNIEnv*
                                                                     jlong columnKey, jlong rowKey, jlong low,
                                                                     jlong high, jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Decimal)) {
         return;
@@ -592,6 +634,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetObjectId(JNIEnv* en
                                                                     jlong columnKey, jlong rowKey, jstring j_value,
                                                                     jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_ObjectId)) {
         return;
@@ -608,6 +651,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetNull(JNIEnv* env, j
                                                                   jlong columnKey, jlong rowKey,
                                                                   jboolean isDefault)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!COL_NULLABLE(env, table, columnKey)) {
         return;
@@ -622,9 +666,10 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeSetNull(JNIEnv* env, j
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetRowPtr(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                      jlong key)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(nativeTableRefPtr);
-        Obj* obj = new Obj(table->get_object(ObjKey(key)));
+        Obj* obj = NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(table->get_object(ObjKey(key))));
         return reinterpret_cast<jlong>(obj);
     }
     CATCH_STD()
@@ -636,6 +681,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetRowPtr(JNIEnv* env
 JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeAddSearchIndex(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                          jlong columnKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     ColKey colKey(columnKey);
     DataType column_type = table->get_column_type(colKey);
@@ -652,6 +698,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeAddSearchIndex(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeRemoveSearchIndex(JNIEnv* env, jobject,
                                                                             jlong nativeTableRefPtr, jlong columnKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     DataType column_type = table->get_column_type(ColKey(columnKey));
     if (!is_allowed_to_index(env, column_type)) {
@@ -667,6 +714,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeRemoveSearchIndex(JNIE
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeHasSearchIndex(JNIEnv* env, jobject,
                                                                              jlong nativeTableRefPtr, jlong columnKey)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(nativeTableRefPtr);
         return to_jbool(table->has_search_index(ColKey(columnKey)));
@@ -678,6 +726,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeHasSearchIndex(JNI
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeIsNullLink(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                          jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Link)) {
         return JNI_FALSE;
@@ -689,6 +738,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeIsNullLink(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeNullifyLink(JNIEnv* env, jclass, jlong nativeTableRefPtr,
                                                                       jlong columnKey, jlong rowKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Link)) {
         return;
@@ -704,6 +754,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_Table_nativeNullifyLink(JNIEnv* en
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeCountLong(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                      jlong columnKey, jlong value)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Int)) {
         return 0;
@@ -718,6 +769,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeCountLong(JNIEnv* env
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeCountFloat(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                       jlong columnKey, jfloat value)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Float)) {
         return 0;
@@ -732,6 +784,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeCountFloat(JNIEnv* en
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeCountDouble(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                        jlong columnKey, jdouble value)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Double)) {
         return 0;
@@ -746,6 +799,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeCountDouble(JNIEnv* e
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeCountString(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                        jlong columnKey, jstring value)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_String)) {
         return 0;
@@ -761,9 +815,10 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeCountString(JNIEnv* e
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeWhere(JNIEnv* env, jobject, jlong nativeTableRefPtr)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(nativeTableRefPtr);
-        Query* queryPtr = new Query(table->where());
+        Query* queryPtr = NativeObjectCounter::created(NativeObjectCounter::query, new Query(table->where()));
         return reinterpret_cast<jlong>(queryPtr);
     }
     CATCH_STD()
@@ -775,6 +830,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeWhere(JNIEnv* env, jo
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstInt(JNIEnv* env, jclass, jlong nativeTableRefPtr,
                                                                         jlong columnKey, jlong value)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Int)) {
         return -1;
@@ -789,6 +845,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstInt(JNIEnv*
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstBool(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                          jlong columnKey, jboolean value)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Bool)) {
         return -1;
@@ -803,6 +860,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstBool(JNIEnv*
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstFloat(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                           jlong columnKey, jfloat value)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Float)) {
         return -1;
@@ -817,6 +875,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstFloat(JNIEnv
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstDouble(JNIEnv* env, jobject, jlong nativeTableRefPtr,
                                                                            jlong columnKey, jdouble value)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Double)) {
         return -1;
@@ -832,6 +891,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstTimestamp(JN
                                                                               jlong nativeTableRefPtr, jlong columnKey,
                                                                               jlong dateTimeValue)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Timestamp)) {
         return -1;
@@ -846,6 +906,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstTimestamp(JN
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstString(JNIEnv* env, jclass, jlong nativeTableRefPtr,
                                                                            jlong columnKey, jstring value)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_String)) {
         return -1;
@@ -862,6 +923,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstString(JNIEn
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstDecimal128(JNIEnv* env, jclass, jlong nativeTableRefPtr,
                                                                              jlong columnKey, jlong low, jlong high)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_Decimal)) {
         return -1;
@@ -878,6 +940,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstDecimal128(J
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstObjectId(JNIEnv* env, jclass, jlong nativeTableRefPtr,
                                                                            jlong columnKey, jstring j_value)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!TYPE_VALID(env, table, columnKey, type_ObjectId)) {
         return -1;
@@ -896,6 +959,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstObjectId(JNI
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstNull(JNIEnv* env, jclass, jlong nativeTableRefPtr,
                                                                          jlong columnKey)
 {
+    JNI_PROBE();
     TableRef table = TBL_REF(nativeTableRefPtr);
     if (!COL_NULLABLE(env, table, columnKey)) {
         return static_cast<jlong>(realm::not_found);
@@ -913,6 +977,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFindFirstNull(JNIEnv*
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_Table_nativeGetName(JNIEnv* env, jobject, jlong nativeTableRefPtr)
 {
+    JNI_PROBE();
     try {
         TableRef table = TBL_REF(nativeTableRefPtr);
         // Mirror API in Java for now. Before Core 6 this would return null for tables not attached to the group.
@@ -928,6 +993,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_Table_nativeGetName(JNIEnv* env
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeIsValid(JNIEnv*, jobject, jlong nativeTableRefPtr)
 {
+    JNI_PROBE();
     if(TBL_REF(nativeTableRefPtr)) {
         return JNI_TRUE;
     } else {
@@ -938,6 +1004,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeIsValid(JNIEnv*, j
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeHasSameSchema(JNIEnv*, jobject, jlong thisTableRefPtr,
                                                                             jlong otherTableRefPtr)
 {
+    JNI_PROBE();
     TableRef this_table = TBL_REF(thisTableRefPtr);
     TableRef other_table = TBL_REF(otherTableRefPtr);
     return to_jbool(this_table->get_key() == other_table->get_key());
@@ -950,11 +1017,13 @@ static void finalize_table(jlong ptr)
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_table);
 }
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFreeze(JNIEnv*, jclass, jlong j_frozen_shared_realm_ptr, jlong j_table_ptr)
 {
+    JNI_PROBE();
     auto& shared_realm = *(reinterpret_cast<SharedRealm*>(j_frozen_shared_realm_ptr));
     TableRef table = TableRef(TBL_REF(j_table_ptr));
     TableRef* frozen_table = new TableRef(shared_realm->import_copy_of(table));
@@ -963,6 +1032,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_Table_nativeFreeze(JNIEnv*, jclas
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeIsEmbedded(JNIEnv* env, jclass, jlong j_table_ptr)
 {
+    JNI_PROBE();
     try {
         TableRef table = TableRef(TBL_REF(j_table_ptr));
         return to_jbool(table->is_embedded());
@@ -973,6 +1043,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeIsEmbedded(JNIEnv*
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_Table_nativeSetEmbedded(JNIEnv* env, jclass, jlong j_table_ptr, jboolean j_embedded)
 {
+    JNI_PROBE();
     try {
         TableRef table = TableRef(TBL_REF(j_table_ptr));
         return to_jbool(table->set_embedded(to_bool(j_embedded)));
@@ -24,8 +24,12 @@
 #include <object_store.hpp>
 #include <results.hpp>
 
+#include "index_advisor.hpp"
 #include "java_accessor.hpp"
 #include "java_class_global_def.hpp"
+#include "jni_util/java_class.hpp"
+#include "jni_util/java_method.hpp"
+#include "jni_util/native_object_counter.hpp"
 #include "util.hpp"
 
 using namespace realm;
@@ -40,6 +44,7 @@ static void finalize_table_query(jlong ptr);
 JNIEXPORT jstring JNICALL Java_io_realm_internal_TableQuery_nativeValidateQuery(JNIEnv* env, jobject,
                                                                                 jlong nativeQueryPtr)
 {
+    JNI_PROBE();
     try {
         const std::string str = Q(nativeQueryPtr)->validate();
         StringData sd(str);
@@ -92,6 +97,12 @@ static ConstTableRef getTableByArray(jlong nativeQueryPtr, const JLongArrayAcces
     return table_ref;
 }
 
+// Reports a predicate on a column of the queried table to the IndexAdvisor.
+static inline void record_predicate(jlong nativeQueryPtr, jlong column_key, IndexAdvisor::Predicate predicate)
+{
+    IndexAdvisor::shared().on_predicate(*Q(nativeQueryPtr), ColKey(column_key), predicate);
+}
+
 // I am not at all sure that it is even the right idea, let alone correct code. --gbm
 static bool isNullable(JNIEnv* env, ConstTableRef* src_table_ptr, ConstTableRef table_ref, jlong column_key)
 {
@@ -147,6 +158,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqual__J_3J_3JJ(J
                                                                             jlongArray columnKeys,
                                                                             jlongArray tablePointers, jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -156,6 +168,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqual__J_3J_3JJ(J
                 return;
             }
             Q(nativeQueryPtr)->equal(ColKey(col_key_arr[0]), static_cast<int64_t>(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::equal);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -171,6 +184,7 @@ JNIEXPORT void JNICALL JNICALL Java_io_realm_internal_TableQuery_nativeNotEqual_
                                                                                        jlongArray tablePointers,
                                                                                        jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -195,6 +209,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreater__J_3J_3JJ
                                                                               jlongArray columnKeys,
                                                                               jlongArray tablePointers, jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -204,6 +219,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreater__J_3J_3JJ
                 return;
             }
             Q(nativeQueryPtr)->greater(ColKey(col_key_arr[0]), static_cast<int64_t>(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -220,6 +236,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterEqual__J_3
                                                                                    jlongArray tablePointers,
                                                                                    jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -229,6 +246,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterEqual__J_3
                 return;
             }
             Q(nativeQueryPtr)->greater_equal(ColKey(col_key_arr[0]), static_cast<int64_t>(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -243,6 +261,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLess__J_3J_3JJ(JN
                                                                            jlongArray columnKeys,
                                                                            jlongArray tablePointers, jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -252,6 +271,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLess__J_3J_3JJ(JN
                 return;
             }
             Q(nativeQueryPtr)->less(ColKey(col_key_arr[0]), static_cast<int64_t>(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -266,6 +286,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessEqual__J_3J_3
                                                                                 jlongArray columnKeys,
                                                                                 jlongArray tablePointers, jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -275,6 +296,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessEqual__J_3J_3
                 return;
             }
             Q(nativeQueryPtr)->less_equal(ColKey(col_key_arr[0]), static_cast<int64_t>(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -290,6 +312,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeBetween__J_3JJJ(J
                                                                                jlongArray columnKeys, jlong value1,
                                                                                jlong value2)
 {
+    JNI_PROBE();
     JLongArrayAccessor arr(env, columnKeys);
     jsize arr_len = arr.size();
     try {
@@ -300,6 +323,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeBetween__J_3JJJ(J
             try {
                 Q(nativeQueryPtr)
                     ->between(ColKey(arr[0]), static_cast<int64_t>(value1), static_cast<int64_t>(value2));
+                record_predicate(nativeQueryPtr, arr[0], IndexAdvisor::Predicate::range);
             }
             CATCH_STD()
         }
@@ -316,6 +340,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqual__J_3J_3JF(J
                                                                             jlongArray columnKeys,
                                                                             jlongArray tablePointers, jfloat value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -341,6 +366,7 @@ JNIEXPORT void JNICALL JNICALL Java_io_realm_internal_TableQuery_nativeNotEqual_
                                                                                        jlongArray tablePointers,
                                                                                        jfloat value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -365,6 +391,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreater__J_3J_3JF
                                                                               jlongArray columnKeys,
                                                                               jlongArray tablePointers, jfloat value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -390,6 +417,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterEqual__J_3
                                                                                    jlongArray tablePointers,
                                                                                    jfloat value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -413,6 +441,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLess__J_3J_3JF(JN
                                                                            jlongArray columnKeys,
                                                                            jlongArray tablePointers, jfloat value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -437,6 +466,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessEqual__J_3J_3
                                                                                 jlongArray tablePointers,
                                                                                 jfloat value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -461,6 +491,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeBetween__J_3JFF(J
                                                                                jlongArray columnKeys,
                                                                                jfloat value1, jfloat value2)
 {
+    JNI_PROBE();
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
     try {
@@ -484,6 +515,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqual__J_3J_3JD(J
                                                                             jlongArray columnKeys,
                                                                             jlongArray tablePointers, jdouble value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -509,6 +541,7 @@ JNIEXPORT void JNICALL JNICALL Java_io_realm_internal_TableQuery_nativeNotEqual_
                                                                                        jlongArray tablePointers,
                                                                                        jdouble value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -533,6 +566,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreater__J_3J_3JD
                                                                               jlongArray columnKeys,
                                                                               jlongArray tablePointers, jdouble value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -558,6 +592,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterEqual__J_3
                                                                                    jlongArray tablePointers,
                                                                                    jdouble value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -581,6 +616,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLess__J_3J_3JD(JN
                                                                            jlongArray columnKeys,
                                                                            jlongArray tablePointers, jdouble value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -606,6 +642,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessEqual__J_3J_3
                                                                                 jlongArray tablePointers,
                                                                                 jdouble value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -630,6 +667,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeBetween__J_3JDD(J
                                                                                jlongArray columnKeys,
                                                                                jdouble value1, jdouble value2)
 {
+    JNI_PROBE();
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
     try {
@@ -653,6 +691,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqualTimestamp(JN
                                                                               jlongArray columnKeys,
                                                                               jlongArray tablePointers, jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -662,6 +701,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqualTimestamp(JN
                 return;
             }
             Q(nativeQueryPtr)->equal(ColKey(col_key_arr[0]), from_milliseconds(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::equal);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -679,6 +719,7 @@ JNIEXPORT void JNICALL JNICALL Java_io_realm_internal_TableQuery_nativeNotEqualT
                                                                                          jlongArray tablePointers,
                                                                                          jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -704,6 +745,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterTimestamp(
                                                                                 jlongArray columnKeys,
                                                                                 jlongArray tablePointers, jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -713,6 +755,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterTimestamp(
                 return;
             }
             Q(nativeQueryPtr)->greater(ColKey(col_key_arr[0]), from_milliseconds(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -730,6 +773,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterEqualTimes
                                                                                      jlongArray tablePointers,
                                                                                      jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -739,6 +783,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterEqualTimes
                 return;
             }
             Q(nativeQueryPtr)->greater_equal(ColKey(col_key_arr[0]), from_milliseconds(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -755,6 +800,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessTimestamp(JNI
                                                                              jlongArray columnKeys,
                                                                              jlongArray tablePointers, jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -764,6 +810,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessTimestamp(JNI
                 return;
             }
             Q(nativeQueryPtr)->less(ColKey(col_key_arr[0]), from_milliseconds(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -781,6 +828,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessEqualTimestam
                                                                                   jlongArray tablePointers,
                                                                                   jlong value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -790,6 +838,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessEqualTimestam
                 return;
             }
             Q(nativeQueryPtr)->less_equal(ColKey(col_key_arr[0]), from_milliseconds(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -806,6 +855,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeBetweenTimestamp(
                                                                                 jlongArray columnKeys,
                                                                                 jlong value1, jlong value2)
 {
+    JNI_PROBE();
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
     try {
@@ -816,6 +866,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeBetweenTimestamp(
             Q(nativeQueryPtr)
                     ->greater_equal(ColKey(col_key_arr[0]), from_milliseconds(value1))
                     .less_equal(ColKey(col_key_arr[0]), from_milliseconds(value2));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
         }
         else {
             ThrowException(env, IllegalArgument, "between() does not support queries using child object fields.");
@@ -832,6 +883,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeBetweenDecimal128
                                                                                  jlong value1Low, jlong value1High,
                                                                                  jlong value2Low, jlong value2High)
 {
+    JNI_PROBE();
     Decimal128::Bid128 raw1 = {static_cast<uint64_t>(value1Low), static_cast<uint64_t>(value1High)};
     Decimal128::Bid128 raw2 = {static_cast<uint64_t>(value2Low), static_cast<uint64_t>(value2High)};
     Decimal128 value1 = Decimal128(raw1);
@@ -859,6 +911,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqual__J_3J_3JZ(J
                                                                             jlongArray columnKeys,
                                                                             jlongArray tablePointers, jboolean value)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -868,6 +921,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqual__J_3J_3JZ(J
                 return;
             }
             Q(nativeQueryPtr)->equal(ColKey(col_key_arr[0]), to_bool(value));
+            record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::equal);
         }
         else {
             LinkChain linkChain = getTableForLinkQuery(nativeQueryPtr, table_arr, col_key_arr);
@@ -959,6 +1013,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterEqualDecim
                                                                                       jlong low,
                                                                                       jlong high)
 {
+    JNI_PROBE();
     TableQuery_Decimal128Predicate(env, nativeQueryPtr, columnKeys, tablePointers, low, high, Decimal128GreaterEqual);
 }
 
@@ -969,6 +1024,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterDecimal128
                                                                                  jlong low,
                                                                                  jlong high)
 {
+    JNI_PROBE();
     TableQuery_Decimal128Predicate(env, nativeQueryPtr, columnKeys, tablePointers, low, high, Decimal128Greater);
 }
 
@@ -979,6 +1035,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessEqualDecimal1
                                                                                    jlong low,
                                                                                    jlong high)
 {
+    JNI_PROBE();
     TableQuery_Decimal128Predicate(env, nativeQueryPtr, columnKeys, tablePointers, low, high, Decimal128LessEqual);
 }
 
@@ -989,6 +1046,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessDecimal128(JN
                                                                               jlong low,
                                                                               jlong high)
 {
+    JNI_PROBE();
     TableQuery_Decimal128Predicate(env, nativeQueryPtr, columnKeys, tablePointers, low, high, Decimal128Less);
 }
 
@@ -999,6 +1057,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeNotEqualDecimal12
                                                                                   jlong low,
                                                                                   jlong high)
 {
+    JNI_PROBE();
     TableQuery_Decimal128Predicate(env, nativeQueryPtr, columnKeys, tablePointers, low, high, Decimal128NotEqual);
 }
 
@@ -1009,6 +1068,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqualDecimal128(J
                                                                                jlong low,
                                                                                jlong high)
 {
+    JNI_PROBE();
     TableQuery_Decimal128Predicate(env, nativeQueryPtr, columnKeys, tablePointers, low, high, Decimal128Equal);
 }
 
@@ -1034,21 +1094,26 @@ static void TableQuery_ObjectIdPredicate(JNIEnv* env, jlong nativeQueryPtr, jlon
             switch (predicate) {
                 case ObjectIdEqual:
                     Q(nativeQueryPtr)->equal(ColKey(col_key_arr[0]), objectId);
+                    record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::equal);
                     break;
                 case ObjectIdNotEqual:
                     Q(nativeQueryPtr)->not_equal(ColKey(col_key_arr[0]), objectId);
                     break;
                 case ObjectIdLess:
                     Q(nativeQueryPtr)->less(ColKey(col_key_arr[0]), objectId);
+                    record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
                     break;
                 case ObjectIdLessEqual:
                     Q(nativeQueryPtr)->less_equal(ColKey(col_key_arr[0]), objectId);
+                    record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
                     break;
                 case ObjectIdGreater:
                     Q(nativeQueryPtr)->greater(ColKey(col_key_arr[0]), objectId);
+                    record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
                     break;
                 case ObjectIdGreaterEqual:
                     Q(nativeQueryPtr)->greater_equal(ColKey(col_key_arr[0]), objectId);
+                    record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::range);
                     break;
             }
         }
@@ -1093,6 +1158,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqualObjectId(JNI
                                                                              jlongArray tablePointers,
                                                                              jstring j_data)
 {
+    JNI_PROBE();
     TableQuery_ObjectIdPredicate(env, nativeQueryPtr, columnKeys, tablePointers, j_data, ObjectIdEqual);
 }
 
@@ -1102,6 +1168,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeNotEqualObjectId(
                                                                                 jlongArray tablePointers,
                                                                                 jstring data)
 {
+    JNI_PROBE();
     TableQuery_ObjectIdPredicate(env, nativeQueryPtr, columnKeys, tablePointers, data, ObjectIdNotEqual);
 }
 
@@ -1111,6 +1178,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessObjectId(JNIE
                                                                             jlongArray tablePointers,
                                                                             jstring data)
 {
+    JNI_PROBE();
     TableQuery_ObjectIdPredicate(env, nativeQueryPtr, columnKeys, tablePointers, data, ObjectIdLess);
 }
 
@@ -1120,6 +1188,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLessEqualObjectId
                                                                                  jlongArray tablePointers,
                                                                                  jstring data)
 {
+    JNI_PROBE();
     TableQuery_ObjectIdPredicate(env, nativeQueryPtr, columnKeys, tablePointers, data, ObjectIdLessEqual);
 }
 
@@ -1129,6 +1198,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterObjectId(J
                                                                                jlongArray tablePointers,
                                                                                jstring data)
 {
+    JNI_PROBE();
     TableQuery_ObjectIdPredicate(env, nativeQueryPtr, columnKeys, tablePointers, data, ObjectIdGreater);
 }
 
@@ -1138,6 +1208,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGreaterEqualObjec
                                                                                     jlongArray tablePointers,
                                                                                     jstring data)
 {
+    JNI_PROBE();
     TableQuery_ObjectIdPredicate(env, nativeQueryPtr, columnKeys, tablePointers, data, ObjectIdGreaterEqual);
 }
 
@@ -1169,6 +1240,7 @@ static void TableQuery_StringPredicate(JNIEnv* env, jlong nativeQueryPtr, jlongA
             switch (predicate) {
                 case StringEqual:{
                     Q(nativeQueryPtr)->equal(ColKey(col_key_arr[0]), value2, is_case_sensitive);
+                    record_predicate(nativeQueryPtr, col_key_arr[0], IndexAdvisor::Predicate::equal);
                     break;
                 }
                 case StringNotEqual:
@@ -1230,6 +1302,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqual__J_3J_3JLja
     JNIEnv* env, jobject, jlong nativeQueryPtr, jlongArray columnKeys,
     jlongArray tablePointers, jstring value, jboolean caseSensitive)
 {
+    JNI_PROBE();
     TableQuery_StringPredicate(env, nativeQueryPtr, columnKeys, tablePointers, value, caseSensitive, StringEqual);
 }
 
@@ -1237,6 +1310,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeNotEqual__J_3J_3J
     JNIEnv* env, jobject, jlong nativeQueryPtr, jlongArray columnKeys,
     jlongArray tablePointers, jstring value, jboolean caseSensitive)
 {
+    JNI_PROBE();
     TableQuery_StringPredicate(env, nativeQueryPtr, columnKeys, tablePointers, value, caseSensitive, StringNotEqual);
 }
 
@@ -1245,6 +1319,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeBeginsWith(JNIEnv
                                                                           jlongArray tablePointers, jstring value,
                                                                           jboolean caseSensitive)
 {
+    JNI_PROBE();
     TableQuery_StringPredicate(env, nativeQueryPtr, columnKeys, tablePointers, value, caseSensitive, StringBeginsWith);
 }
 
@@ -1253,6 +1328,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEndsWith(JNIEnv*
                                                                         jlongArray tablePointers, jstring value,
                                                                         jboolean caseSensitive)
 {
+    JNI_PROBE();
     TableQuery_StringPredicate(env, nativeQueryPtr, columnKeys, tablePointers, value, caseSensitive, StringEndsWith);
 }
 
@@ -1261,6 +1337,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeLike(JNIEnv* env,
                                                                     jlongArray tablePointers, jstring value,
                                                                     jboolean caseSensitive)
 {
+    JNI_PROBE();
     TableQuery_StringPredicate(env, nativeQueryPtr, columnKeys, tablePointers, value, caseSensitive, StringLike);
 }
 
@@ -1269,6 +1346,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeContains(JNIEnv*
                                                                         jlongArray tablePointers, jstring value,
                                                                         jboolean caseSensitive)
 {
+    JNI_PROBE();
     TableQuery_StringPredicate(env, nativeQueryPtr, columnKeys, tablePointers, value, caseSensitive, StringContains);
 }
 
@@ -1326,6 +1404,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEqual__J_3J_3J_3B
                                                                               jlongArray tablePointers,
                                                                               jbyteArray value)
 {
+    JNI_PROBE();
     TableQuery_BinaryPredicate(env, nativeQueryPtr, columnKeys, tablePointers, value, BinaryEqual);
 }
 
@@ -1335,6 +1414,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeNotEqual__J_3J_3J
                                                                                  jlongArray tablePointers,
                                                                                  jbyteArray value)
 {
+    JNI_PROBE();
     TableQuery_BinaryPredicate(env, nativeQueryPtr, columnKeys, tablePointers, value, BinaryNotEqual);
 }
 
@@ -1346,6 +1426,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeNotEqual__J_3J_3J
 
 JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGroup(JNIEnv* env, jobject, jlong nativeQueryPtr)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     try {
         pQuery->group();
@@ -1355,6 +1436,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeGroup(JNIEnv* env
 
 JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEndGroup(JNIEnv* env, jobject, jlong nativeQueryPtr)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     try {
         pQuery->end_group();
@@ -1364,16 +1446,19 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeEndGroup(JNIEnv*
 
 JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeOr(JNIEnv* env, jobject, jlong nativeQueryPtr)
 {
+    JNI_PROBE();
     // No verification of parameters needed?
     Query* pQuery = Q(nativeQueryPtr);
     try {
         pQuery->Or();
+        IndexAdvisor::shared().on_or(*pQuery);
     }
     CATCH_STD()
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeNot(JNIEnv* env, jobject, jlong nativeQueryPtr)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     try {
         pQuery->Not();
@@ -1385,6 +1470,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeNot(JNIEnv* env,
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeFind(JNIEnv* env, jobject, jlong nativeQueryPtr)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     try {
         auto r = pQuery->find();
@@ -1394,11 +1480,20 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeFind(JNIEnv* env
     return -1;
 }
 
+// Minimum and maximum return the primitive value and report whether a value was found through the caller provided
+// j_found array. This avoids boxing the result into a new Java object through JNI on every call.
+static inline void set_aggregate_found(JNIEnv* env, jbooleanArray j_found, bool found)
+{
+    jboolean value = to_jbool(found);
+    env->SetBooleanArrayRegion(j_found, 0, 1, &value);
+}
+
 // Integer Aggregates
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeSumInt(JNIEnv* env, jobject, jlong nativeQueryPtr,
                                                                        jlong columnKey)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Int)) {
@@ -1411,48 +1506,56 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeSumInt(JNIEnv* e
     return 0;
 }
 
-JNIEXPORT jobject JNICALL Java_io_realm_internal_TableQuery_nativeMaximumInt(JNIEnv* env, jobject,
-                                                                             jlong nativeQueryPtr, jlong columnKey)
+JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeMaximumInt(JNIEnv* env, jobject,
+                                                                           jlong nativeQueryPtr, jlong columnKey,
+                                                                           jbooleanArray j_found)
 {
+    JNI_PROBE();
+    set_aggregate_found(env, j_found, false);
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Int)) {
-        return nullptr;
+        return 0;
     }
     try {
         ObjKey return_ndx;
         int64_t result = pQuery->maximum_int(ColKey(columnKey), &return_ndx);
         if (bool(return_ndx)) {
-            return JavaClassGlobalDef::new_long(env, result);
+            set_aggregate_found(env, j_found, true);
+            return static_cast<jlong>(result);
         }
-        return 0;
     }
     CATCH_STD()
-    return nullptr;
+    return 0;
 }
 
-JNIEXPORT jobject JNICALL Java_io_realm_internal_TableQuery_nativeMinimumInt(JNIEnv* env, jobject,
-                                                                             jlong nativeQueryPtr, jlong columnKey)
+JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeMinimumInt(JNIEnv* env, jobject,
+                                                                           jlong nativeQueryPtr, jlong columnKey,
+                                                                           jbooleanArray j_found)
 {
+    JNI_PROBE();
+    set_aggregate_found(env, j_found, false);
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Int)) {
-        return nullptr;
+        return 0;
     }
     try {
         ObjKey return_ndx;
         int64_t result = pQuery->minimum_int(ColKey(columnKey), &return_ndx);
         if (bool(return_ndx)) {
-            return JavaClassGlobalDef::new_long(env, result);
+            set_aggregate_found(env, j_found, true);
+            return static_cast<jlong>(result);
         }
     }
     CATCH_STD()
-    return nullptr;
+    return 0;
 }
 
 JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeAverageInt(JNIEnv* env, jobject,
                                                                              jlong nativeQueryPtr, jlong columnKey)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Int)) {
@@ -1472,6 +1575,7 @@ JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeAverageInt(JNI
 JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeSumFloat(JNIEnv* env, jobject, jlong nativeQueryPtr,
                                                                            jlong columnKey)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Float)) {
@@ -1484,50 +1588,57 @@ JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeSumFloat(JNIEn
     return 0;
 }
 
-JNIEXPORT jobject JNICALL Java_io_realm_internal_TableQuery_nativeMaximumFloat(JNIEnv* env, jobject,
-                                                                               jlong nativeQueryPtr,
-                                                                               jlong columnKey)
+JNIEXPORT jfloat JNICALL Java_io_realm_internal_TableQuery_nativeMaximumFloat(JNIEnv* env, jobject,
+                                                                              jlong nativeQueryPtr, jlong columnKey,
+                                                                              jbooleanArray j_found)
 {
+    JNI_PROBE();
+    set_aggregate_found(env, j_found, false);
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Float)) {
-        return nullptr;
+        return 0;
     }
     try {
         ObjKey return_ndx;
         float result = pQuery->maximum_float(ColKey(columnKey), &return_ndx);
         if (bool(return_ndx)) {
-            return JavaClassGlobalDef::new_float(env, result);
+            set_aggregate_found(env, j_found, true);
+            return static_cast<jfloat>(result);
         }
     }
     CATCH_STD()
-    return nullptr;
+    return 0;
 }
 
-JNIEXPORT jobject JNICALL Java_io_realm_internal_TableQuery_nativeMinimumFloat(JNIEnv* env, jobject,
-                                                                               jlong nativeQueryPtr,
-                                                                               jlong columnKey)
+JNIEXPORT jfloat JNICALL Java_io_realm_internal_TableQuery_nativeMinimumFloat(JNIEnv* env, jobject,
+                                                                              jlong nativeQueryPtr, jlong columnKey,
+                                                                              jbooleanArray j_found)
 {
+    JNI_PROBE();
+    set_aggregate_found(env, j_found, false);
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Float)) {
-        return nullptr;
+        return 0;
     }
     try {
         ObjKey return_ndx;
         float result = pQuery->minimum_float(ColKey(columnKey), &return_ndx);
         if (bool(return_ndx)) {
-            return JavaClassGlobalDef::new_float(env, result);
+            set_aggregate_found(env, j_found, true);
+            return static_cast<jfloat>(result);
         }
     }
     CATCH_STD()
-    return nullptr;
+    return 0;
 }
 
 JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeAverageFloat(JNIEnv* env, jobject,
                                                                                jlong nativeQueryPtr,
                                                                                jlong columnKey)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Float)) {
@@ -1545,6 +1656,7 @@ JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeAverageFloat(J
 JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeSumDouble(JNIEnv* env, jobject,
                                                                             jlong nativeQueryPtr, jlong columnKey)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Double)) {
@@ -1557,30 +1669,34 @@ JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeSumDouble(JNIE
     return 0;
 }
 
-JNIEXPORT jobject JNICALL Java_io_realm_internal_TableQuery_nativeMaximumDouble(JNIEnv* env, jobject,
-                                                                                jlong nativeQueryPtr,
-                                                                                jlong columnKey)
+JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeMaximumDouble(JNIEnv* env, jobject,
+                                                                                jlong nativeQueryPtr, jlong columnKey,
+                                                                                jbooleanArray j_found)
 {
+    JNI_PROBE();
+    set_aggregate_found(env, j_found, false);
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Double)) {
-        return nullptr;
+        return 0;
     }
     try {
         ObjKey return_ndx;
         double result = pQuery->maximum_double(ColKey(columnKey), &return_ndx);
         if (bool(return_ndx)) {
-            return JavaClassGlobalDef::new_double(env, result);
+            set_aggregate_found(env, j_found, true);
+            return static_cast<jdouble>(result);
         }
     }
     CATCH_STD()
-    return nullptr;
+    return 0;
 }
 
 JNIEXPORT jlongArray JNICALL Java_io_realm_internal_TableQuery_nativeMaximumDecimal128(JNIEnv* env, jobject,
                                                                                 jlong nativeQueryPtr,
                                                                                 jlong columnKey)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Decimal)) {
@@ -1597,6 +1713,7 @@ JNIEXPORT jlongArray JNICALL Java_io_realm_internal_TableQuery_nativeMaximumDeci
 JNIEXPORT jlongArray JNICALL Java_io_realm_internal_TableQuery_nativeSumDecimal128(JNIEnv* env, jobject,
                                                                             jlong nativeQueryPtr, jlong columnKey)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Decimal)) {
@@ -1612,30 +1729,34 @@ JNIEXPORT jlongArray JNICALL Java_io_realm_internal_TableQuery_nativeSumDecimal1
     return 0;
 }
 
-JNIEXPORT jobject JNICALL Java_io_realm_internal_TableQuery_nativeMinimumDouble(JNIEnv* env, jobject,
-                                                                                jlong nativeQueryPtr,
-                                                                                jlong columnKey)
+JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeMinimumDouble(JNIEnv* env, jobject,
+                                                                                jlong nativeQueryPtr, jlong columnKey,
+                                                                                jbooleanArray j_found)
 {
+    JNI_PROBE();
+    set_aggregate_found(env, j_found, false);
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Double)) {
-        return nullptr;
+        return 0;
     }
     try {
         ObjKey return_ndx;
         double result = pQuery->minimum_double(ColKey(columnKey), &return_ndx);
         if (bool(return_ndx)) {
-            return JavaClassGlobalDef::new_double(env, result);
+            set_aggregate_found(env, j_found, true);
+            return static_cast<jdouble>(result);
         }
     }
     CATCH_STD()
-    return nullptr;
+    return 0;
 }
 
 JNIEXPORT jlongArray JNICALL Java_io_realm_internal_TableQuery_nativeMinimumDecimal128(JNIEnv* env, jobject,
                                                                                 jlong nativeQueryPtr,
                                                                                 jlong columnKey)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Decimal)) {
@@ -1653,6 +1774,7 @@ JNIEXPORT jdouble JNICALL Java_io_realm_internal_TableQuery_nativeAverageDouble(
                                                                                 jlong nativeQueryPtr,
                                                                                 jlong columnKey)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Double)) {
@@ -1669,6 +1791,7 @@ JNIEXPORT jlongArray JNICALL Java_io_realm_internal_TableQuery_nativeAverageDeci
                                                                                 jlong nativeQueryPtr,
                                                                                 jlong columnKey)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Decimal)) {
@@ -1684,50 +1807,57 @@ JNIEXPORT jlongArray JNICALL Java_io_realm_internal_TableQuery_nativeAverageDeci
 
 // date aggregates
 // FIXME: This is a rough workaround while waiting for https://github.com/realm/realm-core/issues/1745 to be solved
-JNIEXPORT jobject JNICALL Java_io_realm_internal_TableQuery_nativeMaximumTimestamp(JNIEnv* env, jobject,
-                                                                                   jlong nativeQueryPtr,
-                                                                                   jlong columnKey)
+JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeMaximumTimestamp(JNIEnv* env, jobject,
+                                                                                 jlong nativeQueryPtr, jlong columnKey,
+                                                                                 jbooleanArray j_found)
 {
+    JNI_PROBE();
+    set_aggregate_found(env, j_found, false);
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Timestamp)) {
-        return nullptr;
+        return 0;
     }
     try {
         ObjKey return_ndx;
         Timestamp result = pQuery->find_all().maximum_timestamp(ColKey(columnKey), &return_ndx);
         if (bool(return_ndx) && !result.is_null()) {
-            return JavaClassGlobalDef::new_long(env, to_milliseconds(result));
+            set_aggregate_found(env, j_found, true);
+            return to_milliseconds(result);
         }
     }
     CATCH_STD()
-    return nullptr;
+    return 0;
 }
 
-JNIEXPORT jobject JNICALL Java_io_realm_internal_TableQuery_nativeMinimumTimestamp(JNIEnv* env, jobject,
-                                                                                   jlong nativeQueryPtr,
-                                                                                   jlong columnKey)
+JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeMinimumTimestamp(JNIEnv* env, jobject,
+                                                                                 jlong nativeQueryPtr, jlong columnKey,
+                                                                                 jbooleanArray j_found)
 {
+    JNI_PROBE();
+    set_aggregate_found(env, j_found, false);
     Query* pQuery = Q(nativeQueryPtr);
     ConstTableRef pTable = pQuery->get_table();
     if (!TYPE_VALID(env, pTable, columnKey, type_Timestamp)) {
-        return nullptr;
+        return 0;
     }
     try {
         ObjKey return_ndx;
         Timestamp result = pQuery->find_all().minimum_timestamp(ColKey(columnKey), &return_ndx);
         if (bool(return_ndx) && !result.is_null()) {
-            return JavaClassGlobalDef::new_long(env, to_milliseconds(result));
+            set_aggregate_found(env, j_found, true);
+            return to_milliseconds(result);
         }
     }
     CATCH_STD()
-    return nullptr;
+    return 0;
 }
 
 // Count, Remove
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeCount(JNIEnv* env, jobject, jlong nativeQueryPtr)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     try {
         return static_cast<jlong>(pQuery->count());
@@ -1738,6 +1868,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeCount(JNIEnv* en
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeRemove(JNIEnv* env, jobject, jlong nativeQueryPtr)
 {
+    JNI_PROBE();
     Query* pQuery = Q(nativeQueryPtr);
     try {
         return static_cast<jlong>(pQuery->remove());
@@ -1746,11 +1877,74 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeRemove(JNIEnv* e
     return 0;
 }
 
+// The chunks are deleted through a Realm instance of their own, which has no notifiers and no binding context, so
+// nothing is delivered while the deletion runs. The calling Realm stays at its version until it is refreshed once the
+// deletion stops, which delivers the notifications of all chunks at once.
+JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeRemoveChunked(JNIEnv* env, jobject,
+                                                                             jlong shared_realm_ptr,
+                                                                             jlong nativeQueryPtr, jlong chunk_size,
+                                                                             jobject j_callback)
+{
+    JNI_PROBE();
+    auto& shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
+    Query* pQuery = Q(nativeQueryPtr);
+    try {
+        static JavaClass callback_class(env, "io/realm/ChunkedDeleteCallback");
+        static JavaMethod on_chunk_deleted_method(env, callback_class, "onChunkDeleted", "(JJ)Z");
+
+        Realm::Config config = shared_realm->config();
+        config.cache = false;
+        SharedRealm writer = Realm::get_shared_realm(std::move(config));
+        writer->read_group();
+        std::unique_ptr<Query> query = writer->import_copy_of(*pQuery, PayloadPolicy::Copy);
+
+        size_t limit = static_cast<size_t>(chunk_size);
+        jlong total = static_cast<jlong>(query->count());
+        jlong deleted = 0;
+        bool proceed = true;
+        while (proceed && !shared_realm->is_closed()) {
+            writer->begin_transaction();
+            size_t removed;
+            try {
+                // Running the query inside the transaction finds the matches of the latest version.
+                TableView chunk = query->find_all(0, size_t(-1), limit);
+                removed = chunk.size();
+                chunk.clear();
+                writer->commit_transaction();
+            }
+            catch (...) {
+                if (writer->is_in_transaction()) {
+                    writer->cancel_transaction();
+                }
+                throw;
+            }
+            deleted += static_cast<jlong>(removed);
+            proceed = removed == limit;
+            if (removed > 0 && j_callback) {
+                proceed = env->CallBooleanMethod(j_callback, on_chunk_deleted_method, deleted, total) == JNI_TRUE &&
+                          proceed;
+                if (env->ExceptionCheck()) {
+                    writer->close();
+                    return deleted;
+                }
+            }
+        }
+        writer->close();
+        if (!shared_realm->is_closed()) {
+            shared_realm->refresh();
+        }
+        return deleted;
+    }
+    CATCH_STD()
+    return 0;
+}
+
 // isNull and isNotNull
 JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeIsNull(JNIEnv* env, jobject, jlong nativeQueryPtr,
                                                                       jlongArray columnKeys,
                                                                       jlongArray tablePointers)
 {
+    JNI_PROBE();
     try {
         JLongArrayAccessor table_arr(env, tablePointers);
         JLongArrayAccessor col_key_arr(env, columnKeys);
@@ -1839,6 +2033,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeIsNotNull(JNIEnv*
                                                                          jlongArray columnKeys,
                                                                          jlongArray tablePointers)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_key_arr(env, columnKeys);
     jsize arr_len = col_key_arr.size();
@@ -1929,6 +2124,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeIsEmpty(JNIEnv* e
                                                                        jlongArray columnKeys,
                                                                        jlongArray tablePointers)
 {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_arr(env, columnKeys);
     jsize arr_len = col_arr.size();
@@ -1999,6 +2195,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_TableQuery_nativeIsEmpty(JNIEnv* e
 JNIEXPORT void JNICALL
 Java_io_realm_internal_TableQuery_nativeIsNotEmpty(JNIEnv *env, jobject, jlong nativeQueryPtr,
                                                    jlongArray columnKeys, jlongArray tablePointers) {
+    JNI_PROBE();
     JLongArrayAccessor table_arr(env, tablePointers);
     JLongArrayAccessor col_arr(env, columnKeys);
     jsize arr_len = col_arr.size();
@@ -2068,6 +2265,7 @@ Java_io_realm_internal_TableQuery_nativeIsNotEmpty(JNIEnv *env, jobject, jlong n
 
 JNIEXPORT void JNICALL
 Java_io_realm_internal_TableQuery_nativeAlwaysFalse(JNIEnv *env, jobject, jlong nativeQueryPtr) {
+    JNI_PROBE();
     try {
         Query* query = reinterpret_cast<Query *>(nativeQueryPtr);
         query->and_query(std::unique_ptr<Expression>(new FalseExpression));
@@ -2078,6 +2276,7 @@ Java_io_realm_internal_TableQuery_nativeAlwaysFalse(JNIEnv *env, jobject, jlong
 
 JNIEXPORT void JNICALL
 Java_io_realm_internal_TableQuery_nativeAlwaysTrue(JNIEnv *env, jobject, jlong nativeQueryPtr) {
+    JNI_PROBE();
     try {
         Query* query = reinterpret_cast<Query *>(nativeQueryPtr);
         query->and_query(std::unique_ptr<Expression>(new TrueExpression));
@@ -2088,9 +2287,11 @@ Java_io_realm_internal_TableQuery_nativeAlwaysTrue(JNIEnv *env, jobject, jlong n
 static void finalize_table_query(jlong ptr)
 {
     delete Q(ptr);
+    NativeObjectCounter::destroyed(NativeObjectCounter::query);
 }
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_TableQuery_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_table_query);
 }
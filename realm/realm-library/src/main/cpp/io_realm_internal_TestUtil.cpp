@@ -10,22 +10,26 @@ static jstring throwOrGetExpectedMessage(JNIEnv* env, jlong testcase, bool shoul
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_TestUtil_getMaxExceptionNumber(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return ExceptionKindMax;
 }
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_TestUtil_getExpectedMessage(JNIEnv* env, jclass,
                                                                              jlong exception_kind)
 {
+    JNI_PROBE();
     return throwOrGetExpectedMessage(env, exception_kind, false);
 }
 
 JNIEXPORT void JNICALL Java_io_realm_internal_TestUtil_testThrowExceptions(JNIEnv* env, jclass, jlong exception_kind)
 {
+    JNI_PROBE();
     throwOrGetExpectedMessage(env, exception_kind, true);
 }
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_TestUtil_getDateFromTimestamp(JNIEnv*, jclass, jlong seconds, jint nanoseconds)
 {
+    JNI_PROBE();
     return to_milliseconds(realm::Timestamp(static_cast<int64_t>(seconds), static_cast<int32_t>(nanoseconds)));
 }
 
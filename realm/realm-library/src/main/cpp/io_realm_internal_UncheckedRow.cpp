@@ -18,15 +18,19 @@
 #include "io_realm_internal_Property.h"
 
 #include "java_accessor.hpp"
+#include "jni_util/java_local_frame.hpp"
+#include "jni_util/native_object_counter.hpp"
 #include "util.hpp"
 
 using namespace realm;
 using namespace realm::_impl;
+using namespace realm::jni_util;
 
 static void finalize_unchecked_row(jlong ptr);
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetColumnCount(JNIEnv*, jobject, jlong nativeRowPtr)
 {
+    JNI_PROBE();
     if (!OBJ(nativeRowPtr)->is_valid()) {
         return 0;
     }
@@ -38,6 +42,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetColumnKey(J
                                                                                  jlong nativeRowPtr,
                                                                                  jstring columnName)
 {
+    JNI_PROBE();
     if (!OBJ(nativeRowPtr)->is_valid()) {
         ThrowException(env, IllegalArgument, "Object passed is not valid");
     }
@@ -56,6 +61,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetColumnKey(J
 JNIEXPORT jobjectArray JNICALL Java_io_realm_internal_UncheckedRow_nativeGetColumnNames(JNIEnv* env, jobject,
                                                                                jlong nativeRowPtr)
 {
+    JNI_PROBE();
     if (!OBJ(nativeRowPtr)->is_valid()) {
         ThrowException(env, IllegalArgument, "Object passed is not valid");
     }
@@ -69,8 +75,10 @@ JNIEXPORT jobjectArray JNICALL Java_io_realm_internal_UncheckedRow_nativeGetColu
             ThrowException(env, OutOfMemory, "Could not allocate memory to return column keys.");
             return NULL;
         }
+        JavaLocalFrame frame(env);
         for (size_t i = 0; i < size; ++i) {
             env->SetObjectArrayElement(col_keys_array, i, to_jstring(env,  OBJ(nativeRowPtr)->get_table()->get_column_name(col_keys[i])));
+            frame.step();
         }
 
         return col_keys_array;
@@ -84,6 +92,7 @@ JNIEXPORT jobjectArray JNICALL Java_io_realm_internal_UncheckedRow_nativeGetColu
 JNIEXPORT jint JNICALL Java_io_realm_internal_UncheckedRow_nativeGetColumnType(JNIEnv*, jobject, jlong nativeRowPtr,
                                                                                jlong columnKey)
 {
+    JNI_PROBE();
     ColKey column_key (columnKey);
     auto table = OBJ(nativeRowPtr)->get_table();
     jint column_type = table->get_column_type(column_key);
@@ -97,6 +106,7 @@ JNIEXPORT jint JNICALL Java_io_realm_internal_UncheckedRow_nativeGetColumnType(J
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetObjectKey(JNIEnv* env, jobject, jlong nativeRowPtr)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return 0;
     }
@@ -107,6 +117,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetObjectKey(J
 JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetLong(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                           jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return 0;
     }
@@ -122,6 +133,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetLong(JNIEnv
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_UncheckedRow_nativeGetBoolean(JNIEnv* env, jobject,
                                                                                 jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return 0;
     }
@@ -132,6 +144,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_UncheckedRow_nativeGetBoolean(
 JNIEXPORT jfloat JNICALL Java_io_realm_internal_UncheckedRow_nativeGetFloat(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                             jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return 0;
     }
@@ -142,6 +155,7 @@ JNIEXPORT jfloat JNICALL Java_io_realm_internal_UncheckedRow_nativeGetFloat(JNIE
 JNIEXPORT jdouble JNICALL Java_io_realm_internal_UncheckedRow_nativeGetDouble(JNIEnv* env, jobject,
                                                                               jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return 0;
     }
@@ -152,6 +166,7 @@ JNIEXPORT jdouble JNICALL Java_io_realm_internal_UncheckedRow_nativeGetDouble(JN
 JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetTimestamp(JNIEnv* env, jobject,
                                                                                jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return 0;
     }
@@ -162,6 +177,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetTimestamp(J
 JNIEXPORT jstring JNICALL Java_io_realm_internal_UncheckedRow_nativeGetString(JNIEnv* env, jobject,
                                                                               jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return nullptr;
     }
@@ -178,6 +194,7 @@ JNIEXPORT jbyteArray JNICALL Java_io_realm_internal_UncheckedRow_nativeGetByteAr
                                                                                     jlong nativeRowPtr,
                                                                                     jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return nullptr;
     }
@@ -193,6 +210,7 @@ JNIEXPORT jbyteArray JNICALL Java_io_realm_internal_UncheckedRow_nativeGetByteAr
 JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetLink(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                           jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return 0;
     }
@@ -208,6 +226,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetLink(JNIEnv
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_UncheckedRow_nativeIsNullLink(JNIEnv* env, jobject,
                                                                                 jlong nativeRowPtr, jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return 0;
     }
@@ -218,6 +237,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_UncheckedRow_nativeIsNullLink(
 JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetLong(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                          jlong columnKey, jlong value)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -231,6 +251,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetLong(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetBoolean(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                             jlong columnKey, jboolean value)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -244,6 +265,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetBoolean(JNIE
 JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetFloat(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                           jlong columnKey, jfloat value)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -257,6 +279,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetFloat(JNIEnv
 JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetDouble(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                            jlong columnKey, jdouble value)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -271,6 +294,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetTimestamp(JN
                                                                               jlong nativeRowPtr, jlong columnKey,
                                                                               jlong value)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -284,6 +308,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetTimestamp(JN
 JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetString(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                            jlong columnKey, jstring value)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -304,6 +329,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetByteArray(JN
                                                                               jlong nativeRowPtr, jlong columnKey,
                                                                               jbyteArray value)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -316,7 +342,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetByteArray(JN
             return;
         }
 
-        JByteArrayAccessor jarray_accessor(env, value);
+        JByteArrayCriticalAccessor jarray_accessor(env, value);
         obj.set(col_key, jarray_accessor.transform<BinaryData>());
     }
     CATCH_STD()
@@ -325,6 +351,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetByteArray(JN
 JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetLink(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                          jlong columnKey, jlong valueObjKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -338,6 +365,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetLink(JNIEnv*
 JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeNullifyLink(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                              jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -350,12 +378,14 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeNullifyLink(JNI
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_UncheckedRow_nativeIsValid(JNIEnv*, jobject, jlong nativeRowPtr)
 {
+    JNI_PROBE();
     return to_jbool(OBJ(nativeRowPtr)->is_valid());
 }
 
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_UncheckedRow_nativeHasColumn(JNIEnv* env, jobject obj,
                                                                                jlong nativeRowPtr, jstring columnName)
 {
+    JNI_PROBE();
     ColKey col_key (Java_io_realm_internal_UncheckedRow_nativeGetColumnKey(env, obj, nativeRowPtr, columnName));
     return to_jbool(bool(col_key));
 }
@@ -363,6 +393,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_UncheckedRow_nativeHasColumn(J
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_UncheckedRow_nativeIsNull(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                             jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return JNI_FALSE;
     }
@@ -378,6 +409,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_internal_UncheckedRow_nativeIsNull(JNIE
 JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetNull(JNIEnv* env, jobject, jlong nativeRowPtr,
                                                                          jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -393,10 +425,12 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetNull(JNIEnv*
 JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeFreeze(JNIEnv* env, jobject, jlong j_native_row_ptr,
                                                                          jlong j_frozen_realm_native_ptr)
 {
+    JNI_PROBE();
     try {
         Obj* obj = reinterpret_cast<Obj*>(j_native_row_ptr);
         auto frozen_realm = *(reinterpret_cast<SharedRealm*>(j_frozen_realm_native_ptr));
-        auto frozen_obj = new Obj(frozen_realm->import_copy_of(*obj));
+        auto frozen_obj =
+            NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(frozen_realm->import_copy_of(*obj)));
         return reinterpret_cast<jlong>(frozen_obj);
     }
     CATCH_STD()
@@ -407,10 +441,12 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeFreeze(JNIEnv*
 static void finalize_unchecked_row(jlong ptr)
 {
     delete OBJ(ptr);
+    NativeObjectCounter::destroyed(NativeObjectCounter::obj);
 }
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeGetFinalizerPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_unchecked_row);
 }
 
@@ -418,6 +454,7 @@ JNIEXPORT jlongArray JNICALL Java_io_realm_internal_UncheckedRow_nativeGetDecima
                                                                                     jlong nativeRowPtr,
                                                                                     jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return nullptr;
     }
@@ -434,6 +471,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetDecimal128(J
                                                                               jlong nativeRowPtr, jlong columnKey,
                                                                               jlong low, jlong high)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -450,6 +488,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_UncheckedRow_nativeGetObjectId(
                                                                                     jlong nativeRowPtr,
                                                                                     jlong columnKey)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return nullptr;
     }
@@ -466,6 +505,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_UncheckedRow_nativeSetObjectId(JNI
                                                                               jlong nativeRowPtr, jlong columnKey,
                                                                               jstring j_value)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(nativeRowPtr))) {
         return;
     }
@@ -481,6 +521,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_UncheckedRow_nativeCreateEmbedded
                                                                                        jlong j_obj_ptr,
                                                                                        jlong j_column_key)
 {
+    JNI_PROBE();
     if (!ROW_VALID(env, OBJ(j_obj_ptr))) {
         return -1;
     }
@@ -68,6 +68,7 @@ JNIEXPORT void JNI_OnUnload(JavaVM* vm, void*)
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_Util_nativeGetTablePrefix(JNIEnv* env, jclass)
 {
+    JNI_PROBE();
     realm::StringData sd(TABLE_PREFIX);
     return to_jstring(env, sd);
 }
@@ -31,11 +31,13 @@ static void finalize_descriptor(jlong ptr)
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_core_DescriptorOrdering_nativeGetFinalizerMethodPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_descriptor);
 }
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_core_DescriptorOrdering_nativeCreate(JNIEnv* env, jclass)
 {
+    JNI_PROBE();
    try {
         return reinterpret_cast<jlong>(new DescriptorOrdering());
     }
@@ -47,6 +49,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_core_DescriptorOrdering_nativeAppe
                                                                              jlong descriptor_ptr,
                                                                              jobject j_sort_descriptor)
 {
+    JNI_PROBE();
     try {
         auto descriptor = reinterpret_cast<DescriptorOrdering*>(descriptor_ptr);
         if (j_sort_descriptor) {
@@ -60,6 +63,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_core_DescriptorOrdering_nativeAppe
                                                                              jlong descriptor_ptr,
                                                                              jobject j_distinct_descriptor)
 {
+    JNI_PROBE();
     try {
         auto descriptor = reinterpret_cast<DescriptorOrdering*>(descriptor_ptr);
         if (j_distinct_descriptor) {
@@ -73,6 +77,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_core_DescriptorOrdering_nativeAppe
                                                                              jlong descriptor_ptr,
                                                                              jlong limit)
 {
+    JNI_PROBE();
     try {
          auto descriptor = reinterpret_cast<DescriptorOrdering*>(descriptor_ptr);
          descriptor->append_limit(limit);
@@ -83,6 +88,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_core_DescriptorOrdering_nativeAppe
 JNIEXPORT jboolean JNICALL Java_io_realm_internal_core_DescriptorOrdering_nativeIsEmpty(JNIEnv* env, jclass,
                                                                              jlong descriptor_ptr)
 {
+    JNI_PROBE();
     try {
         auto descriptor = reinterpret_cast<DescriptorOrdering*>(descriptor_ptr);
         return descriptor->is_empty() ? JNI_TRUE : JNI_FALSE;
@@ -16,7 +16,9 @@
 
 #include "io_realm_internal_objectstore_OsApp.h"
 
+#include "java_class_global_def.hpp"
 #include "java_network_transport.hpp"
+#include "native_network_transport.hpp"
 #include "util.hpp"
 #include "jni_util/java_method.hpp"
 #include "jni_util/jni_utils.hpp"
@@ -91,6 +93,7 @@ static void finalize_client(jlong ptr) {
 
 JNIEXPORT jlong JNICALL
 Java_io_realm_internal_objectstore_OsApp_nativeGetFinalizerMethodPtr(JNIEnv*, jclass) {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_client);
 }
 
@@ -106,9 +109,13 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsApp_nativeCreate(JN
                                                                jstring j_user_agent_application_info,
                                                                jstring j_platform,
                                                                jstring j_platform_version,
-                                                               jstring j_sdk_version)
+                                                               jstring j_sdk_version,
+                                                               jlong j_native_transport_ptr)
 {
+    JNI_PROBE();
     try {
+        // Normally done by Realm.init() already, the callbacks of the app need them.
+        JavaClassGlobalDef::initialize_realm_methods(env);
 
         JStringAccessor app_id(env, j_app_id);
 
@@ -122,12 +129,22 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsApp_nativeCreate(JN
         }
 
         // App Config
-        std::function<std::unique_ptr<GenericNetworkTransport>()> transport_generator = [java_app_ref = JavaGlobalRefByCopy(env, obj)] {
-            JNIEnv* env = JniUtils::get_env(true);
-            static JavaMethod get_network_transport_method(env, java_app_ref.get(), "getNetworkTransport", "()Lio/realm/internal/objectstore/OsJavaNetworkTransport;");
-            jobject network_transport_impl = env->CallObjectMethod(java_app_ref.get(), get_network_transport_method);
-            return std::unique_ptr<GenericNetworkTransport>(new JavaNetworkTransport(network_transport_impl));
-        };
+        std::function<std::unique_ptr<GenericNetworkTransport>()> transport_generator;
+        if (j_native_transport_ptr) {
+            // Requests are executed by the native client without calling into Java.
+            auto client = *reinterpret_cast<std::shared_ptr<NativeHttpClient>*>(j_native_transport_ptr);
+            transport_generator = [client] {
+                return std::unique_ptr<GenericNetworkTransport>(new NativeNetworkTransport(client));
+            };
+        }
+        else {
+            transport_generator = [java_app_ref = JavaGlobalRefByCopy(env, obj)] {
+                JNIEnv* env = JniUtils::get_env(true);
+                static JavaMethod get_network_transport_method(env, java_app_ref.get(), "getNetworkTransport", "()Lio/realm/internal/objectstore/OsJavaNetworkTransport;");
+                jobject network_transport_impl = env->CallObjectMethod(java_app_ref.get(), get_network_transport_method);
+                return std::unique_ptr<GenericNetworkTransport>(new JavaNetworkTransport(network_transport_impl));
+            };
+        }
 
         JStringAccessor base_url(env, j_base_url);
         JStringAccessor app_name(env, j_app_name);
@@ -182,6 +199,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsApp_nativeCreate(JN
 
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsApp_nativeLogin(JNIEnv* env, jclass, jlong j_app_ptr, jlong j_credentials_ptr, jobject j_callback)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         auto credentials = reinterpret_cast<AppCredentials *>(j_credentials_ptr);
@@ -197,6 +215,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsApp_nativeLogin(JNIE
 
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsApp_nativeLogOut(JNIEnv* env, jclass, jlong j_app_ptr, jlong j_user_ptr, jobject j_callback)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
@@ -207,6 +226,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsApp_nativeLogOut(JNI
 
 JNIEXPORT jobject JNICALL Java_io_realm_internal_objectstore_OsApp_nativeCurrentUser(JNIEnv* env, jclass, jlong j_app_ptr)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         std::shared_ptr<SyncUser> user = app->current_user();
@@ -224,6 +244,7 @@ JNIEXPORT jobject JNICALL Java_io_realm_internal_objectstore_OsApp_nativeCurrent
 
 JNIEXPORT jlongArray JNICALL Java_io_realm_internal_objectstore_OsApp_nativeGetAllUsers(JNIEnv* env, jclass, jlong j_app_ptr)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         std::vector<std::shared_ptr<SyncUser>> users = app->all_users();
@@ -254,6 +275,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsApp_nativeSwitchUser
                                                                   jlong j_app_ptr,
                                                                   jlong j_user_ptr)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
@@ -270,6 +292,7 @@ JNIEXPORT jobject JNICALL Java_io_realm_internal_objectstore_OsApp_nativeMakeStr
                                                                                jstring j_bson_args,
                                                                                jstring j_service_name)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
@@ -33,6 +33,7 @@ static void finalize_credentials(jlong ptr)
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsAppCredentials_nativeGetFinalizerMethodPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_credentials);
 }
 
@@ -41,6 +42,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsAppCredentials_nati
                                                                                          jint j_type,
                                                                                          jobjectArray j_args)
 {
+    JNI_PROBE();
     try {
         AppCredentials creds = AppCredentials::anonymous(); // Is there a way to avoid setting this to a specific value?
         switch(j_type) {
@@ -100,6 +102,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsAppCredentials_nati
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsAppCredentials_nativeGetProvider(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto credentials = reinterpret_cast<AppCredentials*>(j_native_ptr);
         std::string provider = credentials->provider_as_string();
@@ -111,6 +114,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsAppCredentials_na
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsAppCredentials_nativeAsJson(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto credentials = reinterpret_cast<AppCredentials*>(j_native_ptr);
         std::string json = credentials->serialize_as_json();
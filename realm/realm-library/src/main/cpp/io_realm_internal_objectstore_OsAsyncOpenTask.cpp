@@ -17,6 +17,7 @@
 #include "io_realm_internal_objectstore_OsAsyncOpenTask.h"
 
 #include "util.hpp"
+#include "java_class_global_def.hpp"
 #include "thread_safe_reference.hpp"
 #include "jni_util/java_method.hpp"
 #include "jni_util/java_class.hpp"
@@ -34,12 +35,9 @@ using namespace realm::_impl;
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsAsyncOpenTask_start(JNIEnv* env, jobject obj, jlong config_ptr)
 {
+    JNI_PROBE();
     try {
 
-        static JavaClass java_async_open_task_class(env, "io/realm/internal/objectstore/OsAsyncOpenTask");
-        static JavaMethod java_notify_realm_ready(env, java_async_open_task_class, "notifyRealmReady", "()V", false);
-        static JavaMethod java_notify_error(env, java_async_open_task_class, "notifyError", "(Ljava/lang/String;)V", false);
-
         auto global_obj = env->NewGlobalRef(obj);
         auto& config = *reinterpret_cast<Realm::Config*>(config_ptr);
 
@@ -57,14 +55,14 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsAsyncOpenTask_start
                 }
                 catch (const std::exception& e) {
                     jstring j_error_msg = to_jstring(local_env, e.what());
-                    local_env->CallVoidMethod(task.get(), java_notify_error, j_error_msg);
+                    local_env->CallVoidMethod(task.get(), JavaClassGlobalDef::async_open_task_notify_error(local_env), j_error_msg);
                     local_env->DeleteLocalRef(j_error_msg);
                 }
             }
             else {
                 auto realm = Realm::get_shared_realm(std::move(realm_ref));
                 realm->close();
-                local_env->CallVoidMethod(task.get(), java_notify_realm_ready);
+                local_env->CallVoidMethod(task.get(), JavaClassGlobalDef::async_open_task_notify_realm_ready(local_env));
             }
             const_cast<std::shared_ptr<_jobject>&>(task).reset();
         });
@@ -76,6 +74,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsAsyncOpenTask_start
 
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsAsyncOpenTask_cancel(JNIEnv*, jobject, jlong task_ptr)
 {
+    JNI_PROBE();
     AsyncOpenTask* task = reinterpret_cast<AsyncOpenTask*>(task_ptr);
     task->cancel();
 }
\ No newline at end of file
@@ -39,6 +39,7 @@ static void finalize_client(jlong ptr) {
 
 JNIEXPORT jlong JNICALL
 Java_io_realm_internal_objectstore_OsMongoClient_nativeGetFinalizerMethodPtr(JNIEnv*, jclass) {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_client);
 }
 
@@ -47,6 +48,7 @@ Java_io_realm_internal_objectstore_OsMongoClient_nativeCreate(JNIEnv* env,
                                                               jclass,
                                                               jlong j_user_ptr,
                                                               jstring j_service_name) {
+    JNI_PROBE();
     try {
         std::shared_ptr<SyncUser>& user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
         JStringAccessor name(env, j_service_name);
@@ -62,6 +64,7 @@ Java_io_realm_internal_objectstore_OsMongoClient_nativeCreateDatabase(JNIEnv* en
                                                                       jclass,
                                                                       jlong j_client_ptr,
                                                                       jstring j_database_name) {
+    JNI_PROBE();
     try {
         auto client = reinterpret_cast<MongoClient*>(j_client_ptr);
         JStringAccessor name(env, j_database_name);
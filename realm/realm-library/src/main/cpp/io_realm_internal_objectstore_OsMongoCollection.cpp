@@ -19,11 +19,14 @@
 #include "java_class_global_def.hpp"
 #include "java_network_transport.hpp"
 #include "util.hpp"
+#include "jni_util/java_local_frame.hpp"
 #include "jni_util/java_method.hpp"
 #include "jni_util/jni_utils.hpp"
 #include "jni_util/bson_util.hpp"
 #include "object-store/src/util/bson/bson.hpp"
 
+#include <algorithm>
+
 #include <realm/util/optional.hpp>
 #include <sync/app.hpp>
 #include <sync/mongo_database.hpp>
@@ -43,27 +46,43 @@ static std::function<jobject(JNIEnv*, uint64_t)> collection_mapper_count = [](JN
 
 // This mapper works for both findOne and findOneAndUpdate/Replace functions
 static std::function<jobject(JNIEnv*, util::Optional<bson::BsonDocument>)> collection_mapper_find_one = [](JNIEnv* env, util::Optional<bson::BsonDocument> document) {
-    return document ? JniBsonProtocol::bson_to_jstring(env, *document) : nullptr;
+    return document ? JniBsonProtocol::bson_to_jbytes(env, *document) : nullptr;
 };
 
 static std::function<jobject(JNIEnv*, util::Optional<Bson>)> collection_mapper_insert_one = [](JNIEnv* env, util::Optional<Bson> bson_id) {
     if (bson_id) {
-        return JniBsonProtocol::bson_to_jstring(env, bson_id.value());
+        return JniBsonProtocol::bson_to_jbytes(env, bson_id.value());
     }
     throw std::logic_error("Error in 'insert_one', parameter 'bson_id' has no value.");
 };
 
-static std::function<jobject(JNIEnv*, std::vector<Bson>)> collection_mapper_insert_many = [](JNIEnv* env, std::vector<Bson> bson_ids) {
+// Ids are usually generated ObjectIds, those are returned packed in a single byte[] of 12 bytes per id. Otherwise an
+// Object[] with each id encoded as binary BSON is returned.
+static std::function<jobject(JNIEnv*, std::vector<Bson>)> collection_mapper_insert_many = [](JNIEnv* env, std::vector<Bson> bson_ids) -> jobject {
     if (bson_ids.empty()) {
         throw std::logic_error("Error in 'insert_many', parameter 'object_ids' is empty.");
     }
+    bool all_object_ids = std::all_of(bson_ids.begin(), bson_ids.end(), [](const Bson& id) {
+        return id.type() == Bson::Type::ObjectId;
+    });
+    if (all_object_ids) {
+        std::string packed_ids;
+        packed_ids.reserve(bson_ids.size() * 12);
+        for (const Bson& id : bson_ids) {
+            JniBsonProtocol::append_object_id(packed_ids, static_cast<ObjectId>(id));
+        }
+        return JavaClassGlobalDef::new_byte_array(env, BinaryData(packed_ids.data(), packed_ids.size()));
+    }
+
     auto arr = (jobjectArray)env->NewObjectArray(static_cast<jsize>(bson_ids.size()), JavaClassGlobalDef::java_lang_object(), nullptr);
     if (arr == nullptr) {
         ThrowException(env, OutOfMemory, "Could not allocate memory to return list of ObjectIds of inserted documents.");
         return arr;
     }
+    JavaLocalFrame frame(env);
     for (size_t i = 0; i < bson_ids.size(); ++i) {
-        env->SetObjectArrayElement(arr, i, JniBsonProtocol::bson_to_jstring(env, bson_ids[i]));
+        env->SetObjectArrayElement(arr, i, JniBsonProtocol::bson_to_jbytes(env, bson_ids[i]));
+        frame.step();
     }
     return arr;
 };
@@ -77,7 +96,7 @@ static std::function<jobject(JNIEnv*, MongoCollection::UpdateResult)> collection
     }
     std::vector<Bson> bson_vector = { matched_count, modified_count, upserted_value };
     Bson output(bson_vector);
-    return JniBsonProtocol::bson_to_jstring(env, output);
+    return JniBsonProtocol::bson_to_jbytes(env, output);
 };
 
 static void finalize_collection(jlong ptr) {
@@ -86,6 +105,7 @@ static void finalize_collection(jlong ptr) {
 
 JNIEXPORT jlong JNICALL
 Java_io_realm_internal_objectstore_OsMongoCollection_nativeGetFinalizerMethodPtr(JNIEnv*, jclass) {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_collection);
 }
 
@@ -93,9 +113,10 @@ JNIEXPORT void JNICALL
 Java_io_realm_internal_objectstore_OsMongoCollection_nativeCount(JNIEnv* env,
                                                                  jclass,
                                                                  jlong j_collection_ptr,
-                                                                 jstring j_filter,
+                                                                 jbyteArray j_filter,
                                                                  jlong j_limit,
                                                                  jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
 
@@ -111,11 +132,12 @@ Java_io_realm_internal_objectstore_OsMongoCollection_nativeFindOne(JNIEnv* env,
                                                                    jclass,
                                                                    jint j_find_one_type,
                                                                    jlong j_collection_ptr,
-                                                                   jstring j_filter,
-                                                                   jstring j_projection,
-                                                                   jstring j_sort,
+                                                                   jbyteArray j_filter,
+                                                                   jbyteArray j_projection,
+                                                                   jbyteArray j_sort,
                                                                    jlong j_limit,
                                                                    jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
 
@@ -150,8 +172,9 @@ JNIEXPORT void JNICALL
 Java_io_realm_internal_objectstore_OsMongoCollection_nativeInsertOne(JNIEnv* env,
                                                                      jclass,
                                                                      jlong j_collection_ptr,
-                                                                     jstring j_document,
+                                                                     jbyteArray j_document,
                                                                      jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
 
@@ -165,8 +188,9 @@ JNIEXPORT void JNICALL
 Java_io_realm_internal_objectstore_OsMongoCollection_nativeInsertMany(JNIEnv* env,
                                                                       jclass,
                                                                       jlong j_collection_ptr,
-                                                                      jstring j_documents,
+                                                                      jbyteArray j_documents,
                                                                       jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
 
@@ -181,8 +205,9 @@ Java_io_realm_internal_objectstore_OsMongoCollection_nativeDelete(JNIEnv* env,
                                                                   jclass,
                                                                   jint j_delete_type,
                                                                   jlong j_collection_ptr,
-                                                                  jstring j_document,
+                                                                  jbyteArray j_document,
                                                                   jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
         bson::BsonDocument filter(JniBsonProtocol::parse_checked(env, j_document, Bson::Type::Document, "BSON document must be a Document"));
@@ -206,10 +231,11 @@ Java_io_realm_internal_objectstore_OsMongoCollection_nativeUpdate(JNIEnv *env,
                                                                   jclass,
                                                                   jint j_update_type,
                                                                   jlong j_collection_ptr,
-                                                                  jstring j_filter,
-                                                                  jstring j_update,
+                                                                  jbyteArray j_filter,
+                                                                  jbyteArray j_update,
                                                                   jboolean j_upsert,
                                                                   jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
 
@@ -241,13 +267,14 @@ Java_io_realm_internal_objectstore_OsMongoCollection_nativeFindOneAndUpdate(JNIE
                                                                             jclass,
                                                                             jint j_find_one_and_update_type,
                                                                             jlong j_collection_ptr,
-                                                                            jstring j_filter,
-                                                                            jstring j_update,
-                                                                            jstring j_projection,
-                                                                            jstring j_sort,
+                                                                            jbyteArray j_filter,
+                                                                            jbyteArray j_update,
+                                                                            jbyteArray j_projection,
+                                                                            jbyteArray j_sort,
                                                                             jboolean j_upsert,
                                                                             jboolean j_return_new_document,
                                                                             jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
 
@@ -282,13 +309,14 @@ Java_io_realm_internal_objectstore_OsMongoCollection_nativeFindOneAndReplace(JNI
                                                                              jclass,
                                                                              jint j_find_one_and_replace_type,
                                                                              jlong j_collection_ptr,
-                                                                             jstring j_filter,
-                                                                             jstring j_update,
-                                                                             jstring j_projection,
-                                                                             jstring j_sort,
+                                                                             jbyteArray j_filter,
+                                                                             jbyteArray j_update,
+                                                                             jbyteArray j_projection,
+                                                                             jbyteArray j_sort,
                                                                              jboolean j_upsert,
                                                                              jboolean j_return_new_document,
                                                                              jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
 
@@ -323,12 +351,13 @@ Java_io_realm_internal_objectstore_OsMongoCollection_nativeFindOneAndDelete(JNIE
                                                                             jclass,
                                                                             jint j_find_one_and_delete_type,
                                                                             jlong j_collection_ptr,
-                                                                            jstring j_filter,
-                                                                            jstring j_projection,
-                                                                            jstring j_sort,
+                                                                            jbyteArray j_filter,
+                                                                            jbyteArray j_projection,
+                                                                            jbyteArray j_sort,
                                                                             jboolean j_upsert,
                                                                             jboolean j_return_new_document,
                                                                             jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
 
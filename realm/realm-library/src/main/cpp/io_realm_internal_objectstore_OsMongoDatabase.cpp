@@ -39,6 +39,7 @@ static void finalize_database(jlong ptr) {
 
 JNIEXPORT jlong JNICALL
 Java_io_realm_internal_objectstore_OsMongoDatabase_nativeGetFinalizerMethodPtr(JNIEnv*, jclass) {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_database);
 }
 
@@ -47,6 +48,7 @@ Java_io_realm_internal_objectstore_OsMongoDatabase_nativeGetCollection(JNIEnv* e
                                                                        jclass,
                                                                        jlong j_database_ptr,
                                                                        jstring j_collection_name) {
+    JNI_PROBE();
     try {
         auto database = reinterpret_cast<MongoDatabase*>(j_database_ptr);
         JStringAccessor name(env, j_collection_name);
@@ -0,0 +1,166 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io_realm_internal_objectstore_OsNativeNetworkTransport.h"
+
+#include <future>
+
+#include "java_accessor.hpp"
+#include "java_class_global_def.hpp"
+#include "native_network_transport.hpp"
+#include "util.hpp"
+#include "jni_util/java_class.hpp"
+#include "jni_util/java_local_frame.hpp"
+#include "jni_util/java_method.hpp"
+#include "jni_util/jni_utils.hpp"
+
+using namespace realm;
+using namespace realm::app;
+using namespace realm::jni_util;
+using namespace realm::_impl;
+
+static void finalize_client(jlong ptr)
+{
+    delete reinterpret_cast<std::shared_ptr<NativeHttpClient>*>(ptr);
+}
+
+static std::map<std::string, std::string> to_header_map(JNIEnv* env, jobjectArray j_headers)
+{
+    std::map<std::string, std::string> headers;
+    JObjectArrayAccessor<JStringAccessor, jstring> java_headers(env, j_headers);
+    JavaLocalFrame frame(env);
+    for (jsize i = 0; i + 1 < java_headers.size(); i = i + 2) {
+        JStringAccessor key = java_headers[i];
+        JStringAccessor value = java_headers[i + 1];
+        headers.emplace(key, value);
+        frame.step(2);
+    }
+    return headers;
+}
+
+JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsNativeNetworkTransport_nativeGetFinalizerMethodPtr(JNIEnv*,
+                                                                                                              jclass)
+{
+    JNI_PROBE();
+    return reinterpret_cast<jlong>(&finalize_client);
+}
+
+JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsNativeNetworkTransport_nativeCreate(
+    JNIEnv* env, jclass, jstring j_authorization_header_name, jobjectArray j_custom_headers)
+{
+    JNI_PROBE();
+    try {
+        JStringAccessor authorization_header_name(env, j_authorization_header_name); // throws
+
+        NativeHttpClient::Config config;
+        config.authorization_header_name = authorization_header_name;
+        config.custom_headers = to_header_map(env, j_custom_headers);
+
+        // Certificates are verified by Android, like for the connections of the sync client.
+        static JavaClass sync_class(env, "io/realm/mongodb/sync/Sync");
+        static JavaMethod java_ssl_verify_callback(env, sync_class, "sslVerifyCallback",
+                                                   "(Ljava/lang/String;Ljava/lang/String;I)Z", true);
+        config.ssl_verify_callback = [](const std::string& server_address, uint_fast16_t, const char* pem_data,
+                                        size_t pem_size, int, int depth) {
+            JNIEnv* env = JniUtils::get_env(true);
+            JavaLocalFrame frame(env);
+            std::string pem(pem_data, pem_size);
+            return env->CallStaticBooleanMethod(sync_class, java_ssl_verify_callback,
+                                                to_jstring(env, server_address), to_jstring(env, pem),
+                                                depth) == JNI_TRUE;
+        };
+
+        auto client = std::make_shared<NativeHttpClient>(std::move(config));
+        return reinterpret_cast<jlong>(new std::shared_ptr<NativeHttpClient>(std::move(client)));
+    }
+    CATCH_STD()
+    return 0;
+}
+
+// Blocks until the response is available. Only used when Java sends requests through the transport, requests from
+// Object Store are completed asynchronously.
+JNIEXPORT jobject JNICALL Java_io_realm_internal_objectstore_OsNativeNetworkTransport_nativeSendRequest(
+    JNIEnv* env, jclass, jlong j_native_ptr, jstring j_method, jstring j_url, jlong j_timeout_ms,
+    jobjectArray j_headers, jbyteArray j_body)
+{
+    JNI_PROBE();
+    try {
+        auto& client = *reinterpret_cast<std::shared_ptr<NativeHttpClient>*>(j_native_ptr);
+
+        JStringAccessor method(env, j_method); // throws
+        JStringAccessor url(env, j_url); // throws
+
+        Request request;
+        std::string method_name = method;
+        if (method_name == "get") {
+            request.method = HttpMethod::get;
+        }
+        else if (method_name == "post") {
+            request.method = HttpMethod::post;
+        }
+        else if (method_name == "patch") {
+            request.method = HttpMethod::patch;
+        }
+        else if (method_name == "put") {
+            request.method = HttpMethod::put;
+        }
+        else if (method_name == "delete") {
+            request.method = HttpMethod::del;
+        }
+        else {
+            ThrowException(env, IllegalArgument, "Unknown method type: " + method_name);
+            return nullptr;
+        }
+        request.url = url;
+        request.timeout_ms = static_cast<uint64_t>(j_timeout_ms);
+        request.headers = to_header_map(env, j_headers);
+        if (j_body) {
+            // Copied straight into the request, without an intermediate buffer.
+            jsize body_size = env->GetArrayLength(j_body);
+            request.body.resize(static_cast<size_t>(body_size));
+            env->GetByteArrayRegion(j_body, 0, body_size, reinterpret_cast<jbyte*>(&request.body[0]));
+        }
+
+        std::promise<Response> promise;
+        std::future<Response> future = promise.get_future();
+        client->send(std::move(request), [&promise](const Response response) {
+            promise.set_value(std::move(response));
+        });
+        Response response = future.get();
+
+        jobjectArray j_response_headers = env->NewObjectArray(static_cast<jsize>(response.headers.size() * 2),
+                                                              JavaClassGlobalDef::java_lang_string(), nullptr);
+        {
+            JavaLocalFrame frame(env);
+            jsize i = 0;
+            for (const auto& header : response.headers) {
+                env->SetObjectArrayElement(j_response_headers, i++, to_jstring(env, header.first));
+                env->SetObjectArrayElement(j_response_headers, i++, to_jstring(env, header.second));
+                frame.step(2);
+            }
+        }
+
+        static JavaClass response_class(env, "io/realm/internal/objectstore/OsNativeNetworkTransport$NativeResponse");
+        static JavaMethod response_constructor(env, response_class, "<init>",
+                                               "(II[Ljava/lang/String;[B)V");
+        return env->NewObject(response_class, response_constructor, static_cast<jint>(response.http_status_code),
+                              static_cast<jint>(response.custom_status_code), j_response_headers,
+                              JavaClassGlobalDef::new_byte_array(
+                                  env, BinaryData(response.body.data(), response.body.size())));
+    }
+    CATCH_STD()
+    return nullptr;
+}
@@ -16,7 +16,9 @@
 
 #include "io_realm_internal_objectstore_OsObjectBuilder.h"
 
+#include "java_binding_context.hpp"
 #include "java_object_accessor.hpp"
+#include "jni_util/native_object_counter.hpp"
 #include "util.hpp"
 
 #include <realm/util/any.hpp>
@@ -29,13 +31,17 @@ typedef std::map<ColKey, JavaValue> OsObjectData;
 
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeDestroyBuilder(JNIEnv*, jclass, jlong data_ptr)
 {
+    JNI_PROBE();
     delete reinterpret_cast<OsObjectData*>(data_ptr);
+    NativeObjectCounter::destroyed(NativeObjectCounter::object_builder);
 }
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeCreateBuilder(JNIEnv* env, jclass)
 {
+    JNI_PROBE();
     try {
         auto map = new std::map<ColKey, JavaValue>();
+        NativeObjectCounter::created(NativeObjectCounter::object_builder);
         return reinterpret_cast<jlong>(map);
     }
     CATCH_STD()
@@ -51,6 +57,7 @@ static inline void add_property(jlong data_ptr, jlong column_key, JavaValue cons
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddNull
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key)
 {
+    JNI_PROBE();
     try {
         const JavaValue value = JavaValue();
         add_property(data_ptr, column_key, value);
@@ -61,6 +68,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddString
     (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jstring j_value)
 {
+    JNI_PROBE();
     try {
         JStringAccessor value(env, j_value);
         std::string string_value(value);
@@ -73,6 +81,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddInteger
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jlong j_value)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(j_value);
         add_property(data_ptr, column_key, value);
@@ -83,6 +92,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddFloat
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jfloat j_value)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(j_value);
         add_property(data_ptr, column_key, value);
@@ -93,6 +103,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddDouble
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jdouble j_value)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(j_value);
         add_property(data_ptr, column_key, value);
@@ -103,6 +114,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddBoolean
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jboolean j_value)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(j_value);
         add_property(data_ptr, column_key, value);
@@ -113,8 +125,9 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddByteArray
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jbyteArray j_value)
 {
+    JNI_PROBE();
     try {
-        auto data = OwnedBinaryData(JByteArrayAccessor(env, j_value).transform<BinaryData>());
+        auto data = OwnedBinaryData(JByteArrayCriticalAccessor(env, j_value).transform<BinaryData>());
         const JavaValue value(data);
         add_property(data_ptr, column_key, value);
     }
@@ -124,6 +137,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddDate
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jlong j_value)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(from_milliseconds(j_value));
         add_property(data_ptr, column_key, value);
@@ -134,6 +148,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddDecimal128
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jlong j_low_value, jlong j_high_value)
 {
+    JNI_PROBE();
     try {
         Decimal128::Bid128 raw {static_cast<uint64_t>(j_low_value), static_cast<uint64_t>(j_high_value)};
         Decimal128 decimal128 = Decimal128(raw);
@@ -146,6 +161,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddObjectId
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jstring j_data)
 {
+    JNI_PROBE();
     try {
         JStringAccessor data(env, j_data);
         ObjectId objectId = ObjectId(StringData(data).data());
@@ -158,6 +174,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddObject
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jlong row_ptr)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(reinterpret_cast<Obj*>(row_ptr));
         add_property(data_ptr, column_key, value);
@@ -165,17 +182,6 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
     CATCH_STD()
 }
 
-static inline const ObjectSchema& get_schema(const Schema& schema, TableRef table)
-{
-    std::string table_name(table->get_name());
-    std::string class_name = std::string(table_name.substr(TABLE_PREFIX.length()));
-    auto it = schema.find(class_name);
-    if (it == schema.end()) {
-        throw std::runtime_error(util::format("Class '%1' cannot be found in the schema.", class_name.data()));
-    }
-    return *it;
-}
-
 JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeCreateOrUpdateTopLevelObject(JNIEnv* env,
                                                                                                               jclass,
                                                                                                               jlong shared_realm_ptr,
@@ -184,6 +190,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativ
                                                                                                               jboolean update_existing,
                                                                                                               jboolean ignore_same_values)
 {
+    JNI_PROBE();
     try {
         SharedRealm shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
 
@@ -195,13 +202,12 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativ
         }
 
         TableRef table = TBL_REF(table_ref_ptr);
-        const auto& schema = shared_realm->schema();
-        const ObjectSchema& object_schema = get_schema(schema, table);
+        const ObjectSchema& object_schema = JavaBindingContext::get_object_schema(*shared_realm, *table);
         JavaContext ctx(env, shared_realm, object_schema);
         auto list = *reinterpret_cast<OsObjectData*>(builder_ptr);
         JavaValue values = JavaValue(list);
         Object obj = Object::create(ctx, shared_realm, object_schema, values, policy);
-        return reinterpret_cast<jlong>(new Obj(obj.obj()));
+        return reinterpret_cast<jlong>(NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(obj.obj())));
     }
     CATCH_STD()
     return realm::npos;
@@ -215,18 +221,18 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativ
                                                                                                       jlong j_obj_key,
                                                                                                       jboolean ignore_same_values)
 {
+    JNI_PROBE();
     try {
         SharedRealm shared_realm = *(reinterpret_cast<SharedRealm*>(shared_realm_ptr));
         CreatePolicy policy = (ignore_same_values) ? CreatePolicy::UpdateModified : CreatePolicy::UpdateAll;
         TableRef table = TBL_REF(table_ref_ptr);
         ObjKey embedded_object_key(j_obj_key);
-        const auto& schema = shared_realm->schema();
-        const ObjectSchema& object_schema = get_schema(schema, table);
+        const ObjectSchema& object_schema = JavaBindingContext::get_object_schema(*shared_realm, *table);
         JavaContext ctx(env, shared_realm, object_schema);
         auto list = *reinterpret_cast<OsObjectData*>(builder_ptr);
         JavaValue values = JavaValue(list);
         Object obj = Object::create(ctx, shared_realm, object_schema, values, policy, embedded_object_key);
-        return reinterpret_cast<jlong>(new Obj(obj.obj()));
+        return reinterpret_cast<jlong>(NativeObjectCounter::created(NativeObjectCounter::obj, new Obj(obj.obj())));
     }
     CATCH_STD()
     return realm::npos;
@@ -235,6 +241,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativ
 JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeStartList
         (JNIEnv* env, jclass, jlong list_size)
 {
+    JNI_PROBE();
     try {
         auto list = new std::vector<JavaValue>();
         list->reserve(list_size);
@@ -247,6 +254,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativ
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeStopList
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jlong list_ptr)
 {
+    JNI_PROBE();
     try {
         auto list = reinterpret_cast<std::vector<JavaValue>*>(list_ptr);
         const JavaValue value((*list));
@@ -260,6 +268,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddObjectList
         (JNIEnv* env, jclass, jlong data_ptr, jlong column_key, jlongArray row_ptrs)
 {
+    JNI_PROBE();
     try {
         auto rows = JLongArrayAccessor(env, row_ptrs);
         auto list = std::vector<JavaValue>();
@@ -283,6 +292,7 @@ static inline void add_list_element(jlong list_ptr, JavaValue const& value)
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddNullListItem
         (JNIEnv* env, jclass, jlong list_ptr)
 {
+    JNI_PROBE();
     try {
         const JavaValue value = JavaValue();
         add_list_element(list_ptr, value);
@@ -293,6 +303,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddIntegerListItem
         (JNIEnv* env, jclass, jlong list_ptr, jlong j_value)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(j_value);
         add_list_element(list_ptr, value);
@@ -303,6 +314,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddStringListItem
     (JNIEnv* env, jclass, jlong list_ptr, jstring j_value)
 {
+    JNI_PROBE();
     try {
         JStringAccessor value(env, j_value);
         std::string string_value(value);
@@ -315,6 +327,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddFloatListItem
         (JNIEnv* env, jclass, jlong list_ptr, jfloat j_value)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(j_value);
         add_list_element(list_ptr, value);
@@ -325,6 +338,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddDoubleListItem
         (JNIEnv* env, jclass, jlong list_ptr, jdouble j_value)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(j_value);
         add_list_element(list_ptr, value);
@@ -335,6 +349,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddBooleanListItem
         (JNIEnv* env, jclass, jlong list_ptr, jboolean j_value)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(j_value);
         add_list_element(list_ptr, value);
@@ -345,8 +360,9 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddByteArrayListItem
         (JNIEnv* env, jclass, jlong list_ptr, jbyteArray j_value)
 {
+    JNI_PROBE();
     try {
-        auto data = OwnedBinaryData(JByteArrayAccessor(env, j_value).transform<BinaryData>());
+        auto data = OwnedBinaryData(JByteArrayCriticalAccessor(env, j_value).transform<BinaryData>());
         const JavaValue value(data);
         add_list_element(list_ptr, value);
     }
@@ -356,6 +372,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddDateListItem
         (JNIEnv* env, jclass, jlong list_ptr, jlong j_value)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(from_milliseconds(j_value));
         add_list_element(list_ptr, value);
@@ -366,6 +383,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddObjectListItem
         (JNIEnv* env, jclass, jlong list_ptr, jlong row_ptr)
 {
+    JNI_PROBE();
     try {
         const JavaValue value(reinterpret_cast<Obj*>(row_ptr));
         add_list_element(list_ptr, value);
@@ -376,6 +394,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddDecimal128ListItem
         (JNIEnv* env, jclass, jlong list_ptr, jlong j_low_value, jlong j_high_value)
 {
+    JNI_PROBE();
     try {
         Decimal128::Bid128 raw {static_cast<uint64_t>(j_low_value), static_cast<uint64_t>(j_high_value)};
         Decimal128 decimal128 = Decimal128(raw);
@@ -388,6 +407,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_native
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsObjectBuilder_nativeAddObjectIdListItem
         (JNIEnv* env, jclass, jlong list_ptr, jstring j_data)
 {
+    JNI_PROBE();
     try {
         JStringAccessor data(env, j_data);
         ObjectId objectId = ObjectId(StringData(data).data());
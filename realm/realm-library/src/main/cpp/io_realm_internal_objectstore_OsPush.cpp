@@ -38,6 +38,7 @@ static void finalize_push_client(jlong ptr) {
 
 JNIEXPORT jlong JNICALL
 Java_io_realm_internal_objectstore_OsPush_nativeGetFinalizerMethodPtr(JNIEnv*, jclass) {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_push_client);
 }
 
@@ -46,6 +47,7 @@ Java_io_realm_internal_objectstore_OsPush_nativeCreate(JNIEnv* env,
                                                        jclass,
                                                        jlong j_app_ptr,
                                                        jstring j_service_name) {
+    JNI_PROBE();
     try {
         std::shared_ptr<App> &app = *reinterpret_cast<std::shared_ptr<App> *>(j_app_ptr);
         JStringAccessor service_name(env, j_service_name);
@@ -64,6 +66,7 @@ Java_io_realm_internal_objectstore_OsPush_nativeRegisterDevice(JNIEnv *env,
                                                                jstring j_service_name,
                                                                jstring j_registration_token,
                                                                jobject j_callback) {
+    JNI_PROBE();
     try {
         auto push_client = reinterpret_cast<PushClient*>(j_push_client_ptr);
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
@@ -85,6 +88,7 @@ Java_io_realm_internal_objectstore_OsPush_nativeDeregisterDevice(JNIEnv *env,
                                                                jlong j_user_ptr,
                                                                jstring j_service_name,
                                                                jobject j_callback) {
+    JNI_PROBE();
     try {
         auto push_client = reinterpret_cast<PushClient*>(j_push_client_ptr);
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
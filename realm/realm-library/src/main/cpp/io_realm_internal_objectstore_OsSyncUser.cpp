@@ -37,11 +37,13 @@ static void finalize_user(jlong ptr)
 
 JNIEXPORT jlong JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetFinalizerMethodPtr(JNIEnv*, jclass)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_user);
 }
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetName(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->user_profile().name);
@@ -52,6 +54,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetEmail(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->user_profile().email);
@@ -62,6 +65,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetPictureUrl(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->user_profile().picture_url);
@@ -72,6 +76,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetFirstName(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->user_profile().first_name);
@@ -82,6 +87,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetLastName(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->user_profile().last_name);
@@ -92,6 +98,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetGender(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->user_profile().gender);
@@ -102,6 +109,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetBirthday(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->user_profile().birthday);
@@ -112,6 +120,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetMinAge(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->user_profile().min_age);
@@ -122,6 +131,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetMaxAge(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->user_profile().max_age);
@@ -132,6 +142,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetAccessToken(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         std::string token = user->access_token();
@@ -143,6 +154,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetRefreshToken(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         std::string token = user->refresh_token();
@@ -154,6 +166,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jobjectArray JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetIdentities(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         std::vector<SyncUserIdentity> ids = user->identities();
@@ -177,6 +190,7 @@ JNIEXPORT jobjectArray JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nat
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetIdentity(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->identity());
@@ -187,6 +201,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetLocalIdentity(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->local_identity());
@@ -198,6 +213,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jbyte JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetState(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         switch(user->state()) {
@@ -214,6 +230,7 @@ JNIEXPORT jbyte JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetS
 
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeSetState(JNIEnv* env, jclass, jlong j_native_ptr, jbyte j_state)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         switch(j_state) {
@@ -235,6 +252,7 @@ JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeSetSt
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetProviderType(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         return to_jstring(env, user->provider_type());
@@ -245,6 +263,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
 
 JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGetDeviceId(JNIEnv* env, jclass, jlong j_native_ptr)
 {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         std::string device_id = user->device_id();
@@ -254,23 +273,25 @@ JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeGe
     return nullptr;
 }
 
-JNIEXPORT jstring JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeCustomData(JNIEnv* env, jclass, jlong j_native_ptr) {
+JNIEXPORT jbyteArray JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeCustomData(JNIEnv* env, jclass, jlong j_native_ptr) {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         const util::Optional<bson::BsonDocument> custom_data(user->custom_data());
         if (custom_data) {
-            return JniBsonProtocol::bson_to_jstring(env, *custom_data);
+            return JniBsonProtocol::bson_to_jbytes(env, *custom_data);
         } else {
-            return JniBsonProtocol::bson_to_jstring(env, BsonDocument());
+            return JniBsonProtocol::bson_to_jbytes(env, BsonDocument());
         }
     }
     CATCH_STD()
-    return JniBsonProtocol::bson_to_jstring(env, BsonDocument());
+    return nullptr;
 }
 
 
 JNIEXPORT void JNICALL Java_io_realm_internal_objectstore_OsSyncUser_nativeRefreshCustomData
         (JNIEnv* env, jclass, jlong j_native_ptr, jobject j_callback) {
+    JNI_PROBE();
     try {
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_native_ptr);
         std::function<void(util::Optional<app::AppError>)> callback = JavaNetworkTransport::create_void_callback(env, j_callback);
@@ -16,6 +16,8 @@
 
 #include "io_realm_internal_objectstore_OsWatchStream.h"
 
+#include <cstring>
+
 #include "java_class_global_def.hpp"
 #include "jni_util/bson_util.hpp"
 
@@ -27,64 +29,118 @@ using namespace realm::bson;
 using namespace realm::jni_util;
 using namespace realm::_impl;
 
+namespace {
+
+// Splits the raw body of the change stream into lines and collects the events of the WatchStream, so Java can feed
+// whole network reads and fetch all events they contain at once.
+struct JavaWatchStream {
+    WatchStream stream;
+    // The start of a line that hasn't been terminated yet by the data fed so far.
+    std::string partial_line;
+    BsonArray events;
+
+    void feed(const char* data, size_t size)
+    {
+        const char* end = data + size;
+        while (data < end && stream.state() != WatchStream::HAVE_ERROR) {
+            const char* newline = static_cast<const char*>(std::memchr(data, '\n', end - data));
+            if (!newline) {
+                partial_line.append(data, end);
+                return;
+            }
+            partial_line.append(data, newline);
+            data = newline + 1;
+            // Lines can be terminated by \r\n as well.
+            if (!partial_line.empty() && partial_line.back() == '\r') {
+                partial_line.pop_back();
+            }
+            stream.feed_line(partial_line);
+            partial_line.clear();
+            if (stream.state() == WatchStream::HAVE_EVENT) {
+                events.push_back(stream.next_event());
+            }
+        }
+    }
+
+    jint state() const
+    {
+        if (!events.empty()) {
+            return io_realm_internal_objectstore_OsWatchStream_HAVE_EVENT;
+        }
+        if (stream.state() == WatchStream::HAVE_ERROR) {
+            return io_realm_internal_objectstore_OsWatchStream_HAVE_ERROR;
+        }
+        return io_realm_internal_objectstore_OsWatchStream_NEED_DATA;
+    }
+};
+
+} // anonymous namespace
+
 static void finalize_watchstream(jlong ptr) {
-    delete reinterpret_cast<WatchStream *>(ptr);
+    delete reinterpret_cast<JavaWatchStream *>(ptr);
 }
 
 JNIEXPORT jlong JNICALL
 Java_io_realm_internal_objectstore_OsWatchStream_nativeGetFinalizerMethodPtr(JNIEnv *, jclass) {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(&finalize_watchstream);
 }
 
 JNIEXPORT jlong JNICALL
 Java_io_realm_internal_objectstore_OsWatchStream_nativeCreateWatchStream(JNIEnv *env, jclass) {
+    JNI_PROBE();
     try {
-        return (jlong) new WatchStream();
+        return reinterpret_cast<jlong>(new JavaWatchStream());
     }
     CATCH_STD()
 
     return 0;
 }
 
-JNIEXPORT void JNICALL
-Java_io_realm_internal_objectstore_OsWatchStream_nativeFeedLine(JNIEnv *env, jclass,
-                                                                jlong j_watch_stream_ptr,
-                                                                jstring j_line) {
+JNIEXPORT jint JNICALL
+Java_io_realm_internal_objectstore_OsWatchStream_nativeFeedBytes(JNIEnv *env, jclass,
+                                                                 jlong j_watch_stream_ptr,
+                                                                 jobject j_buffer,
+                                                                 jint j_length) {
+    JNI_PROBE();
     try {
-        WatchStream *watch_stream = reinterpret_cast<WatchStream *>(j_watch_stream_ptr);
-        JStringAccessor line(env, j_line);
+        JavaWatchStream *watch_stream = reinterpret_cast<JavaWatchStream *>(j_watch_stream_ptr);
 
-        watch_stream->feed_line(std::string(line));
+        auto data = static_cast<const char *>(env->GetDirectBufferAddress(j_buffer));
+        if (!data || j_length < 0 || j_length > env->GetDirectBufferCapacity(j_buffer)) {
+            ThrowException(env, IllegalArgument, "A direct buffer holding the given number of bytes is required.");
+            return io_realm_internal_objectstore_OsWatchStream_HAVE_ERROR;
+        }
+        watch_stream->feed(data, static_cast<size_t>(j_length));
+        return watch_stream->state();
     }
     CATCH_STD()
+
+    return io_realm_internal_objectstore_OsWatchStream_HAVE_ERROR;
 }
 
-JNIEXPORT jstring JNICALL
+JNIEXPORT jint JNICALL
 Java_io_realm_internal_objectstore_OsWatchStream_nativeGetState(JNIEnv *env, jclass,
                                                                 jlong j_watch_stream_ptr) {
+    JNI_PROBE();
     try {
-        WatchStream *watch_stream = reinterpret_cast<WatchStream *>(j_watch_stream_ptr);
-
-        switch (watch_stream->state()) {
-            case WatchStream::NEED_DATA:
-                return env->NewStringUTF("NEED_DATA");
-            case WatchStream::HAVE_EVENT:
-                return env->NewStringUTF("HAVE_EVENT");
-            case WatchStream::HAVE_ERROR:
-                return env->NewStringUTF("HAVE_ERROR");
-        }
+        JavaWatchStream *watch_stream = reinterpret_cast<JavaWatchStream *>(j_watch_stream_ptr);
+        return watch_stream->state();
     }
     CATCH_STD()
 
-    return nullptr;
+    return io_realm_internal_objectstore_OsWatchStream_HAVE_ERROR;
 }
 
-JNIEXPORT jstring JNICALL
-Java_io_realm_internal_objectstore_OsWatchStream_nativeGetNextEvent(JNIEnv *env, jclass,
-                                                                    jlong j_watch_stream_ptr) {
+JNIEXPORT jbyteArray JNICALL
+Java_io_realm_internal_objectstore_OsWatchStream_nativeDrainEvents(JNIEnv *env, jclass,
+                                                                   jlong j_watch_stream_ptr) {
+    JNI_PROBE();
     try {
-        WatchStream *watch_stream = reinterpret_cast<WatchStream *>(j_watch_stream_ptr);
-        return JniBsonProtocol::bson_to_jstring(env, watch_stream->next_event());
+        JavaWatchStream *watch_stream = reinterpret_cast<JavaWatchStream *>(j_watch_stream_ptr);
+        BsonArray events;
+        events.swap(watch_stream->events);
+        return JniBsonProtocol::bson_to_jbytes(env, events);
     }
     CATCH_STD()
 
@@ -95,34 +151,16 @@ Java_io_realm_internal_objectstore_OsWatchStream_nativeGetNextEvent(JNIEnv *env,
 JNIEXPORT jthrowable JNICALL
 Java_io_realm_internal_objectstore_OsWatchStream_nativeGetError(JNIEnv *env, jclass,
                                                                 jlong j_watch_stream_ptr) {
+    JNI_PROBE();
     try {
-        WatchStream *watch_stream = reinterpret_cast<WatchStream *>(j_watch_stream_ptr);
-
-        auto app_error = watch_stream->error();
-
-        jstring error_code_category = env->NewStringUTF(app_error.error_code.category().name());
-        jstring error_code_message = env->NewStringUTF(app_error.error_code.message().c_str());
+        JavaWatchStream *watch_stream = reinterpret_cast<JavaWatchStream *>(j_watch_stream_ptr);
 
-        jstring app_error_message = env->NewStringUTF(app_error.message.c_str());
+        auto app_error = watch_stream->stream.error();
 
-        static JavaClass app_exception_class(env, "io/realm/mongodb/AppException");
-        static JavaMethod app_exception_constructor(env, app_exception_class, "<init>",
-                                                    "(Lio/realm/mongodb/ErrorCode;Ljava/lang/String;)V");
-
-        static JavaClass error_code_class(env, "io/realm/mongodb/ErrorCode");
-        static JavaMethod error_code_constructor(env, error_code_class, "fromNativeError",
-                                                 "(Ljava/lang/String;I)Lio/realm/mongodb/ErrorCode;",
-                                                 true);
-
-        jobject j_error_code = env->CallStaticObjectMethod(error_code_class, error_code_constructor,
-                                                           error_code_category, error_code_message);
-        jobject j_app_error = env->NewObject(app_exception_class, app_exception_constructor,
-                                             j_error_code, app_error_message);
-
-        return static_cast<jthrowable>(j_app_error);
+        return JavaClassGlobalDef::new_app_exception(env, app_error.error_code.category().name(),
+                                                     app_error.error_code.value(), app_error.message);
     }
     CATCH_STD()
 
     return nullptr;
 }
-
@@ -23,6 +23,7 @@ using namespace realm::jni_util;
 
 JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeAddLogger(JNIEnv* env, jclass, jobject java_logger)
 {
+    JNI_PROBE();
     try {
         Log::shared().add_java_logger(env, java_logger);
     }
@@ -31,6 +32,7 @@ JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeAddLogger(JNIEnv* env, j
 
 JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeRemoveLogger(JNIEnv* env, jclass, jobject java_logger)
 {
+    JNI_PROBE();
     try {
         Log::shared().remove_java_logger(env, java_logger);
     }
@@ -39,6 +41,7 @@ JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeRemoveLogger(JNIEnv* env
 
 JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeClearLoggers(JNIEnv* env, jclass)
 {
+    JNI_PROBE();
     try {
         Log::shared().clear_loggers();
     }
@@ -47,6 +50,7 @@ JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeClearLoggers(JNIEnv* env
 
 JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeRegisterDefaultLogger(JNIEnv* env, jclass)
 {
+    JNI_PROBE();
     try {
         Log::shared().register_default_logger();
     }
@@ -56,6 +60,7 @@ JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeRegisterDefaultLogger(JN
 JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeLog(JNIEnv* env, jclass, jint level, jstring tag,
                                                             jthrowable throwable, jstring message)
 {
+    JNI_PROBE();
     try {
         JStringAccessor tag_accessor(env, tag);
         JStringAccessor message_accessor(env, message);
@@ -67,6 +72,7 @@ JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeLog(JNIEnv* env, jclass,
 
 JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeSetLogLevel(JNIEnv* env, jclass, jint level)
 {
+    JNI_PROBE();
     try {
         Log::shared().set_level(static_cast<Log::Level>(level));
     }
@@ -75,6 +81,7 @@ JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeSetLogLevel(JNIEnv* env,
 
 JNIEXPORT jint JNICALL Java_io_realm_log_RealmLog_nativeGetLogLevel(JNIEnv* env, jclass)
 {
+    JNI_PROBE();
     try {
         return static_cast<jint>(Log::shared().get_level());
     }
@@ -83,21 +90,39 @@ JNIEXPORT jint JNICALL Java_io_realm_log_RealmLog_nativeGetLogLevel(JNIEnv* env,
     return static_cast<jint>(Log::Level::all);
 }
 
+JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeSetAsyncDelivery(JNIEnv* env, jclass, jboolean enabled)
+{
+    JNI_PROBE();
+    try {
+        Log::shared().set_async_java_delivery(to_bool(enabled));
+    }
+    CATCH_STD()
+}
+
 // Methods for testing only.
 JNIEXPORT jlong JNICALL Java_io_realm_log_RealmLog_nativeCreateCoreLoggerBridge(JNIEnv* env, jclass, jstring tag)
 {
+    JNI_PROBE();
     return reinterpret_cast<jlong>(new CoreLoggerBridge(JStringAccessor(env, tag)));
 }
 
 JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeCloseCoreLoggerBridge(JNIEnv*, jclass, jlong native_ptr)
 {
+    JNI_PROBE();
     delete reinterpret_cast<CoreLoggerBridge*>(native_ptr);
 }
 
 JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeLogToCoreLoggerBridge(JNIEnv* env, jclass, jlong native_ptr,
                                                                               jint level, jstring msg)
 {
+    JNI_PROBE();
     CoreLoggerBridge* bridge = reinterpret_cast<CoreLoggerBridge*>(native_ptr);
     std::string message = JStringAccessor(env, msg);
     bridge->log(Log::convert_to_core_log_level(static_cast<Log::Level>(level)), message.c_str());
 }
+
+JNIEXPORT void JNICALL Java_io_realm_log_RealmLog_nativeFlushAsyncDelivery(JNIEnv*, jclass)
+{
+    JNI_PROBE();
+    Log::shared().flush_async_java_delivery();
+}
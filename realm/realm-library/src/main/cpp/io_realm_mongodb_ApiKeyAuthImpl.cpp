@@ -72,6 +72,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_ApiKeyAuthImpl_nativeCallFunction(J
                                                                    jstring j_arg,
                                                                    jobject j_callback)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
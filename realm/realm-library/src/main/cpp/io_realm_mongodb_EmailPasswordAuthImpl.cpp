@@ -36,6 +36,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_EmailPasswordAuthImpl_nativeCallFun
                                                                           jobject j_callback,
                                                                           jobjectArray j_args)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         JObjectArrayAccessor<JStringAccessor, jstring> args(env, j_args);
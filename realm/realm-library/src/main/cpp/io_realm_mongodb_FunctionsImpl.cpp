@@ -16,6 +16,7 @@
 
 #include "io_realm_mongodb_FunctionsImpl.h"
 
+#include "function_call_cache.hpp"
 #include "util.hpp"
 #include "jni_util/bson_util.hpp"
 #include "java_network_transport.hpp"
@@ -29,7 +30,7 @@ using namespace realm::jni_util;
 
 static std::function<jobject(JNIEnv*, util::Optional<Bson> )> success_mapper = [](JNIEnv* env, util::Optional<Bson> response) {
     if (response) {
-        return JniBsonProtocol::bson_to_jstring(env, *response);
+        return JniBsonProtocol::bson_to_jbytes(env, *response);
     } else {
         // We should never reach here, as this is the success mapper and we would not end up here
         // if we did not received a parsable BSON response
@@ -37,9 +38,43 @@ static std::function<jobject(JNIEnv*, util::Optional<Bson> )> success_mapper = [
     }
 };
 
+static void finalize_cache(jlong ptr)
+{
+    delete reinterpret_cast<std::shared_ptr<FunctionCallCache>*>(ptr);
+}
+
+JNIEXPORT jlong JNICALL
+Java_io_realm_mongodb_FunctionsImpl_nativeGetCacheFinalizerPtr(JNIEnv*, jclass) {
+    JNI_PROBE();
+    return reinterpret_cast<jlong>(&finalize_cache);
+}
+
+JNIEXPORT jlong JNICALL
+Java_io_realm_mongodb_FunctionsImpl_nativeCreateCache(JNIEnv* env, jclass, jlong j_ttl_ms) {
+    JNI_PROBE();
+    try {
+        auto cache = std::make_shared<FunctionCallCache>(std::chrono::milliseconds(j_ttl_ms));
+        return reinterpret_cast<jlong>(new std::shared_ptr<FunctionCallCache>(std::move(cache)));
+    }
+    CATCH_STD()
+    return 0;
+}
+
 JNIEXPORT void JNICALL
-Java_io_realm_mongodb_FunctionsImpl_nativeCallFunction(JNIEnv* env, jclass , jlong j_app_ptr, jlong j_user_ptr, jstring j_name,
-                                               jstring j_args_json , jobject j_callback) {
+Java_io_realm_mongodb_FunctionsImpl_nativeClearCache(JNIEnv* env, jclass, jlong j_cache_ptr) {
+    JNI_PROBE();
+    try {
+        auto& cache = *reinterpret_cast<std::shared_ptr<FunctionCallCache>*>(j_cache_ptr);
+        cache->clear();
+    }
+    CATCH_STD()
+}
+
+JNIEXPORT void JNICALL
+Java_io_realm_mongodb_FunctionsImpl_nativeCallFunction(JNIEnv* env, jclass , jlong j_app_ptr, jlong j_user_ptr,
+                                                       jlong j_cache_ptr, jstring j_name, jbyteArray j_args,
+                                                       jobject j_callback) {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
@@ -50,9 +85,26 @@ Java_io_realm_mongodb_FunctionsImpl_nativeCallFunction(JNIEnv* env, jclass , jlo
             callback(response, error);
         };
 
-        JStringAccessor name(env, j_name);
-        BsonArray args(JniBsonProtocol::parse_checked(env, j_args_json, Bson::Type::Array, "BSON argument must be an BsonArray"));
-        app->call_function(user, name, args, handler);
+        std::string name = JStringAccessor(env, j_name);
+        // The encoded arguments are kept, they identify the call in the cache.
+        jsize args_size = env->GetArrayLength(j_args);
+        std::string encoded_args(static_cast<size_t>(args_size), '\0');
+        env->GetByteArrayRegion(j_args, 0, args_size, reinterpret_cast<jbyte*>(&encoded_args[0]));
+        BsonArray args(JniBsonProtocol::check(JniBsonProtocol::binary_to_bson(encoded_args.data(), encoded_args.size()),
+                                              Bson::Type::Array, "BSON argument must be an BsonArray"));
+
+        if (!j_cache_ptr) {
+            app->call_function(user, name, args, handler);
+            return;
+        }
+
+        auto& cache = *reinterpret_cast<std::shared_ptr<FunctionCallCache>*>(j_cache_ptr);
+        auto current_user = app->current_user();
+        cache->set_current_user(current_user ? current_user->identity() : std::string());
+        std::string key = FunctionCallCache::make_key(user->identity(), user->refresh_token(), name, encoded_args);
+        cache->call(key, [&](FunctionCallCache::Handler completion) {
+            app->call_function(user, name, args, std::move(completion));
+        }, std::move(handler));
     }
     CATCH_STD()
 }
@@ -36,6 +36,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_User_nativeLinkUser(JNIEnv* env,
                                                              jlong j_credentials_ptr,
                                                              jobject j_callback)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
@@ -56,6 +57,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_User_nativeRemoveUser(JNIEnv* env,
                                                                jlong j_user_ptr,
                                                                jobject j_callback)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
@@ -66,6 +68,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_User_nativeRemoveUser(JNIEnv* env,
 
 JNIEXPORT void JNICALL Java_io_realm_mongodb_User_nativeLogOut(JNIEnv* env, jclass, jlong j_app_ptr, jlong j_user_ptr, jobject j_callback)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<App>*>(j_app_ptr);
         auto user = *reinterpret_cast<std::shared_ptr<SyncUser>*>(j_user_ptr);
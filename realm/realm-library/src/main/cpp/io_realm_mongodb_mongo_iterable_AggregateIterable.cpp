@@ -18,6 +18,7 @@
 
 #include "java_class_global_def.hpp"
 #include "java_network_transport.hpp"
+#include "mongo_pagination.hpp"
 #include "util.hpp"
 #include "jni_util/java_method.hpp"
 #include "jni_util/jni_utils.hpp"
@@ -35,15 +36,16 @@ using namespace realm::jni_util;
 using namespace realm::_impl;
 
 static std::function<jobject(JNIEnv*, util::Optional<bson::BsonArray>)> collection_mapper_aggregate = [](JNIEnv* env, util::Optional<bson::BsonArray> array) {
-    return array ? JniBsonProtocol::bson_to_jstring(env, *array) : NULL;
+    return array ? JniBsonProtocol::bson_to_jbytes(env, *array) : NULL;
 };
 
 JNIEXPORT void JNICALL
 Java_io_realm_mongodb_mongo_iterable_AggregateIterable_nativeAggregate(JNIEnv* env,
                                                                        jclass,
                                                                        jlong j_collection_ptr,
-                                                                       jstring j_pipeline,
+                                                                       jbyteArray j_pipeline,
                                                                        jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection *>(j_collection_ptr);
 
@@ -53,3 +55,37 @@ Java_io_realm_mongodb_mongo_iterable_AggregateIterable_nativeAggregate(JNIEnv* e
     }
     CATCH_STD()
 }
+
+// Pages are fetched by running the pipeline again with stages appended which match only the documents after the sort
+// key of the last document of the previous page (the continuation), sort the output by "_id" and limit the number
+// of documents returned.
+JNIEXPORT void JNICALL
+Java_io_realm_mongodb_mongo_iterable_AggregateIterable_nativeAggregatePage(JNIEnv* env,
+                                                                           jclass,
+                                                                           jlong j_collection_ptr,
+                                                                           jbyteArray j_pipeline,
+                                                                           jbyteArray j_continuation,
+                                                                           jlong j_page_size,
+                                                                           jobject j_callback) {
+    JNI_PROBE();
+    try {
+        auto collection = reinterpret_cast<MongoCollection *>(j_collection_ptr);
+
+        BsonArray pipeline(JniBsonProtocol::parse_checked(env, j_pipeline, Bson::Type::Array, "BSON pipeline must be a BsonArray"));
+        BsonDocument sort(MongoPagination::unique_sort(BsonDocument()));
+        uint64_t page_size = std::uint64_t(j_page_size);
+
+        if (j_continuation) {
+            BsonDocument continuation(JniBsonProtocol::parse_checked(env, j_continuation, Bson::Type::Document, "BSON continuation must be a Document"));
+            pipeline.push_back(BsonDocument({{"$match", continuation}}));
+        }
+        pipeline.push_back(BsonDocument({{"$sort", sort}}));
+        pipeline.push_back(BsonDocument({{"$limit", Bson(static_cast<int64_t>(page_size))}}));
+
+        std::function<jobject(JNIEnv*, util::Optional<bson::BsonArray>)> mapper = [sort, page_size](JNIEnv* env, util::Optional<bson::BsonArray> array) {
+            return array ? JniBsonProtocol::bson_to_jbytes(env, MongoPagination::page(std::move(*array), sort, page_size)) : NULL;
+        };
+        collection->aggregate(pipeline, JavaNetworkTransport::create_result_callback(env, j_callback, mapper));
+    }
+    CATCH_STD()
+}
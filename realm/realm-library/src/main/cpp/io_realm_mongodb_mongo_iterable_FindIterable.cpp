@@ -18,6 +18,7 @@
 
 #include "java_class_global_def.hpp"
 #include "java_network_transport.hpp"
+#include "mongo_pagination.hpp"
 #include "util.hpp"
 #include "jni_util/java_method.hpp"
 #include "jni_util/jni_utils.hpp"
@@ -34,7 +35,7 @@ using namespace realm::jni_util;
 using namespace realm::_impl;
 
 static std::function<jobject(JNIEnv*, util::Optional<bson::BsonArray>)> collection_mapper_find = [](JNIEnv* env, util::Optional<bson::BsonArray> array) {
-    return array ? JniBsonProtocol::bson_to_jstring(env, *array) : NULL;
+    return array ? JniBsonProtocol::bson_to_jbytes(env, *array) : NULL;
 };
 
 JNIEXPORT void JNICALL
@@ -42,11 +43,12 @@ Java_io_realm_mongodb_mongo_iterable_FindIterable_nativeFind(JNIEnv *env,
                                                              jclass,
                                                              jint j_find_type,
                                                              jlong j_collection_ptr,
-                                                             jstring j_filter,
-                                                             jstring j_projection,
-                                                             jstring j_sort,
+                                                             jbyteArray j_filter,
+                                                             jbyteArray j_projection,
+                                                             jbyteArray j_sort,
                                                              jlong j_limit,
                                                              jobject j_callback) {
+    JNI_PROBE();
     try {
         auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
 
@@ -71,3 +73,39 @@ Java_io_realm_mongodb_mongo_iterable_FindIterable_nativeFind(JNIEnv *env,
     }
     CATCH_STD()
 }
+
+JNIEXPORT void JNICALL
+Java_io_realm_mongodb_mongo_iterable_FindIterable_nativeFindPage(JNIEnv* env,
+                                                                 jclass,
+                                                                 jlong j_collection_ptr,
+                                                                 jbyteArray j_filter,
+                                                                 jbyteArray j_projection,
+                                                                 jbyteArray j_sort,
+                                                                 jbyteArray j_continuation,
+                                                                 jlong j_page_size,
+                                                                 jobject j_callback) {
+    JNI_PROBE();
+    try {
+        auto collection = reinterpret_cast<MongoCollection*>(j_collection_ptr);
+
+        bson::BsonDocument filter(JniBsonProtocol::parse_checked(env, j_filter, Bson::Type::Document, "BSON filter must be a Document"));
+        if (j_continuation) {
+            bson::BsonDocument continuation(JniBsonProtocol::parse_checked(env, j_continuation, Bson::Type::Document, "BSON continuation must be a Document"));
+            filter = MongoPagination::and_filter(filter, continuation);
+        }
+        bson::BsonDocument projection(JniBsonProtocol::parse_checked(env, j_projection, Bson::Type::Document, "BSON projection must be a Document"));
+        bson::BsonDocument sort(MongoPagination::unique_sort(bson::BsonDocument(
+                JniBsonProtocol::parse_checked(env, j_sort, Bson::Type::Document, "BSON sort must be a Document"))));
+        uint64_t page_size = std::uint64_t(j_page_size);
+        MongoCollection::FindOptions options = {
+                page_size,
+                projection,
+                sort
+        };
+        std::function<jobject(JNIEnv*, util::Optional<bson::BsonArray>)> mapper = [sort, page_size](JNIEnv* env, util::Optional<bson::BsonArray> array) {
+            return array ? JniBsonProtocol::bson_to_jbytes(env, MongoPagination::page(std::move(*array), sort, page_size)) : NULL;
+        };
+        collection->find(filter, options, JavaNetworkTransport::create_result_callback(env, j_callback, mapper));
+    }
+    CATCH_STD()
+}
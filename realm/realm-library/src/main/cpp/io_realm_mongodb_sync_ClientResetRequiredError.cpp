@@ -28,6 +28,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_ClientResetRequiredError_nativ
                                                                                                     jlong j_app_ptr,
                                                                                                     jstring localRealmPath)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         JStringAccessor local_realm_path(env, localRealmPath);
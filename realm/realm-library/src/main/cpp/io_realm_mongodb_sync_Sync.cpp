@@ -34,6 +34,7 @@ using namespace realm::util;
 
 JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_Sync_nativeReset(JNIEnv* env, jclass, jlong j_app_ptr)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         app->sync_manager()->reset_for_testing();
@@ -46,6 +47,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_Sync_nativeSimulateSyncError(J
                                                                        jint err_code, jstring err_message,
                                                                        jboolean is_fatal)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         JStringAccessor path(env, local_realm_path);
@@ -64,6 +66,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_Sync_nativeSimulateSyncError(J
 
 JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_Sync_nativeReconnect(JNIEnv* env, jclass, jlong j_app_ptr)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         app->sync_manager()->reconnect();
@@ -73,6 +76,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_Sync_nativeReconnect(JNIEnv* e
 
 JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_Sync_nativeCreateSession(JNIEnv* env, jclass, jlong j_native_config_ptr)
 {
+    JNI_PROBE();
     try {
         auto& config = *reinterpret_cast<Realm::Config*>(j_native_config_ptr);
         _impl::RealmCoordinator::get_coordinator(config)->create_session(config);
@@ -87,6 +91,7 @@ JNIEXPORT jstring JNICALL Java_io_realm_mongodb_sync_Sync_nativeGetPathForRealm(
                                                                                 jstring j_encoded_partition_value,
                                                                                 jstring j_override_filename)
 {
+    JNI_PROBE();
     try {
         // This is a little bit of a hack. Normally Realm Java doesn't generate the C++ SyncConfig
         // until the Realm is opened, but the Sync API for creating the Realm path require that
@@ -15,6 +15,9 @@
  */
 
 #include <jni.h>
+#include <chrono>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "io_realm_mongodb_sync_SyncSession.h"
@@ -25,6 +28,7 @@
 
 #include "util.hpp"
 #include "java_class_global_def.hpp"
+#include "sync_session_metrics.hpp"
 #include "jni_util/java_global_ref_by_move.hpp"
 #include "jni_util/java_global_ref_by_copy.hpp"
 #include "jni_util/java_local_ref.hpp"
@@ -47,6 +51,8 @@ static_assert(SyncSession::PublicState::Inactive ==
                   static_cast<SyncSession::PublicState>(io_realm_mongodb_sync_SyncSession_STATE_VALUE_INACTIVE),
               "");
 
+static_assert(SyncSessionMetrics::value_count == io_realm_mongodb_sync_SyncSession_METRICS_VALUE_COUNT, "");
+
 static_assert(SyncSession::ConnectionState::Disconnected ==
               static_cast<SyncSession::ConnectionState >(io_realm_mongodb_sync_SyncSession_CONNECTION_VALUE_DISCONNECTED),
               "");
@@ -57,15 +63,65 @@ static_assert(SyncSession::ConnectionState::Connected ==
               static_cast<SyncSession::ConnectionState>(io_realm_mongodb_sync_SyncSession_CONNECTION_VALUE_CONNECTED),
               "");
 
+namespace {
+
+// Coalesces the progress events of a listener before they are passed to Java. An event is only passed on once both
+// the minimum interval has passed and the minimum number of bytes has been transferred since the last event passed
+// on. The first event and the events completing a transfer are always passed on, unless nothing changed.
+//
+// Events are reported from the sync client thread, but the first one can be reported while registering the listener.
+class ProgressThrottle {
+public:
+    ProgressThrottle(std::chrono::milliseconds min_interval, uint64_t min_bytes)
+        : m_min_interval(min_interval)
+        , m_min_bytes(min_bytes)
+    {
+    }
+
+    bool should_notify(uint64_t transferred, uint64_t transferrable)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto now = std::chrono::steady_clock::now();
+        if (m_notified) {
+            if (transferred == m_transferred && transferrable == m_transferrable) {
+                return false;
+            }
+            bool complete = transferred >= transferrable;
+            uint64_t delta = transferred > m_transferred ? transferred - m_transferred : m_transferred - transferred;
+            if (!complete && (now - m_last_notification < m_min_interval || delta < m_min_bytes)) {
+                return false;
+            }
+        }
+        m_notified = true;
+        m_transferred = transferred;
+        m_transferrable = transferrable;
+        m_last_notification = now;
+        return true;
+    }
+
+private:
+    const std::chrono::milliseconds m_min_interval;
+    const uint64_t m_min_bytes;
+    std::mutex m_mutex;
+    bool m_notified = false;
+    uint64_t m_transferred = 0;
+    uint64_t m_transferrable = 0;
+    std::chrono::steady_clock::time_point m_last_notification;
+};
+
+} // anonymous namespace
+
 JNIEXPORT jlong JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeAddProgressListener(JNIEnv* env, jobject j_session_object,
                                                                                          jlong j_app_ptr,
                                                                                          jstring j_local_realm_path,
                                                                                          jlong listener_id, jint direction,
-                                                                                         jboolean is_streaming)
+                                                                                         jboolean is_streaming,
+                                                                                         jlong j_min_interval_ms,
+                                                                                         jlong j_min_transferred_bytes)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
-        // JNIEnv is thread confined, so we need a deep copy in order to capture the string in the lambda
         std::string local_realm_path(JStringAccessor(env, j_local_realm_path));
         std::shared_ptr<SyncSession> session = app->sync_manager()->get_existing_session(local_realm_path);
         if (!session) {
@@ -78,15 +134,17 @@ JNIEXPORT jlong JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeAddProgress
 
         SyncSession::NotifierType type = (direction == 1) ? SyncSession::NotifierType::download : SyncSession::NotifierType::upload;
 
-        static JavaClass java_syncsession_class(env, "io/realm/mongodb/sync/SyncSession");
-        static JavaMethod java_notify_progress_listener(env, java_syncsession_class, "notifyProgressListener", "(JJJ)V");
-
-        auto callback = [session_ref = JavaGlobalRefByCopy(env, j_session_object), local_realm_path, listener_id](uint64_t transferred, uint64_t transferrable) {
+        // Shared by the copies of the callback.
+        auto throttle = std::make_shared<ProgressThrottle>(std::chrono::milliseconds(j_min_interval_ms),
+                                                           static_cast<uint64_t>(j_min_transferred_bytes));
+        auto callback = [session_ref = JavaGlobalRefByCopy(env, j_session_object), listener_id, throttle](uint64_t transferred, uint64_t transferrable) {
+            if (!throttle->should_notify(transferred, transferrable)) {
+                return;
+            }
             JNIEnv* local_env = jni_util::JniUtils::get_env(true);
 
-            JavaLocalRef<jstring> path(local_env, to_jstring(local_env, local_realm_path));
             local_env->CallVoidMethod(session_ref.get(),
-                    java_notify_progress_listener,
+                    JavaClassGlobalDef::sync_session_notify_progress_listener(local_env),
                     listener_id,
                     static_cast<jlong>(transferred),
                     static_cast<jlong>(transferrable));
@@ -113,6 +171,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeRemoveProgre
                                                                               jstring j_local_realm_path,
                                                                               jlong listener_token)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         JStringAccessor local_realm_path(env, j_local_realm_path);
@@ -130,16 +189,13 @@ JNIEXPORT jboolean JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeWaitForD
                                                                                      jint callback_id,
                                                                                      jstring j_local_realm_path)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         JStringAccessor local_realm_path(env, j_local_realm_path);
         auto session = app->sync_manager()->get_existing_session(local_realm_path);
 
         if (session) {
-            static JavaClass java_sync_session_class(env, "io/realm/mongodb/sync/SyncSession");
-            static JavaMethod java_notify_result_method(env, java_sync_session_class, "notifyAllChangesSent",
-                                                        "(ILjava/lang/String;Ljava/lang/Long;Ljava/lang/String;)V");
-
             session->wait_for_download_completion([session_ref = JavaGlobalRefByCopy(env, session_object), callback_id](std::error_code error) {
                 JNIEnv* env = JniUtils::get_env(true);
                 JavaLocalRef<jstring> java_error_category;
@@ -150,7 +206,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeWaitForD
                     java_error_code = JavaLocalRef<jobject>(env, JavaClassGlobalDef::new_long(env, error.value()));
                     java_error_message = JavaLocalRef<jstring>(env, env->NewStringUTF(error.message().c_str()));
                 }
-                env->CallVoidMethod(session_ref.get(), java_notify_result_method,
+                env->CallVoidMethod(session_ref.get(), JavaClassGlobalDef::sync_session_notify_all_changes_sent(env),
                                     callback_id, java_error_category.get(), java_error_code.get(), java_error_message.get());
             });
             return to_jbool(JNI_TRUE);
@@ -166,16 +222,13 @@ JNIEXPORT jboolean JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeWaitForU
                                                                                    jint callback_id,
                                                                                    jstring j_local_realm_path)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         JStringAccessor local_realm_path(env, j_local_realm_path);
         auto session = app->sync_manager()->get_existing_session(local_realm_path);
 
         if (session) {
-            static JavaClass java_sync_session_class(env, "io/realm/mongodb/sync/SyncSession");
-            static JavaMethod java_notify_result_method(env, java_sync_session_class, "notifyAllChangesSent",
-                                                        "(ILjava/lang/String;Ljava/lang/Long;Ljava/lang/String;)V");
-
             session->wait_for_upload_completion([session_ref = JavaGlobalRefByCopy(env, session_object), callback_id] (std::error_code error) {
                 JNIEnv* env = JniUtils::get_env(true);
                 JavaLocalRef<jstring> java_error_category;
@@ -186,7 +239,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeWaitForU
                     java_error_code = JavaLocalRef<jobject>(env, JavaClassGlobalDef::new_long(env, error.value()));
                     java_error_message = JavaLocalRef<jstring>(env, env->NewStringUTF(error.message().c_str()));
                 }
-                env->CallVoidMethod(session_ref.get(), java_notify_result_method,
+                env->CallVoidMethod(session_ref.get(), JavaClassGlobalDef::sync_session_notify_all_changes_sent(env),
                                     callback_id, java_error_category.get(), java_error_code.get(), java_error_message.get());
             });
             return JNI_TRUE;
@@ -199,6 +252,7 @@ JNIEXPORT jboolean JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeWaitForU
 
 JNIEXPORT jbyte JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeGetState(JNIEnv* env, jclass, jlong j_app_ptr, jstring j_local_realm_path)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         JStringAccessor local_realm_path(env, j_local_realm_path);
@@ -221,6 +275,7 @@ JNIEXPORT jbyte JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeGetState(JN
 
 JNIEXPORT jbyte JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeGetConnectionState(JNIEnv* env, jclass, jlong j_app_ptr, jstring j_local_realm_path)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         JStringAccessor local_realm_path(env, j_local_realm_path);
@@ -252,6 +307,7 @@ static jlong get_connection_value(SyncSession::ConnectionState state) {
 
 JNIEXPORT jlong JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeAddConnectionListener(JNIEnv* env, jobject j_session_object, jlong j_app_ptr, jstring j_local_realm_path)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         // JNIEnv is thread confined, so we need a deep copy in order to capture the string in the lambda
@@ -265,16 +321,13 @@ JNIEXPORT jlong JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeAddConnecti
             return 0;
         }
 
-        static JavaClass java_syncmanager_class(env, "io/realm/mongodb/sync/SyncSession");
-        static JavaMethod java_notify_connection_listener(env, java_syncmanager_class, "notifyConnectionListeners", "(JJ)V");
-
         std::function<SyncSession::ConnectionStateCallback > callback = [session_ref = JavaGlobalRefByCopy(env, j_session_object)](SyncSession::ConnectionState old_state, SyncSession::ConnectionState new_state) {
             JNIEnv* local_env = jni_util::JniUtils::get_env(true);
 
             jlong old_connection_value = get_connection_value(old_state);
             jlong new_connection_value = get_connection_value(new_state);
 
-            local_env->CallVoidMethod(session_ref.get(), java_notify_connection_listener,
+            local_env->CallVoidMethod(session_ref.get(), JavaClassGlobalDef::sync_session_notify_connection_listeners(local_env),
                                         old_connection_value, new_connection_value);
 
             // All exceptions will be caught on the Java side of handlers, but Errors will still end
@@ -296,6 +349,7 @@ JNIEXPORT jlong JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeAddConnecti
 
 JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeRemoveConnectionListener(JNIEnv* env, jclass, jlong j_app_ptr, jlong listener_id, jstring j_local_realm_path)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         // JNIEnv is thread confined, so we need a deep copy in order to capture the string in the lambda
@@ -310,6 +364,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeRemoveConnec
 
 JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeStart(JNIEnv* env, jclass, jlong j_app_ptr, jstring j_local_realm_path)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         JStringAccessor local_realm_path(env, j_local_realm_path);
@@ -328,6 +383,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeStart(JNIEnv
 
 JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeStop(JNIEnv* env, jclass, jlong j_app_ptr, jstring j_local_realm_path)
 {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         JStringAccessor local_realm_path(env, j_local_realm_path);
@@ -340,6 +396,7 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeStop(JNIEnv*
 }
 
 JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeShutdownAndWait (JNIEnv* env, jclass, jlong j_app_ptr, jstring j_local_realm_path) {
+    JNI_PROBE();
     try {
         auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
         JStringAccessor local_realm_path(env, j_local_realm_path);
@@ -350,3 +407,89 @@ JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeShutdownAndW
     }
     CATCH_STD()
 }
+
+static void finalize_metrics(jlong ptr)
+{
+    delete reinterpret_cast<SyncSessionMetrics*>(ptr);
+}
+
+JNIEXPORT jlong JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeGetMetricsFinalizerPtr(JNIEnv*, jclass)
+{
+    JNI_PROBE();
+    return reinterpret_cast<jlong>(&finalize_metrics);
+}
+
+JNIEXPORT jlong JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeCreateMetrics(JNIEnv* env, jclass, jlong j_app_ptr, jstring j_local_realm_path)
+{
+    JNI_PROBE();
+    try {
+        auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
+        JStringAccessor local_realm_path(env, j_local_realm_path);
+        auto session = app->sync_manager()->get_existing_session(local_realm_path);
+        if (session) {
+            return reinterpret_cast<jlong>(new SyncSessionMetrics(std::move(session)));
+        }
+    }
+    CATCH_STD()
+    return 0;
+}
+
+// Closing and reopening the Realm replaces the native session, so the metrics follow the current one.
+static SyncSessionMetrics& attached_metrics(JNIEnv* env, jlong j_app_ptr, jstring j_local_realm_path,
+                                            jlong j_metrics_ptr)
+{
+    auto& metrics = *reinterpret_cast<SyncSessionMetrics*>(j_metrics_ptr);
+    auto app = *reinterpret_cast<std::shared_ptr<app::App>*>(j_app_ptr);
+    JStringAccessor local_realm_path(env, j_local_realm_path);
+    if (auto session = app->sync_manager()->get_existing_session(local_realm_path)) {
+        metrics.attach(std::move(session));
+    }
+    return metrics;
+}
+
+JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeAttachMetrics(JNIEnv* env, jclass,
+                                                                                  jlong j_app_ptr,
+                                                                                  jstring j_local_realm_path,
+                                                                                  jlong j_metrics_ptr)
+{
+    JNI_PROBE();
+    try {
+        attached_metrics(env, j_app_ptr, j_local_realm_path, j_metrics_ptr);
+    }
+    CATCH_STD()
+}
+
+JNIEXPORT jlongArray JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeGetMetrics(JNIEnv* env, jclass,
+                                                                                      jlong j_app_ptr,
+                                                                                      jstring j_local_realm_path,
+                                                                                      jlong j_metrics_ptr)
+{
+    JNI_PROBE();
+    try {
+        SyncSessionMetrics::Snapshot snapshot =
+            attached_metrics(env, j_app_ptr, j_local_realm_path, j_metrics_ptr).snapshot();
+        jlongArray values = env->NewLongArray(static_cast<jsize>(snapshot.size()));
+        if (values == NULL) {
+            ThrowException(env, OutOfMemory, "Could not allocate memory to return the session metrics.");
+            return NULL;
+        }
+        static_assert(sizeof(jlong) == sizeof(int64_t), "");
+        env->SetLongArrayRegion(values, 0, static_cast<jsize>(snapshot.size()),
+                                reinterpret_cast<const jlong*>(snapshot.data()));
+        return values;
+    }
+    CATCH_STD()
+    return NULL;
+}
+
+JNIEXPORT void JNICALL Java_io_realm_mongodb_sync_SyncSession_nativeResetMetrics(JNIEnv* env, jclass,
+                                                                                 jlong j_app_ptr,
+                                                                                 jstring j_local_realm_path,
+                                                                                 jlong j_metrics_ptr)
+{
+    JNI_PROBE();
+    try {
+        attached_metrics(env, j_app_ptr, j_local_realm_path, j_metrics_ptr).reset();
+    }
+    CATCH_STD()
+}
@@ -20,8 +20,10 @@
 
 #include <jni.h>
 
-#include <vector>
+#include <algorithm>
 #include <memory>
+#include <new>
+#include <vector>
 
 #include <realm/binary_data.hpp>
 #include <realm/table.hpp>
@@ -51,25 +53,64 @@ typedef JPrimitiveArrayAccessor<jlongArray, jlong> JLongArrayAccessor;
 // memory they use. So the accessor has to be available during the life cycle of those returned objects.
 
 // Accessor for Java primitive arrays
+//
+// Small arrays, like the column key and table pointer arrays passed for every query predicate, are copied into an
+// inline buffer with Get<Type>ArrayRegion, which needs no allocation and no release call. Larger arrays are accessed
+// through Get<Type>ArrayElements. Copying an accessor acquires the elements again, so every instance releases its own.
 template <typename ArrayType, typename ElementType>
 class JPrimitiveArrayAccessor {
 public:
     JPrimitiveArrayAccessor(JNIEnv* env, ArrayType jarray)
-        : m_size(jarray ? env->GetArrayLength(jarray) : 0)
-        , m_elements_holder(std::make_shared<ElementsHolder>(env, jarray))
+        : m_env(env)
+        , m_jarray(jarray)
+        , m_size(jarray ? env->GetArrayLength(jarray) : 0)
+        , m_data_ptr(nullptr)
     {
-        check_init(env);
+        acquire();
+    }
+    ~JPrimitiveArrayAccessor()
+    {
+        release();
     }
-    ~JPrimitiveArrayAccessor() = default;
 
-    JPrimitiveArrayAccessor(JPrimitiveArrayAccessor&&) = default;
-    JPrimitiveArrayAccessor& operator=(JPrimitiveArrayAccessor&&) = default;
-    JPrimitiveArrayAccessor(const JPrimitiveArrayAccessor&) = default;
-    JPrimitiveArrayAccessor& operator=(const JPrimitiveArrayAccessor&) = default;
+    JPrimitiveArrayAccessor(JPrimitiveArrayAccessor&& rhs) noexcept
+        : m_env(rhs.m_env)
+        , m_jarray(rhs.m_jarray)
+        , m_size(rhs.m_size)
+        , m_data_ptr(rhs.m_data_ptr)
+    {
+        if (rhs.uses_buffer()) {
+            std::copy_n(rhs.m_buffer, m_size, m_buffer);
+            m_data_ptr = m_buffer;
+        }
+        rhs.m_jarray = nullptr;
+        rhs.m_size = 0;
+        rhs.m_data_ptr = nullptr;
+    }
+    JPrimitiveArrayAccessor& operator=(JPrimitiveArrayAccessor&& rhs) noexcept
+    {
+        if (this != &rhs) {
+            this->~JPrimitiveArrayAccessor();
+            new (this) JPrimitiveArrayAccessor(std::move(rhs));
+        }
+        return *this;
+    }
+    JPrimitiveArrayAccessor(const JPrimitiveArrayAccessor& rhs)
+        : JPrimitiveArrayAccessor(rhs.m_env, rhs.m_jarray)
+    {
+    }
+    JPrimitiveArrayAccessor& operator=(const JPrimitiveArrayAccessor& rhs)
+    {
+        if (this != &rhs) {
+            this->~JPrimitiveArrayAccessor();
+            new (this) JPrimitiveArrayAccessor(rhs);
+        }
+        return *this;
+    }
 
     inline bool is_null()
     {
-        return !m_elements_holder->m_jarray;
+        return !m_jarray;
     }
 
     inline jsize size() const noexcept
@@ -79,12 +120,12 @@ public:
 
     inline ElementType* data() const noexcept
     {
-        return m_elements_holder->m_data_ptr;
+        return m_data_ptr;
     }
 
     inline const ElementType& operator[](const int index) const noexcept
     {
-        return m_elements_holder->m_data_ptr[index];
+        return m_data_ptr[index];
     }
 
     // Converts the Java array into an instance of T. The returned value's life cycle may still rely on this accessor.
@@ -93,29 +134,79 @@ public:
     T transform();
 
 private:
-    // Holding the data returned by GetXxxArrayElements call.
-    struct ElementsHolder {
-        ElementsHolder(JNIEnv*, ArrayType);
-        ~ElementsHolder();
-
-        JNIEnv* m_env;
-        const ArrayType m_jarray;
-        ElementType* m_data_ptr;
-        const jint m_release_mode = JNI_ABORT;
-    };
+    // Arrays up to this many elements are copied into m_buffer instead of acquiring the array elements.
+    static constexpr size_t inline_capacity = 64 / sizeof(ElementType);
 
+    JNIEnv* m_env;
+    ArrayType m_jarray;
     jsize m_size;
-    // For enabling copy/move constructors. ReleaseXxxArrayElements should only be called once.
-    std::shared_ptr<ElementsHolder> m_elements_holder;
+    ElementType* m_data_ptr;
+    ElementType m_buffer[inline_capacity];
+
+    // Specialized for every array type below.
+    static void get_region(JNIEnv*, ArrayType, jsize, ElementType*);
+    static ElementType* get_elements(JNIEnv*, ArrayType);
+    static void release_elements(JNIEnv*, ArrayType, ElementType*);
 
-    inline void check_init(JNIEnv* env)
+    inline bool uses_buffer() const noexcept
     {
-        if (m_elements_holder->m_jarray != nullptr && m_elements_holder->m_data_ptr == nullptr) {
-            THROW_JAVA_EXCEPTION(env, JavaExceptionDef::IllegalArgument,
+        return m_data_ptr == m_buffer;
+    }
+
+    inline void acquire()
+    {
+        if (!m_jarray) {
+            return;
+        }
+        if (static_cast<size_t>(m_size) <= inline_capacity) {
+            get_region(m_env, m_jarray, m_size, m_buffer);
+            m_data_ptr = m_buffer;
+            return;
+        }
+        m_data_ptr = get_elements(m_env, m_jarray);
+        if (m_data_ptr == nullptr) {
+            THROW_JAVA_EXCEPTION(m_env, JavaExceptionDef::IllegalArgument,
                                  util::format("GetXxxArrayElements failed on %1.",
-                                              reinterpret_cast<int64_t>(m_elements_holder->m_jarray)));
+                                              reinterpret_cast<int64_t>(m_jarray)));
         }
     }
+
+    inline void release() noexcept
+    {
+        if (m_jarray && m_data_ptr && !uses_buffer()) {
+            release_elements(m_env, m_jarray, m_data_ptr);
+        }
+    }
+};
+
+// Accessor for large, short-lived byte arrays like binary values which are handed to Core right away.
+// GetPrimitiveArrayCritical avoids the copy Get<Type>ArrayElements may make, but it can block the GC for as long as the
+// array is held. No other JNI function must be called while this accessor is alive, so only use it when the data is
+// consumed before anything else happens in the JNI call.
+class JByteArrayCriticalAccessor {
+public:
+    JByteArrayCriticalAccessor(JNIEnv* env, jbyteArray jarray);
+    ~JByteArrayCriticalAccessor()
+    {
+        if (m_data_ptr) {
+            m_env->ReleasePrimitiveArrayCritical(m_jarray, m_data_ptr, JNI_ABORT);
+        }
+    }
+
+    JByteArrayCriticalAccessor(JByteArrayCriticalAccessor&&) = delete;
+    JByteArrayCriticalAccessor& operator=(JByteArrayCriticalAccessor&&) = delete;
+    JByteArrayCriticalAccessor(const JByteArrayCriticalAccessor&) = delete;
+    JByteArrayCriticalAccessor& operator=(const JByteArrayCriticalAccessor&) = delete;
+
+    // The returned BinaryData is only valid for the life cycle of this accessor.
+    template <typename T>
+    T transform();
+
+private:
+    JNIEnv* m_env;
+    const jbyteArray m_jarray;
+    const jsize m_size;
+    void* m_data_ptr;
 };
 
 // Accessor for Java object arrays
@@ -278,37 +369,46 @@ private:
     }
 };
 
+// Validates the size of a byte[] before it is used as a binary value.
+inline void check_binary_size(JNIEnv* env, jsize size)
+{
+    // To solve the link issue by directly using Table::max_binary_size
+    static constexpr size_t max_binary_size = Table::max_binary_size;
+
+    if (static_cast<size_t>(size) > max_binary_size) {
+        THROW_JAVA_EXCEPTION(env, JavaExceptionDef::IllegalArgument,
+                             util::format("The length of 'byte[]' value is %1 which exceeds the max binary size %2.",
+                                 size, max_binary_size));
+    }
+}
+
 // Accessor for jbyteArray
 template <>
-inline JPrimitiveArrayAccessor<jbyteArray, jbyte>::ElementsHolder::ElementsHolder(JNIEnv* env, jbyteArray jarray)
-    : m_env(env)
-    , m_jarray(jarray)
-    , m_data_ptr(jarray ? env->GetByteArrayElements(jarray, nullptr) : nullptr)
+inline void JPrimitiveArrayAccessor<jbyteArray, jbyte>::get_region(JNIEnv* env, jbyteArray jarray, jsize size,
+                                                                   jbyte* buffer)
 {
+    env->GetByteArrayRegion(jarray, 0, size, buffer);
 }
 
 template <>
-inline JPrimitiveArrayAccessor<jbyteArray, jbyte>::ElementsHolder::~ElementsHolder()
+inline jbyte* JPrimitiveArrayAccessor<jbyteArray, jbyte>::get_elements(JNIEnv* env, jbyteArray jarray)
 {
-    if (m_jarray) {
-        m_env->ReleaseByteArrayElements(m_jarray, m_data_ptr, m_release_mode);
-    }
+    return env->GetByteArrayElements(jarray, nullptr);
+}
+
+template <>
+inline void JPrimitiveArrayAccessor<jbyteArray, jbyte>::release_elements(JNIEnv* env, jbyteArray jarray,
+                                                                         jbyte* data)
+{
+    env->ReleaseByteArrayElements(jarray, data, JNI_ABORT);
 }
 
 template <>
 template <>
 inline BinaryData JPrimitiveArrayAccessor<jbyteArray, jbyte>::transform<BinaryData>()
 {
-    // To solve the link issue by directly using Table::max_binary_size
-    static constexpr size_t max_binary_size = Table::max_binary_size;
-
-    if (static_cast<size_t>(m_size) > max_binary_size) {
-        THROW_JAVA_EXCEPTION(m_elements_holder->m_env, JavaExceptionDef::IllegalArgument,
-                             util::format("The length of 'byte[]' value is %1 which exceeds the max binary size %2.",
-                                 m_size, max_binary_size));
-    }
-    return is_null() ? realm::BinaryData()
-                     : realm::BinaryData(reinterpret_cast<const char*>(m_elements_holder->m_data_ptr), m_size);
+    check_binary_size(m_env, m_size);
+    return is_null() ? realm::BinaryData() : realm::BinaryData(reinterpret_cast<const char*>(m_data_ptr), m_size);
 }
 
 template <>
@@ -320,43 +420,75 @@ inline std::vector<char> JPrimitiveArrayAccessor<jbyteArray, jbyte>::transform<s
     }
 
     std::vector<char> v(m_size);
-    std::copy_n(m_elements_holder->m_data_ptr, v.size(), v.begin());
+    std::copy_n(m_data_ptr, v.size(), v.begin());
     return v;
 }
 
 // Accessor for jbooleanArray
 template <>
-inline JPrimitiveArrayAccessor<jbooleanArray, jboolean>::ElementsHolder::ElementsHolder(JNIEnv* env,
-                                                                                        jbooleanArray jarray)
-    : m_env(env)
-    , m_jarray(jarray)
-    , m_data_ptr(jarray ? env->GetBooleanArrayElements(jarray, nullptr) : nullptr)
+inline void JPrimitiveArrayAccessor<jbooleanArray, jboolean>::get_region(JNIEnv* env, jbooleanArray jarray,
+                                                                         jsize size, jboolean* buffer)
 {
+    env->GetBooleanArrayRegion(jarray, 0, size, buffer);
 }
 
 template <>
-inline JPrimitiveArrayAccessor<jbooleanArray, jboolean>::ElementsHolder::~ElementsHolder()
+inline jboolean* JPrimitiveArrayAccessor<jbooleanArray, jboolean>::get_elements(JNIEnv* env, jbooleanArray jarray)
 {
-    if (m_jarray) {
-        m_env->ReleaseBooleanArrayElements(m_jarray, m_data_ptr, m_release_mode);
-    }
+    return env->GetBooleanArrayElements(jarray, nullptr);
+}
+
+template <>
+inline void JPrimitiveArrayAccessor<jbooleanArray, jboolean>::release_elements(JNIEnv* env, jbooleanArray jarray,
+                                                                               jboolean* data)
+{
+    env->ReleaseBooleanArrayElements(jarray, data, JNI_ABORT);
 }
 
 // Accessor for jlongArray
 template <>
-inline JPrimitiveArrayAccessor<jlongArray, jlong>::ElementsHolder::ElementsHolder(JNIEnv* env, jlongArray jarray)
+inline void JPrimitiveArrayAccessor<jlongArray, jlong>::get_region(JNIEnv* env, jlongArray jarray, jsize size,
+                                                                   jlong* buffer)
+{
+    env->GetLongArrayRegion(jarray, 0, size, buffer);
+}
+
+template <>
+inline jlong* JPrimitiveArrayAccessor<jlongArray, jlong>::get_elements(JNIEnv* env, jlongArray jarray)
+{
+    return env->GetLongArrayElements(jarray, nullptr);
+}
+
+template <>
+inline void JPrimitiveArrayAccessor<jlongArray, jlong>::release_elements(JNIEnv* env, jlongArray jarray,
+                                                                         jlong* data)
+{
+    env->ReleaseLongArrayElements(jarray, data, JNI_ABORT);
+}
+
+// Accessor for critical jbyteArray access
+inline JByteArrayCriticalAccessor::JByteArrayCriticalAccessor(JNIEnv* env, jbyteArray jarray)
     : m_env(env)
     , m_jarray(jarray)
-    , m_data_ptr(jarray ? env->GetLongArrayElements(jarray, nullptr) : nullptr)
+    , m_size(jarray ? env->GetArrayLength(jarray) : 0)
+    , m_data_ptr(nullptr)
 {
+    // Validate before entering the critical region, throwing only needs to unwind then.
+    check_binary_size(env, m_size);
+    if (jarray) {
+        m_data_ptr = env->GetPrimitiveArrayCritical(jarray, nullptr);
+        if (m_data_ptr == nullptr) {
+            THROW_JAVA_EXCEPTION(env, JavaExceptionDef::IllegalArgument,
+                                 util::format("GetPrimitiveArrayCritical failed on %1.",
+                                              reinterpret_cast<int64_t>(jarray)));
+        }
+    }
 }
 
 template <>
-inline JPrimitiveArrayAccessor<jlongArray, jlong>::ElementsHolder::~ElementsHolder()
+inline BinaryData JByteArrayCriticalAccessor::transform<BinaryData>()
 {
-    if (m_jarray) {
-        m_env->ReleaseLongArrayElements(m_jarray, m_data_ptr, m_release_mode);
-    }
+    return m_jarray ? realm::BinaryData(static_cast<const char*>(m_data_ptr), m_size) : realm::BinaryData();
 }
 
 template <>
@@ -18,6 +18,9 @@
 #include "java_class_global_def.hpp"
 #include "jni_util/java_method.hpp"
 
+#include "object_schema.hpp"
+#include "object_store.hpp"
+#include "shared_realm.hpp"
 #include "util.hpp"
 
 using namespace realm;
@@ -31,10 +34,7 @@ void JavaBindingContext::before_notify()
     }
     if (m_java_notifier) {
         m_java_notifier.call_with_local_ref([&](JNIEnv* env, jobject notifier_obj) {
-            // Method IDs from RealmNotifier implementation. Cache them as member vars.
-            static JavaMethod notify_by_other_method(env, JavaClassGlobalDef::realm_notifier(), "beforeNotify",
-                                                     "()V");
-            env->CallVoidMethod(notifier_obj, notify_by_other_method);
+            env->CallVoidMethod(notifier_obj, JavaClassGlobalDef::realm_notifier_before_notify(env));
         });
     }
 }
@@ -49,23 +49,22 @@ void JavaBindingContext::did_change(std::vector<BindingContext::ObserverState> c
     }
     if (version_changed) {
         m_java_notifier.call_with_local_ref(env, [&](JNIEnv*, jobject notifier_obj) {
-            static JavaMethod realm_notifier_did_change_method(env, JavaClassGlobalDef::realm_notifier(), "didChange",
-                                                               "()V");
-            env->CallVoidMethod(notifier_obj, realm_notifier_did_change_method);
+            env->CallVoidMethod(notifier_obj, JavaClassGlobalDef::realm_notifier_did_change(env));
         });
     }
 }
 
 void JavaBindingContext::schema_did_change(Schema const&)
 {
+    // The cached pointers point into the previous schema.
+    m_object_schemas.clear();
     if (!m_schema_changed_callback) {
         return;
     }
     auto env = JniUtils::get_env(false);
-    static JavaMethod on_schema_changed_method(env, JavaClassGlobalDef::shared_realm_schema_change_callback(),
-                                               "onSchemaChanged", "()V");
-    m_schema_changed_callback.call_with_local_ref(
-        env, [](JNIEnv* env, jobject callback_obj) { env->CallVoidMethod(callback_obj, on_schema_changed_method); });
+    m_schema_changed_callback.call_with_local_ref(env, [](JNIEnv* env, jobject callback_obj) {
+        env->CallVoidMethod(callback_obj, JavaClassGlobalDef::shared_realm_schema_change_callback_on_schema_changed(env));
+    });
 }
 
 void JavaBindingContext::set_schema_changed_callback(JNIEnv* env, jobject schema_changed_callback)
@@ -73,20 +72,41 @@ void JavaBindingContext::set_schema_changed_callback(JNIEnv* env, jobject schema
     m_schema_changed_callback = JavaGlobalWeakRef(env, schema_changed_callback);
 }
 
+static const ObjectSchema& find_object_schema(const Schema& schema, const Table& table)
+{
+    StringData class_name = ObjectStore::object_type_for_table_name(table.get_name());
+    auto it = schema.find(class_name);
+    if (it == schema.end()) {
+        throw std::runtime_error(util::format("Class '%1' cannot be found in the schema.", std::string(class_name)));
+    }
+    return *it;
+}
+
+const ObjectSchema& JavaBindingContext::get_object_schema(Realm& realm, const Table& table)
+{
+    if (!realm.m_binding_context) {
+        return find_object_schema(realm.schema(), table);
+    }
+    auto& context = static_cast<JavaBindingContext&>(*realm.m_binding_context);
+    auto it = context.m_object_schemas.find(table.get_key().value);
+    if (it != context.m_object_schemas.end()) {
+        return *it->second;
+    }
+    const ObjectSchema& object_schema = find_object_schema(realm.schema(), table);
+    context.m_object_schemas.emplace(table.get_key().value, &object_schema);
+    return object_schema;
+}
+
 void JavaBindingContext::will_send_notifications() {
     auto env = JniUtils::get_env();
     m_java_notifier.call_with_local_ref(env, [&](JNIEnv*, jobject notifier_obj) {
-        static JavaMethod realm_notifier_will_send_notifications(env, JavaClassGlobalDef::realm_notifier(),
-                                                           "willSendNotifications", "()V");
-        env->CallVoidMethod(notifier_obj, realm_notifier_will_send_notifications);
+        env->CallVoidMethod(notifier_obj, JavaClassGlobalDef::realm_notifier_will_send_notifications(env));
     });
 }
 
 void JavaBindingContext::did_send_notifications() {
     auto env = JniUtils::get_env();
     m_java_notifier.call_with_local_ref(env, [&](JNIEnv*, jobject notifier_obj) {
-        static JavaMethod realm_notifier_did_send_notifications(env, JavaClassGlobalDef::realm_notifier(),
-                                                                 "didSendNotifications", "()V");
-        env->CallVoidMethod(notifier_obj, realm_notifier_did_send_notifications);
+        env->CallVoidMethod(notifier_obj, JavaClassGlobalDef::realm_notifier_did_send_notifications(env));
     });
 }
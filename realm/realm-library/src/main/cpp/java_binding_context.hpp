@@ -19,6 +19,9 @@
 
 #include <jni.h>
 #include <memory>
+#include <unordered_map>
+
+#include <realm/keys.hpp>
 
 #include "binding_context.hpp"
 
@@ -26,6 +29,9 @@
 
 namespace realm {
 
+class ObjectSchema;
+class Table;
+
 namespace _impl {
 // Binding context which will be called from OS.
 class JavaBindingContext final : public BindingContext {
@@ -39,6 +45,8 @@ private:
     // Java should hold a strong ref to them as long as the SharedRealm lives
     jni_util::JavaGlobalWeakRef m_java_notifier;
     jni_util::JavaGlobalWeakRef m_schema_changed_callback;
+    // Schemas of the classes looked up by table, pointing into the schema of the Realm. Cleared when it changes.
+    std::unordered_map<uint32_t, const ObjectSchema*> m_object_schemas;
 
 public:
     virtual ~JavaBindingContext(){};
@@ -60,6 +68,10 @@ public:
 
     void set_schema_changed_callback(JNIEnv* env, jobject schema_changed_callback);
 
+    // Returns the schema of the class stored in the table. The lookup is cached in the binding context of the Realm
+    // until its schema changes, so repeated lookups neither build the class name nor search the schema.
+    static const ObjectSchema& get_object_schema(Realm& realm, const Table& table);
+
     static inline std::unique_ptr<JavaBindingContext> create(JNIEnv* env, jobject notifier)
     {
         return std::make_unique<JavaBindingContext>(ConcreteJavaBindContext{env, notifier});
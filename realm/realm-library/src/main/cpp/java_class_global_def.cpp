@@ -19,9 +19,84 @@
 #include "java_class_global_def.hpp"
 #include "java_exception_def.hpp"
 #include "jni_util/java_exception_thrower.hpp"
+#include "jni_util/java_local_ref.hpp"
 
 using namespace realm;
 using namespace realm::_impl;
+using namespace realm::jni_util;
+
+JavaClassGlobalDef::JavaClassGlobalDef(JNIEnv* env)
+    : m_java_lang_long(env, "java/lang/Long", false)
+    , m_java_lang_float(env, "java/lang/Float", false)
+    , m_java_lang_double(env, "java/lang/Double", false)
+    , m_java_util_date(env, "java/util/Date", false)
+    , m_java_lang_string(env, "java/lang/String", false)
+    , m_java_lang_boolean(env, "java/lang/Boolean", false)
+    , m_java_lang_object(env, "java/lang/Object", false)
+    , m_java_util_hash_map(env, "java/util/HashMap", false)
+    , m_shared_realm_schema_change_callback(env, "io/realm/internal/OsSharedRealm$SchemaChangedCallback", false)
+    , m_realm_notifier(env, "io/realm/internal/RealmNotifier", false)
+    , m_os_object(env, "io/realm/internal/OsObject", false)
+    , m_observable_collection(env, "io/realm/internal/ObservableCollection", false)
+    , m_bson_decimal128(env, "org/bson/types/Decimal128", false)
+    , m_bson_object_id(env, "org/bson/types/ObjectId", false)
+#if REALM_ENABLE_SYNC
+    , m_network_transport_response(env, "io/realm/internal/objectstore/OsJavaNetworkTransport$Response", false)
+    , m_jni_result_callback(env, "io/realm/internal/jni/OsJNIResultCallback", false)
+    , m_jni_void_result_callback(env, "io/realm/internal/jni/OsJNIVoidResultCallback", false)
+    , m_sync_session(env, "io/realm/mongodb/sync/SyncSession", false)
+    , m_async_open_task(env, "io/realm/internal/objectstore/OsAsyncOpenTask", false)
+    , m_app_exception(env, "io/realm/mongodb/AppException", false)
+    , m_error_code(env, "io/realm/mongodb/ErrorCode", false)
+#endif
+    , m_java_lang_long_value_of(env, m_java_lang_long, "valueOf", "(J)Ljava/lang/Long;", true)
+    , m_java_lang_float_value_of(env, m_java_lang_float, "valueOf", "(F)Ljava/lang/Float;", true)
+    , m_java_lang_double_value_of(env, m_java_lang_double, "valueOf", "(D)Ljava/lang/Double;", true)
+    , m_java_lang_boolean_value_of(env, m_java_lang_boolean, "valueOf", "(Z)Ljava/lang/Boolean;", true)
+    , m_java_util_date_init(env, m_java_util_date, "<init>", "(J)V")
+    , m_java_util_hash_map_init(env, m_java_util_hash_map, "<init>", "(I)V")
+    , m_java_util_hash_map_put(env, m_java_util_hash_map, "put",
+                               "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;")
+    , m_bson_decimal128_from_bid(env, m_bson_decimal128, "fromIEEE754BIDEncoding",
+                                 "(JJ)Lorg/bson/types/Decimal128;", true)
+    , m_bson_object_id_init(env, m_bson_object_id, "<init>", "(Ljava/lang/String;)V")
+{
+}
+
+JavaClassGlobalDef::RealmMethods::RealmMethods(JNIEnv* env, const JavaClassGlobalDef& def)
+    : m_shared_realm_schema_change_callback_on_schema_changed(env, def.m_shared_realm_schema_change_callback,
+                                                              "onSchemaChanged", "()V")
+    , m_realm_notifier_before_notify(env, def.m_realm_notifier, "beforeNotify", "()V")
+    , m_realm_notifier_did_change(env, def.m_realm_notifier, "didChange", "()V")
+    , m_realm_notifier_will_send_notifications(env, def.m_realm_notifier, "willSendNotifications", "()V")
+    , m_realm_notifier_did_send_notifications(env, def.m_realm_notifier, "didSendNotifications", "()V")
+    , m_os_object_notify_change_listeners(env, def.m_os_object, "notifyChangeListeners", "([Ljava/lang/String;)V")
+    , m_observable_collection_notify_change_listeners(env, def.m_observable_collection, "notifyChangeListeners", "(J)V")
+#if REALM_ENABLE_SYNC
+    , m_network_transport_response_get_http_code(env, def.m_network_transport_response, "getHttpResponseCode", "()I")
+    , m_network_transport_response_get_custom_code(env, def.m_network_transport_response, "getCustomResponseCode",
+                                                   "()I")
+    , m_network_transport_response_get_headers(env, def.m_network_transport_response, "getJNIFriendlyHeaders",
+                                               "()[Ljava/lang/String;")
+    , m_network_transport_response_get_body_bytes(env, def.m_network_transport_response, "getBodyBytes", "()[B")
+    , m_jni_result_callback_on_error(env, def.m_jni_result_callback, "onError",
+                                     "(Ljava/lang/String;ILjava/lang/String;)V")
+    , m_jni_result_callback_on_success(env, def.m_jni_result_callback, "onSuccess", "(Ljava/lang/Object;)V")
+    , m_jni_void_result_callback_on_error(env, def.m_jni_void_result_callback, "onError",
+                                          "(Ljava/lang/String;ILjava/lang/String;)V")
+    , m_jni_void_result_callback_on_success(env, def.m_jni_void_result_callback, "onSuccess", "(Ljava/lang/Object;)V")
+    , m_sync_session_notify_progress_listener(env, def.m_sync_session, "notifyProgressListener", "(JJJ)V")
+    , m_sync_session_notify_all_changes_sent(env, def.m_sync_session, "notifyAllChangesSent",
+                                             "(ILjava/lang/String;Ljava/lang/Long;Ljava/lang/String;)V")
+    , m_sync_session_notify_connection_listeners(env, def.m_sync_session, "notifyConnectionListeners", "(JJ)V")
+    , m_async_open_task_notify_realm_ready(env, def.m_async_open_task, "notifyRealmReady", "()V")
+    , m_async_open_task_notify_error(env, def.m_async_open_task, "notifyError", "(Ljava/lang/String;)V")
+    , m_error_code_from_native_error(env, def.m_error_code, "fromNativeError",
+                                     "(Ljava/lang/String;I)Lio/realm/mongodb/ErrorCode;", true)
+    , m_app_exception_init(env, def.m_app_exception, "<init>", "(Lio/realm/mongodb/ErrorCode;Ljava/lang/String;)V")
+#endif
+{
+}
 
 jbyteArray JavaClassGlobalDef::new_byte_array(JNIEnv* env, const BinaryData& binary_data)
 {
@@ -48,13 +123,28 @@ jobject JavaClassGlobalDef::new_decimal128(JNIEnv* env, const Decimal128& decima
     if (decimal128.is_null()) {
         return nullptr;
     }
-    static jni_util::JavaMethod fromIEEE754BIDEncoding(env, instance()->m_bson_decimal128, "fromIEEE754BIDEncoding", "(JJ)Lorg/bson/types/Decimal128;", true);
     const Decimal128::Bid128* raw = decimal128.raw();
-    return env->CallStaticObjectMethod(instance()->m_bson_decimal128, fromIEEE754BIDEncoding, static_cast<jlong>(raw->w[1]), static_cast<jlong>(raw->w[0]));
+    return env->CallStaticObjectMethod(instance()->m_bson_decimal128, instance()->m_bson_decimal128_from_bid,
+                                       static_cast<jlong>(raw->w[1]), static_cast<jlong>(raw->w[0]));
 }
 
 jobject JavaClassGlobalDef::new_object_id(JNIEnv* env, const ObjectId& objectId)
 {
-    static jni_util::JavaMethod init(env, instance()->m_bson_object_id, "<init>", "(Ljava/lang/String;)V");
-    return env->NewObject(instance()->m_bson_object_id, init, to_jstring(env, objectId.to_string().data()));
+    return env->NewObject(instance()->m_bson_object_id, instance()->m_bson_object_id_init,
+                          to_jstring(env, objectId.to_string().data()));
+}
+
+#if REALM_ENABLE_SYNC
+jthrowable JavaClassGlobalDef::new_app_exception(JNIEnv* env, const std::string& category, int code,
+                                                 const std::string& message)
+{
+    JavaLocalRef<jstring> j_category(env, to_jstring(env, category));
+    JavaLocalRef<jstring> j_message(env, to_jstring(env, message));
+    const RealmMethods& methods = realm_methods(env);
+    JavaLocalRef<jobject> j_error_code(
+        env, env->CallStaticObjectMethod(instance()->m_error_code, methods.m_error_code_from_native_error,
+                                         j_category.get(), code));
+    return static_cast<jthrowable>(env->NewObject(instance()->m_app_exception, methods.m_app_exception_init,
+                                                  j_error_code.get(), j_message.get()));
 }
+#endif
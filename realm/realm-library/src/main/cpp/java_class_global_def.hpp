@@ -22,6 +22,7 @@
 #include "jni_util/java_method.hpp"
 
 #include <memory>
+#include <mutex>
 
 #include <realm/util/assert.hpp>
 
@@ -31,35 +32,26 @@ class BinaryData;
 
 namespace _impl {
 
-// Manage a global static jclass pool which will be initialized when JNI_OnLoad() called.
+// Manage a global static jclass and jmethodID pool which will be initialized when JNI_OnLoad() called.
 // FindClass is a relatively slow operation, loading all the needed classes when start is not good since usually user
 // will call Realm.init() when the app starts.
 // Instead, we only load necessary classes including:
 // 1. Common types which might be used everywhere. (Boxed types, String, etc.)
 // 2. Classes which might be initialized in the native thread.
+// 3. Classes with methods called back from hot paths, e.g. change listeners and network callbacks.
 //
 // FindClass will fail if it is called from a native thread (e.g.: the sync client thread.). But usually it is not a
 // problem if the FindClass is called from an JNI method. So keeping a static JavaClass var locally is still preferred
-// if it is possible.
+// if it is possible and the method is not called frequently.
+//
+// The method IDs of JDK and BSON classes are resolved in the constructor. The method IDs of io.realm classes are
+// resolved together once Realm or an App is initialized, see initialize_realm_methods(), or on first use if that
+// comes earlier. They cannot be resolved in JNI_OnLoad: GetMethodID initializes the class, and the static
+// initializers of some of them (e.g. OsObject) call native methods, which must not happen before JNI_OnLoad has
+// returned.
 class JavaClassGlobalDef {
 private:
-    JavaClassGlobalDef(JNIEnv* env)
-        : m_java_lang_long(env, "java/lang/Long", false)
-        , m_java_lang_float(env, "java/lang/Float", false)
-        , m_java_lang_double(env, "java/lang/Double", false)
-        , m_java_util_date(env, "java/util/Date", false)
-        , m_java_lang_string(env, "java/lang/String", false)
-        , m_java_lang_boolean(env, "java/lang/Boolean", false)
-        , m_java_lang_object(env, "java/lang/Object", false)
-        , m_shared_realm_schema_change_callback(env, "io/realm/internal/OsSharedRealm$SchemaChangedCallback", false)
-        , m_realm_notifier(env, "io/realm/internal/RealmNotifier", false)
-        , m_bson_decimal128(env, "org/bson/types/Decimal128", false)
-        , m_bson_object_id(env, "org/bson/types/ObjectId", false)
-#if REALM_ENABLE_SYNC
-        , m_network_transport_response(env, "io/realm/internal/objectstore/OsJavaNetworkTransport$Response", false)
-#endif
-    {
-    }
+    JavaClassGlobalDef(JNIEnv* env);
 
     jni_util::JavaClass m_java_lang_long;
     jni_util::JavaClass m_java_lang_float;
@@ -68,15 +60,67 @@ private:
     jni_util::JavaClass m_java_lang_string;
     jni_util::JavaClass m_java_lang_boolean;
     jni_util::JavaClass m_java_lang_object;
+    jni_util::JavaClass m_java_util_hash_map;
 
     jni_util::JavaClass m_shared_realm_schema_change_callback;
     jni_util::JavaClass m_realm_notifier;
+    jni_util::JavaClass m_os_object;
+    jni_util::JavaClass m_observable_collection;
     jni_util::JavaClass m_bson_decimal128;
     jni_util::JavaClass m_bson_object_id;
 
 #if REALM_ENABLE_SYNC
     jni_util::JavaClass m_network_transport_response;
+    jni_util::JavaClass m_jni_result_callback;
+    jni_util::JavaClass m_jni_void_result_callback;
+    jni_util::JavaClass m_sync_session;
+    jni_util::JavaClass m_async_open_task;
+    jni_util::JavaClass m_app_exception;
+    jni_util::JavaClass m_error_code;
+#endif
+
+    // Method IDs. Must be declared after the classes above since they are initialized from them.
+    jni_util::JavaMethod m_java_lang_long_value_of;
+    jni_util::JavaMethod m_java_lang_float_value_of;
+    jni_util::JavaMethod m_java_lang_double_value_of;
+    jni_util::JavaMethod m_java_lang_boolean_value_of;
+    jni_util::JavaMethod m_java_util_date_init;
+    jni_util::JavaMethod m_java_util_hash_map_init;
+    jni_util::JavaMethod m_java_util_hash_map_put;
+    jni_util::JavaMethod m_bson_decimal128_from_bid;
+    jni_util::JavaMethod m_bson_object_id_init;
+
+    // Method IDs of io.realm classes, see realm_methods().
+    struct RealmMethods {
+        RealmMethods(JNIEnv* env, const JavaClassGlobalDef& def);
+
+        jni_util::JavaMethod m_shared_realm_schema_change_callback_on_schema_changed;
+        jni_util::JavaMethod m_realm_notifier_before_notify;
+        jni_util::JavaMethod m_realm_notifier_did_change;
+        jni_util::JavaMethod m_realm_notifier_will_send_notifications;
+        jni_util::JavaMethod m_realm_notifier_did_send_notifications;
+        jni_util::JavaMethod m_os_object_notify_change_listeners;
+        jni_util::JavaMethod m_observable_collection_notify_change_listeners;
+#if REALM_ENABLE_SYNC
+        jni_util::JavaMethod m_network_transport_response_get_http_code;
+        jni_util::JavaMethod m_network_transport_response_get_custom_code;
+        jni_util::JavaMethod m_network_transport_response_get_headers;
+        jni_util::JavaMethod m_network_transport_response_get_body_bytes;
+        jni_util::JavaMethod m_jni_result_callback_on_error;
+        jni_util::JavaMethod m_jni_result_callback_on_success;
+        jni_util::JavaMethod m_jni_void_result_callback_on_error;
+        jni_util::JavaMethod m_jni_void_result_callback_on_success;
+        jni_util::JavaMethod m_sync_session_notify_progress_listener;
+        jni_util::JavaMethod m_sync_session_notify_all_changes_sent;
+        jni_util::JavaMethod m_sync_session_notify_connection_listeners;
+        jni_util::JavaMethod m_async_open_task_notify_realm_ready;
+        jni_util::JavaMethod m_async_open_task_notify_error;
+        jni_util::JavaMethod m_error_code_from_native_error;
+        jni_util::JavaMethod m_app_exception_init;
 #endif
+    };
+    std::once_flag m_realm_methods_once;
+    std::unique_ptr<RealmMethods> m_realm_methods;
 
     inline static std::unique_ptr<JavaClassGlobalDef>& instance()
     {
@@ -84,6 +128,15 @@ private:
         return instance;
     };
 
+    inline static const RealmMethods& realm_methods(JNIEnv* env)
+    {
+        JavaClassGlobalDef& def = *instance();
+        std::call_once(def.m_realm_methods_once, [&] {
+            def.m_realm_methods.reset(new RealmMethods(env, def));
+        });
+        return *def.m_realm_methods;
+    }
+
 public:
     // Called in JNI_OnLoad
     static void initialize(JNIEnv* env)
@@ -91,6 +144,12 @@ public:
         REALM_ASSERT(!instance());
         instance().reset(new JavaClassGlobalDef(env));
     }
+    // Called when Realm or an App is initialized. Resolves the method IDs of io.realm classes, which otherwise are
+    // resolved on first use.
+    static void initialize_realm_methods(JNIEnv* env)
+    {
+        realm_methods(env);
+    }
     // Called in JNI_OnUnload
     static void release()
     {
@@ -98,11 +157,14 @@ public:
         instance().release();
     }
 
+    // The boxing helpers below go through the static valueOf() methods rather than the constructors, so the JVM can
+    // hand out its cached instances (e.g. Long in [-128, 127] and Boolean.TRUE/FALSE) instead of allocating.
+
     // java.lang.Long
     inline static jobject new_long(JNIEnv* env, int64_t value)
     {
-        static jni_util::JavaMethod init(env, instance()->m_java_lang_long, "<init>", "(J)V");
-        return env->NewObject(instance()->m_java_lang_long, init, value);
+        return env->CallStaticObjectMethod(instance()->m_java_lang_long, instance()->m_java_lang_long_value_of,
+                                           static_cast<jlong>(value));
     }
     inline static const jni_util::JavaClass& java_lang_long()
     {
@@ -112,8 +174,8 @@ public:
     // java.lang.Float
     inline static jobject new_float(JNIEnv* env, float value)
     {
-        static jni_util::JavaMethod init(env, instance()->m_java_lang_float, "<init>", "(F)V");
-        return env->NewObject(instance()->m_java_lang_float, init, value);
+        return env->CallStaticObjectMethod(instance()->m_java_lang_float, instance()->m_java_lang_float_value_of,
+                                           static_cast<jfloat>(value));
     }
     inline static const jni_util::JavaClass& java_lang_float()
     {
@@ -123,8 +185,8 @@ public:
     // java.lang.Double
     inline static jobject new_double(JNIEnv* env, double value)
     {
-        static jni_util::JavaMethod init(env, instance()->m_java_lang_double, "<init>", "(D)V");
-        return env->NewObject(instance()->m_java_lang_double, init, value);
+        return env->CallStaticObjectMethod(instance()->m_java_lang_double, instance()->m_java_lang_double_value_of,
+                                           static_cast<jdouble>(value));
     }
     inline static const jni_util::JavaClass& java_lang_double()
     {
@@ -134,8 +196,8 @@ public:
     // java.lang.Boolean
     inline static jobject new_boolean(JNIEnv* env, bool value)
     {
-        static jni_util::JavaMethod init(env, instance()->m_java_lang_boolean, "<init>", "(Z)V");
-        return env->NewObject(instance()->m_java_lang_boolean, init, value ? JNI_TRUE : JNI_FALSE);
+        return env->CallStaticObjectMethod(instance()->m_java_lang_boolean, instance()->m_java_lang_boolean_value_of,
+                                           value ? JNI_TRUE : JNI_FALSE);
     }
     inline static const jni_util::JavaClass& java_lang_boolean()
     {
@@ -149,8 +211,7 @@ public:
         if (ts.is_null()) {
             return nullptr;
         }
-        static jni_util::JavaMethod init(env, instance()->m_java_util_date, "<init>", "(J)V");
-        return env->NewObject(instance()->m_java_util_date, init, to_milliseconds(ts));
+        return env->NewObject(instance()->m_java_util_date, instance()->m_java_util_date_init, to_milliseconds(ts));
     }
     inline static const jni_util::JavaClass& java_util_date()
     {
@@ -163,6 +224,17 @@ public:
         return instance()->m_java_lang_string;
     }
 
+    // java.util.HashMap
+    inline static jobject new_hash_map(JNIEnv* env, jint initial_capacity)
+    {
+        return env->NewObject(instance()->m_java_util_hash_map, instance()->m_java_util_hash_map_init,
+                              initial_capacity);
+    }
+    inline static const jni_util::JavaMethod& java_util_hash_map_put()
+    {
+        return instance()->m_java_util_hash_map_put;
+    }
+
     // byte[]
     // return nullptr if binary_data is null
     static jbyteArray new_byte_array(JNIEnv* env, const BinaryData& binary_data);
@@ -176,12 +248,44 @@ public:
     {
         return instance()->m_shared_realm_schema_change_callback;
     }
+    inline static const jni_util::JavaMethod& shared_realm_schema_change_callback_on_schema_changed(JNIEnv* env)
+    {
+        return realm_methods(env).m_shared_realm_schema_change_callback_on_schema_changed;
+    }
 
     // io.realm.internal.RealmNotifier
     inline static const jni_util::JavaClass& realm_notifier()
     {
         return instance()->m_realm_notifier;
     }
+    inline static const jni_util::JavaMethod& realm_notifier_before_notify(JNIEnv* env)
+    {
+        return realm_methods(env).m_realm_notifier_before_notify;
+    }
+    inline static const jni_util::JavaMethod& realm_notifier_did_change(JNIEnv* env)
+    {
+        return realm_methods(env).m_realm_notifier_did_change;
+    }
+    inline static const jni_util::JavaMethod& realm_notifier_will_send_notifications(JNIEnv* env)
+    {
+        return realm_methods(env).m_realm_notifier_will_send_notifications;
+    }
+    inline static const jni_util::JavaMethod& realm_notifier_did_send_notifications(JNIEnv* env)
+    {
+        return realm_methods(env).m_realm_notifier_did_send_notifications;
+    }
+
+    // io.realm.internal.OsObject
+    inline static const jni_util::JavaMethod& os_object_notify_change_listeners(JNIEnv* env)
+    {
+        return realm_methods(env).m_os_object_notify_change_listeners;
+    }
+
+    // io.realm.internal.ObservableCollection
+    inline static const jni_util::JavaMethod& observable_collection_notify_change_listeners(JNIEnv* env)
+    {
+        return realm_methods(env).m_observable_collection_notify_change_listeners;
+    }
 
     // java.lang.Object
     inline static const jni_util::JavaClass& java_lang_object()
@@ -190,10 +294,76 @@ public:
     }
 
 #if REALM_ENABLE_SYNC
+    // io.realm.internal.objectstore.OsJavaNetworkTransport.Response
     inline static const jni_util::JavaClass& network_transport_response_class()
     {
         return instance()->m_network_transport_response;
     }
+    inline static const jni_util::JavaMethod& network_transport_response_get_http_code(JNIEnv* env)
+    {
+        return realm_methods(env).m_network_transport_response_get_http_code;
+    }
+    inline static const jni_util::JavaMethod& network_transport_response_get_custom_code(JNIEnv* env)
+    {
+        return realm_methods(env).m_network_transport_response_get_custom_code;
+    }
+    inline static const jni_util::JavaMethod& network_transport_response_get_headers(JNIEnv* env)
+    {
+        return realm_methods(env).m_network_transport_response_get_headers;
+    }
+    inline static const jni_util::JavaMethod& network_transport_response_get_body_bytes(JNIEnv* env)
+    {
+        return realm_methods(env).m_network_transport_response_get_body_bytes;
+    }
+
+    // io.realm.internal.jni.OsJNIResultCallback
+    inline static const jni_util::JavaMethod& jni_result_callback_on_error(JNIEnv* env)
+    {
+        return realm_methods(env).m_jni_result_callback_on_error;
+    }
+    inline static const jni_util::JavaMethod& jni_result_callback_on_success(JNIEnv* env)
+    {
+        return realm_methods(env).m_jni_result_callback_on_success;
+    }
+
+    // io.realm.internal.jni.OsJNIVoidResultCallback
+    inline static const jni_util::JavaMethod& jni_void_result_callback_on_error(JNIEnv* env)
+    {
+        return realm_methods(env).m_jni_void_result_callback_on_error;
+    }
+    inline static const jni_util::JavaMethod& jni_void_result_callback_on_success(JNIEnv* env)
+    {
+        return realm_methods(env).m_jni_void_result_callback_on_success;
+    }
+
+    // io.realm.mongodb.sync.SyncSession
+    inline static const jni_util::JavaMethod& sync_session_notify_progress_listener(JNIEnv* env)
+    {
+        return realm_methods(env).m_sync_session_notify_progress_listener;
+    }
+    inline static const jni_util::JavaMethod& sync_session_notify_all_changes_sent(JNIEnv* env)
+    {
+        return realm_methods(env).m_sync_session_notify_all_changes_sent;
+    }
+    inline static const jni_util::JavaMethod& sync_session_notify_connection_listeners(JNIEnv* env)
+    {
+        return realm_methods(env).m_sync_session_notify_connection_listeners;
+    }
+
+    // io.realm.internal.objectstore.OsAsyncOpenTask
+    inline static const jni_util::JavaMethod& async_open_task_notify_realm_ready(JNIEnv* env)
+    {
+        return realm_methods(env).m_async_open_task_notify_realm_ready;
+    }
+    inline static const jni_util::JavaMethod& async_open_task_notify_error(JNIEnv* env)
+    {
+        return realm_methods(env).m_async_open_task_notify_error;
+    }
+
+    // io.realm.mongodb.AppException
+    // Creates an AppException from a native error category, code and message.
+    static jthrowable new_app_exception(JNIEnv* env, const std::string& category, int code,
+                                        const std::string& message);
 #endif
 };
 
@@ -19,8 +19,11 @@
 
 #include "java_accessor.hpp"
 #include "util.hpp"
+#include "java_class_global_def.hpp"
 #include "sync/generic_network_transport.hpp"
 #include "jni_util/java_class.hpp"
+#include "jni_util/java_local_frame.hpp"
+#include "jni_util/java_local_ref.hpp"
 #include "jni_util/java_method.hpp"
 #include "jni_util/jni_utils.hpp"
 
@@ -37,7 +40,8 @@ struct JavaNetworkTransport : public app::GenericNetworkTransport {
         m_java_network_transport_impl = env->NewGlobalRef(java_network_transport_impl);
         jclass cls = env->GetObjectClass(m_java_network_transport_impl);
         auto method_name = "sendRequest";
-        auto signature = "(Ljava/lang/String;Ljava/lang/String;JLjava/util/Map;Ljava/lang/String;)Lio/realm/internal/objectstore/OsJavaNetworkTransport$Response;";
+        // Bodies cross JNI as UTF-8 bytes, which saves converting them to and from UTF-16 Java strings.
+        auto signature = "(Ljava/lang/String;Ljava/lang/String;JLjava/util/Map;[B)Lio/realm/internal/objectstore/OsJavaNetworkTransport$Response;";
         m_send_request_method = env->GetMethodID(cls, method_name, signature);
         REALM_ASSERT_RELEASE_EX(m_send_request_method != nullptr, method_name, signature);
     }
@@ -45,6 +49,9 @@ struct JavaNetworkTransport : public app::GenericNetworkTransport {
     void send_request_to_server(const app::Request request, std::function<void(const app::Response)> completionBlock)
     {
         JNIEnv* env = JniUtils::get_env(true);
+        // Requests are sent from native threads which never return to Java, so local refs have to be released
+        // explicitly.
+        JavaLocalFrame frame(env);
 
         // Setup method
         std::string method;
@@ -57,15 +64,18 @@ struct JavaNetworkTransport : public app::GenericNetworkTransport {
         }
 
         // Create headers
-        static JavaClass mapClass(env, "java/util/HashMap");
-        static JavaMethod init(env, mapClass, "<init>", "(I)V");
-        static JavaMethod put_method(env, mapClass, "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
-        size_t map_size = request.headers.size();
-        jobject request_headers = env->NewObject(mapClass, init, (jsize) map_size);
-        for (auto header : request.headers) {
-            env->CallObjectMethod(request_headers, put_method, to_jstring(env, header.first), to_jstring(env, header.second));
+        jobject request_headers = JavaClassGlobalDef::new_hash_map(env, (jsize) request.headers.size());
+        {
+            JavaLocalFrame headers_frame(env);
+            for (const auto& header : request.headers) {
+                env->CallObjectMethod(request_headers, JavaClassGlobalDef::java_util_hash_map_put(), to_jstring(env, header.first), to_jstring(env, header.second));
+                headers_frame.step(3);
+            }
         }
 
+        // A body is created for every request, release it right away instead of with the frame.
+        JavaLocalRef<jbyteArray> request_body(env, JavaClassGlobalDef::new_byte_array(env, BinaryData(request.body.data(), request.body.size())));
+
         // Execute network request on the Java side
         jobject response = env->CallObjectMethod(m_java_network_transport_impl,
                                             m_send_request_method,
@@ -73,7 +83,7 @@ struct JavaNetworkTransport : public app::GenericNetworkTransport {
                                             to_jstring(env, request.url),
                                             static_cast<jlong>(request.timeout_ms),
                                             request_headers,
-                                            to_jstring(env, request.body)
+                                            request_body.get()
                                             );
         env->DeleteLocalRef(request_headers);
 
@@ -84,24 +94,28 @@ struct JavaNetworkTransport : public app::GenericNetworkTransport {
             return;
         } else {
             // Read response
-            static const JavaClass& response_class(JavaClassGlobalDef::network_transport_response_class());
-            static JavaMethod get_http_code_method(env, response_class, "getHttpResponseCode", "()I");
-            static JavaMethod get_custom_code_method(env, response_class, "getCustomResponseCode", "()I");
-            static JavaMethod get_headers_method(env, response_class, "getJNIFriendlyHeaders", "()[Ljava/lang/String;");
-            static JavaMethod get_body_method(env, response_class, "getBody", "()Ljava/lang/String;");
-
-            jint http_code = env->CallIntMethod(response, get_http_code_method);
-            jint custom_code = env->CallIntMethod(response, get_custom_code_method);
-            JStringAccessor java_body(env, (jstring) env->CallObjectMethod(response, get_body_method));
-            JObjectArrayAccessor<JStringAccessor, jstring> java_headers(env, static_cast<jobjectArray>(env->CallObjectMethod(response, get_headers_method)));
+            jint http_code = env->CallIntMethod(response, JavaClassGlobalDef::network_transport_response_get_http_code(env));
+            jint custom_code = env->CallIntMethod(response, JavaClassGlobalDef::network_transport_response_get_custom_code(env));
+            JavaLocalRef<jbyteArray> java_body(env, static_cast<jbyteArray>(env->CallObjectMethod(response, JavaClassGlobalDef::network_transport_response_get_body_bytes(env))));
+            JObjectArrayAccessor<JStringAccessor, jstring> java_headers(env, static_cast<jobjectArray>(env->CallObjectMethod(response, JavaClassGlobalDef::network_transport_response_get_headers(env))));
             auto response_headers = std::map<std::string, std::string>();
-            for (int i = 0; i < java_headers.size(); i = i + 2) {
-                JStringAccessor key = java_headers[i];
-                JStringAccessor value = java_headers[i+1];
-                response_headers.insert(std::pair<std::string,std::string>(key,value));
+            {
+                JavaLocalFrame headers_frame(env);
+                for (int i = 0; i < java_headers.size(); i = i + 2) {
+                    JStringAccessor key = java_headers[i];
+                    JStringAccessor value = java_headers[i+1];
+                    response_headers.insert(std::pair<std::string,std::string>(key,value));
+                    headers_frame.step(2);
+                }
+            }
+            // Copied straight into the body of the response.
+            std::string body;
+            if (java_body) {
+                jsize body_size = env->GetArrayLength(java_body.get());
+                body.resize(static_cast<size_t>(body_size));
+                env->GetByteArrayRegion(java_body.get(), 0, body_size, reinterpret_cast<jbyte*>(&body[0]));
             }
-            std::string body = java_body;
-            completionBlock(Response{(int) http_code, (int) custom_code, response_headers, body});
+            completionBlock(Response{(int) http_code, (int) custom_code, std::move(response_headers), std::move(body)});
         }
     }
 
@@ -110,22 +124,20 @@ struct JavaNetworkTransport : public app::GenericNetworkTransport {
     static std::function<void(T, util::Optional<app::AppError>)> create_result_callback(JNIEnv* env, jobject j_callback, const std::function<jobject (JNIEnv*, T)>& success_mapper) {
         return [callback = JavaGlobalRefByCopy(env, j_callback), success_mapper](T result, util::Optional<app::AppError> error) {
             JNIEnv* env = JniUtils::get_env(true);
-
-            static JavaClass java_callback_class(env, "io/realm/internal/jni/OsJNIResultCallback");
-            static JavaMethod java_notify_onerror(env, java_callback_class, "onError", "(Ljava/lang/String;ILjava/lang/String;)V");
-            static JavaMethod java_notify_onsuccess(env, java_callback_class, "onSuccess", "(Ljava/lang/Object;)V");
+            // Callbacks usually run on native threads, release the local refs created by the mappers when done.
+            JavaLocalFrame frame(env);
 
             if (error) {
                 auto err = error.value();
                 std::string error_category = err.error_code.category().name();
                 env->CallVoidMethod(callback.get(),
-                                    java_notify_onerror,
+                                    JavaClassGlobalDef::jni_result_callback_on_error(env),
                                     to_jstring(env, error_category),
                                     err.error_code.value(),
                                     to_jstring(env, err.message));
             } else {
                 jobject success_obj = success_mapper(env, result);
-                env->CallVoidMethod(callback.get(), java_notify_onsuccess, success_obj);
+                env->CallVoidMethod(callback.get(), JavaClassGlobalDef::jni_result_callback_on_success(env), success_obj);
             }
         };
     }
@@ -134,21 +146,18 @@ struct JavaNetworkTransport : public app::GenericNetworkTransport {
     static std::function<void(util::Optional<app::AppError>)> create_void_callback(JNIEnv* env, jobject j_callback) {
         return [callback = JavaGlobalRefByCopy(env, j_callback)](util::Optional<app::AppError> error) {
             JNIEnv* env = JniUtils::get_env(true);
-
-            static JavaClass java_callback_class(env, "io/realm/internal/jni/OsJNIVoidResultCallback");
-            static JavaMethod java_notify_onerror(env, java_callback_class, "onError", "(Ljava/lang/String;ILjava/lang/String;)V");
-            static JavaMethod java_notify_onsuccess(env, java_callback_class, "onSuccess", "(Ljava/lang/Object;)V");
+            JavaLocalFrame frame(env);
 
             if (error) {
                 auto err = error.value();
                 std::string error_category = err.error_code.category().name();
                 env->CallVoidMethod(callback.get(),
-                                    java_notify_onerror,
+                                    JavaClassGlobalDef::jni_void_result_callback_on_error(env),
                                     to_jstring(env, error_category),
                                     err.error_code.value(),
                                     to_jstring(env, err.message));
             } else {
-                env->CallVoidMethod(callback.get(), java_notify_onsuccess, NULL);
+                env->CallVoidMethod(callback.get(), JavaClassGlobalDef::jni_void_result_callback_on_success(env), NULL);
             }
         };
     }
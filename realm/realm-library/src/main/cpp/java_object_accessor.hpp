@@ -24,6 +24,7 @@
 #include <type_traits>
 
 #include "java_accessor.hpp"
+#include "java_binding_context.hpp"
 #include "java_class_global_def.hpp"
 #include "object_accessor.hpp"
 #include "object-store/src/property.hpp"
@@ -337,7 +338,9 @@ public:
             , realm(c.realm)
             , m_parent(std::move(parent))
             , m_property(&prop)
-            , object_schema(prop.type == PropertyType::Object ? &*realm->schema().find(prop.object_type) : c.object_schema)
+            , object_schema(prop.type == PropertyType::Object
+                                ? &JavaBindingContext::get_object_schema(*realm, *m_parent.get_table()->get_link_target(prop.column_key))
+                                : c.object_schema)
     { }
 
     // The use of util::Optional for the following two functions is not a hard
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+
+#include "stdout_logger.hpp"
+
+using namespace realm;
+using namespace realm::jni_util;
+using namespace realm::jni_impl;
+using namespace realm::util;
+
+std::shared_ptr<StdoutLogger> StdoutLogger::shared()
+{
+    // Private constructor, make_shared is not available.
+    static std::shared_ptr<StdoutLogger> stdout_logger(new StdoutLogger());
+    return stdout_logger;
+}
+
+void StdoutLogger::log(Log::Level level, const char* tag, jthrowable, const char* message)
+{
+    const char* level_name;
+    switch (level) {
+        case Log::Level::trace:
+            level_name = "TRACE";
+            break;
+        case Log::Level::debug:
+            level_name = "DEBUG";
+            break;
+        case Log::Level::info:
+            level_name = "INFO";
+            break;
+        case Log::Level::warn:
+            level_name = "WARN";
+            break;
+        case Log::Level::error:
+            level_name = "ERROR";
+            break;
+        case Log::Level::fatal:
+            level_name = "FATAL";
+            break;
+        default: // Cannot get here.
+            throw std::invalid_argument(format("Invalid log level: %1.", level));
+    }
+    if (message) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        fprintf(stdout, "%s %s: %s\n", level_name, tag, message);
+        fflush(stdout);
+    }
+}
+
+namespace realm {
+namespace jni_util {
+
+std::shared_ptr<JniLogger> get_default_logger()
+{
+    return std::static_pointer_cast<JniLogger>(StdoutLogger::shared());
+}
+}
+}
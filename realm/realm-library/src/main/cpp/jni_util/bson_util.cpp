@@ -14,15 +14,454 @@
  * limitations under the License.
  */
 
+#include <cstring>
 #include <string>
+#include "java_class_global_def.hpp"
 #include "util.hpp"
 #include "bson_util.hpp"
 
 // Must match JniBsonProtocol.VALUE from Java
 static const std::string VALUE("value");
 
+using namespace realm;
 using namespace realm::bson;
 using namespace realm::jni_util;
+using namespace realm::_impl;
+
+namespace {
+
+// Element types of the BSON specification, http://bsonspec.org/spec.html
+enum BsonElementType : uint8_t {
+    BSON_DOUBLE = 0x01,
+    BSON_STRING = 0x02,
+    BSON_DOCUMENT = 0x03,
+    BSON_ARRAY = 0x04,
+    BSON_BINARY = 0x05,
+    BSON_OBJECT_ID = 0x07,
+    BSON_BOOL = 0x08,
+    BSON_DATETIME = 0x09,
+    BSON_NULL = 0x0A,
+    BSON_REGEX = 0x0B,
+    BSON_SYMBOL = 0x0E,
+    BSON_INT32 = 0x10,
+    BSON_TIMESTAMP = 0x11,
+    BSON_INT64 = 0x12,
+    BSON_DECIMAL128 = 0x13,
+    BSON_MIN_KEY = 0xFF,
+    BSON_MAX_KEY = 0x7F,
+};
+
+// BSON is little endian, like all the platforms we run on, but don't rely on it.
+class BsonBinaryWriter {
+public:
+    explicit BsonBinaryWriter(std::string& out)
+        : m_out(out)
+    {
+    }
+
+    void write_document(const BsonDocument& document)
+    {
+        size_t start = begin_document();
+        for (const auto& entry : document) {
+            write_element(entry.first, entry.second);
+        }
+        end_document(start);
+    }
+
+    void write_array(const BsonArray& array)
+    {
+        size_t start = begin_document();
+        for (size_t i = 0; i < array.size(); ++i) {
+            write_element(std::to_string(i), array[i]);
+        }
+        end_document(start);
+    }
+
+private:
+    std::string& m_out;
+
+    size_t begin_document()
+    {
+        size_t start = m_out.size();
+        put_uint32(0); // Patched by end_document()
+        return start;
+    }
+
+    void end_document(size_t start)
+    {
+        m_out.push_back('\0');
+        uint32_t size = static_cast<uint32_t>(m_out.size() - start);
+        for (size_t i = 0; i < 4; ++i) {
+            m_out[start + i] = static_cast<char>((size >> (8 * i)) & 0xFF);
+        }
+    }
+
+    void put_uint32(uint32_t value)
+    {
+        for (size_t i = 0; i < 4; ++i) {
+            m_out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    void put_uint64(uint64_t value)
+    {
+        for (size_t i = 0; i < 8; ++i) {
+            m_out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+    }
+
+    void put_cstring(const std::string& value)
+    {
+        if (value.find('\0') != std::string::npos) {
+            throw util::invalid_argument("BSON keys and regular expressions cannot contain null characters.");
+        }
+        m_out.append(value);
+        m_out.push_back('\0');
+    }
+
+    void put_string(const std::string& value)
+    {
+        put_uint32(static_cast<uint32_t>(value.size() + 1));
+        m_out.append(value);
+        m_out.push_back('\0');
+    }
+
+    void put_type(BsonElementType type, const std::string& key)
+    {
+        m_out.push_back(static_cast<char>(type));
+        put_cstring(key);
+    }
+
+    void write_element(const std::string& key, const Bson& value)
+    {
+        switch (value.type()) {
+            case Bson::Type::Null:
+                put_type(BSON_NULL, key);
+                break;
+            case Bson::Type::Int32:
+                put_type(BSON_INT32, key);
+                put_uint32(static_cast<uint32_t>(static_cast<int32_t>(value)));
+                break;
+            case Bson::Type::Int64:
+                put_type(BSON_INT64, key);
+                put_uint64(static_cast<uint64_t>(static_cast<int64_t>(value)));
+                break;
+            case Bson::Type::Bool:
+                put_type(BSON_BOOL, key);
+                m_out.push_back(static_cast<bool>(value) ? 1 : 0);
+                break;
+            case Bson::Type::Double: {
+                put_type(BSON_DOUBLE, key);
+                double d = static_cast<double>(value);
+                uint64_t bits;
+                std::memcpy(&bits, &d, sizeof(bits));
+                put_uint64(bits);
+                break;
+            }
+            case Bson::Type::String:
+                put_type(BSON_STRING, key);
+                put_string(static_cast<std::string>(value));
+                break;
+            case Bson::Type::Binary: {
+                put_type(BSON_BINARY, key);
+                std::vector<char> binary = static_cast<std::vector<char>>(value);
+                put_uint32(static_cast<uint32_t>(binary.size()));
+                m_out.push_back(0x00); // Generic binary subtype
+                m_out.append(binary.data(), binary.size());
+                break;
+            }
+            case Bson::Type::Timestamp: {
+                put_type(BSON_TIMESTAMP, key);
+                MongoTimestamp timestamp = static_cast<MongoTimestamp>(value);
+                put_uint32(static_cast<uint32_t>(timestamp.increment));
+                put_uint32(static_cast<uint32_t>(timestamp.seconds));
+                break;
+            }
+            case Bson::Type::Datetime:
+                put_type(BSON_DATETIME, key);
+                put_uint64(static_cast<uint64_t>(to_milliseconds(static_cast<Timestamp>(value))));
+                break;
+            case Bson::Type::ObjectId: {
+                put_type(BSON_OBJECT_ID, key);
+                JniBsonProtocol::append_object_id(m_out, static_cast<ObjectId>(value));
+                break;
+            }
+            case Bson::Type::Decimal128: {
+                put_type(BSON_DECIMAL128, key);
+                Decimal128 decimal = static_cast<Decimal128>(value);
+                put_uint64(decimal.raw()->w[0]);
+                put_uint64(decimal.raw()->w[1]);
+                break;
+            }
+            case Bson::Type::RegularExpression: {
+                put_type(BSON_REGEX, key);
+                RegularExpression regex = static_cast<RegularExpression>(value);
+                put_cstring(regex.pattern());
+                // Options must be stored in alphabetical order.
+                int options = static_cast<int>(regex.options());
+                std::string flags;
+                if (options & static_cast<int>(RegularExpression::Option::IgnoreCase)) flags.push_back('i');
+                if (options & static_cast<int>(RegularExpression::Option::LocaleDependent)) flags.push_back('l');
+                if (options & static_cast<int>(RegularExpression::Option::Multiline)) flags.push_back('m');
+                if (options & static_cast<int>(RegularExpression::Option::Dotall)) flags.push_back('s');
+                if (options & static_cast<int>(RegularExpression::Option::Unicode)) flags.push_back('u');
+                if (options & static_cast<int>(RegularExpression::Option::Extended)) flags.push_back('x');
+                put_cstring(flags);
+                break;
+            }
+            case Bson::Type::MaxKey:
+                put_type(BSON_MAX_KEY, key);
+                break;
+            case Bson::Type::MinKey:
+                put_type(BSON_MIN_KEY, key);
+                break;
+            case Bson::Type::Document:
+                put_type(BSON_DOCUMENT, key);
+                write_document(static_cast<BsonDocument>(value));
+                break;
+            case Bson::Type::Array:
+                put_type(BSON_ARRAY, key);
+                write_array(static_cast<BsonArray>(value));
+                break;
+        }
+    }
+};
+
+// Every read is bounds checked, the data comes from Java but a corrupt length must not make us read past the end.
+class BsonBinaryReader {
+public:
+    BsonBinaryReader(const char* data, size_t size)
+        : m_data(data)
+        , m_end(data + size)
+    {
+    }
+
+    BsonDocument read_document()
+    {
+        const char* end = begin_document();
+        BsonDocument document;
+        while (m_data < end - 1) {
+            auto type = static_cast<uint8_t>(*m_data++);
+            std::string key = get_cstring();
+            document[key] = read_value(type);
+        }
+        end_document(end);
+        return document;
+    }
+
+    BsonArray read_array()
+    {
+        const char* end = begin_document();
+        BsonArray array;
+        while (m_data < end - 1) {
+            auto type = static_cast<uint8_t>(*m_data++);
+            get_cstring(); // Array keys are just the indices
+            array.push_back(read_value(type));
+        }
+        end_document(end);
+        return array;
+    }
+
+    bool at_end() const
+    {
+        return m_data == m_end;
+    }
+
+private:
+    const char* m_data;
+    const char* m_end;
+
+    [[noreturn]] static void malformed(const char* reason)
+    {
+        throw util::invalid_argument(util::format("Malformed BSON: %1.", reason));
+    }
+
+    void require(size_t bytes) const
+    {
+        if (static_cast<size_t>(m_end - m_data) < bytes) {
+            malformed("unexpected end of data");
+        }
+    }
+
+    const char* begin_document()
+    {
+        const char* start = m_data;
+        uint32_t size = get_uint32();
+        if (size < 5 || static_cast<size_t>(m_end - start) < size) {
+            malformed("invalid document size");
+        }
+        return start + size;
+    }
+
+    void end_document(const char* end)
+    {
+        if (m_data != end - 1 || *m_data != '\0') {
+            malformed("document not terminated");
+        }
+        ++m_data;
+    }
+
+    uint32_t get_uint32()
+    {
+        require(4);
+        uint32_t value = 0;
+        for (size_t i = 0; i < 4; ++i) {
+            value |= static_cast<uint32_t>(static_cast<uint8_t>(m_data[i])) << (8 * i);
+        }
+        m_data += 4;
+        return value;
+    }
+
+    uint64_t get_uint64()
+    {
+        require(8);
+        uint64_t value = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            value |= static_cast<uint64_t>(static_cast<uint8_t>(m_data[i])) << (8 * i);
+        }
+        m_data += 8;
+        return value;
+    }
+
+    std::string get_cstring()
+    {
+        const char* terminator = static_cast<const char*>(std::memchr(m_data, '\0', m_end - m_data));
+        if (!terminator) {
+            malformed("unterminated string");
+        }
+        std::string value(m_data, terminator);
+        m_data = terminator + 1;
+        return value;
+    }
+
+    std::string get_string()
+    {
+        uint32_t size = get_uint32();
+        if (size == 0) {
+            malformed("invalid string size");
+        }
+        require(size);
+        if (m_data[size - 1] != '\0') {
+            malformed("unterminated string");
+        }
+        std::string value(m_data, size - 1);
+        m_data += size;
+        return value;
+    }
+
+    Bson read_value(uint8_t type)
+    {
+        switch (type) {
+            case BSON_NULL:
+                return Bson();
+            case BSON_INT32:
+                return Bson(static_cast<int32_t>(get_uint32()));
+            case BSON_INT64:
+                return Bson(static_cast<int64_t>(get_uint64()));
+            case BSON_BOOL:
+                require(1);
+                return Bson(*m_data++ != 0);
+            case BSON_DOUBLE: {
+                uint64_t bits = get_uint64();
+                double d;
+                std::memcpy(&d, &bits, sizeof(d));
+                return Bson(d);
+            }
+            case BSON_STRING:
+            case BSON_SYMBOL:
+                return Bson(get_string());
+            case BSON_BINARY: {
+                uint32_t size = get_uint32();
+                require(size + size_t(1));
+                ++m_data; // The subtype isn't kept by Bson
+                std::vector<char> binary(m_data, m_data + size);
+                m_data += size;
+                return Bson(binary);
+            }
+            case BSON_TIMESTAMP: {
+                uint32_t increment = get_uint32();
+                uint32_t seconds = get_uint32();
+                return Bson(MongoTimestamp(seconds, increment));
+            }
+            case BSON_DATETIME:
+                return Bson(from_milliseconds(static_cast<jlong>(get_uint64())));
+            case BSON_OBJECT_ID: {
+                require(12);
+                static const char digits[] = "0123456789abcdef";
+                char hex[25];
+                for (size_t i = 0; i < 12; ++i) {
+                    auto byte = static_cast<uint8_t>(m_data[i]);
+                    hex[2 * i] = digits[byte >> 4];
+                    hex[2 * i + 1] = digits[byte & 0x0F];
+                }
+                hex[24] = '\0';
+                m_data += 12;
+                return Bson(ObjectId(hex));
+            }
+            case BSON_DECIMAL128: {
+                Decimal128::Bid128 raw;
+                raw.w[0] = get_uint64();
+                raw.w[1] = get_uint64();
+                return Bson(Decimal128(raw));
+            }
+            case BSON_REGEX: {
+                std::string pattern = get_cstring();
+                std::string options = get_cstring();
+                return Bson(RegularExpression(pattern, options));
+            }
+            case BSON_MAX_KEY:
+                return Bson(MaxKey());
+            case BSON_MIN_KEY:
+                return Bson(MinKey());
+            case BSON_DOCUMENT:
+                return Bson(read_document());
+            case BSON_ARRAY:
+                return Bson(read_array());
+            default:
+                throw util::invalid_argument(util::format("Unsupported BSON type: %1.", static_cast<int>(type)));
+        }
+    }
+};
+
+// Reads the array in place. Only the parser runs while it is held, which never calls into the JVM.
+class CriticalBytes {
+public:
+    CriticalBytes(JNIEnv* env, jbyteArray array)
+        : m_env(env)
+        , m_array(array)
+        , m_size(array ? env->GetArrayLength(array) : 0)
+        , m_data(array ? env->GetPrimitiveArrayCritical(array, nullptr) : nullptr)
+    {
+    }
+
+    ~CriticalBytes()
+    {
+        if (m_data) {
+            m_env->ReleasePrimitiveArrayCritical(m_array, m_data, JNI_ABORT);
+        }
+    }
+
+    CriticalBytes(const CriticalBytes&) = delete;
+    CriticalBytes& operator=(const CriticalBytes&) = delete;
+
+    const char* data() const
+    {
+        return static_cast<const char*>(m_data);
+    }
+
+    size_t size() const
+    {
+        return static_cast<size_t>(m_size);
+    }
+
+private:
+    JNIEnv* m_env;
+    jbyteArray m_array;
+    jsize m_size;
+    void* m_data;
+};
+
+} // anonymous namespace
 
 Bson JniBsonProtocol::string_to_bson(const std::string arg) {
     BsonDocument document(parse(arg));
@@ -55,3 +494,46 @@ jstring JniBsonProtocol::bson_to_jstring(JNIEnv* env, const Bson& bson) {
     std::string r = bson_to_string(bson);
     return to_jstring(env, r);
 };
+
+Bson JniBsonProtocol::binary_to_bson(const char* data, size_t size) {
+    BsonBinaryReader reader(data, size);
+    BsonDocument document(reader.read_document());
+    if (!reader.at_end()) {
+        throw util::invalid_argument("Malformed BSON: unexpected data after document.");
+    }
+    return document[VALUE];
+}
+
+Bson JniBsonProtocol::jbytes_to_bson(JNIEnv* env, const jbyteArray arg) {
+    CriticalBytes bytes(env, arg);
+    if (!bytes.data()) {
+        throw util::invalid_argument("BSON value is missing.");
+    }
+    return binary_to_bson(bytes.data(), bytes.size());
+}
+
+Bson JniBsonProtocol::parse_checked(JNIEnv* env, const jbyteArray arg, const Bson::Type type, const std::string message) {
+    return JniBsonProtocol::check(JniBsonProtocol::jbytes_to_bson(env, arg), type, message);
+}
+
+std::string JniBsonProtocol::bson_to_binary(const Bson& bson) {
+    std::string buffer;
+    BsonBinaryWriter writer(buffer);
+    writer.write_document(BsonDocument{{VALUE, bson}});
+    return buffer;
+}
+
+jbyteArray JniBsonProtocol::bson_to_jbytes(JNIEnv* env, const Bson& bson) {
+    std::string r = bson_to_binary(bson);
+    return JavaClassGlobalDef::new_byte_array(env, BinaryData(r.data(), r.size()));
+}
+
+void JniBsonProtocol::append_object_id(std::string& out, const ObjectId& object_id) {
+    std::string hex = object_id.to_string();
+    auto nibble = [](char c) {
+        return (c <= '9') ? c - '0' : (c | 0x20) - 'a' + 10;
+    };
+    for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+        out.push_back(static_cast<char>((nibble(hex[i]) << 4) | nibble(hex[i + 1])));
+    }
+}
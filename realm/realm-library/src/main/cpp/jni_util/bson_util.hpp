@@ -26,6 +26,10 @@ namespace jni_util {
 using namespace realm::bson;
 
 // Serializes and wraps bson values passed between java and JNI according to JniBsonProtocol.java
+//
+// Values are either passed as extended JSON strings or as binary BSON byte arrays. Both wrap the value in a document
+// with a single "value" field. The binary form avoids parsing and printing text and is used for everything sent to
+// or received from MongoDB Realm.
 class JniBsonProtocol {
 public:
     static Bson string_to_bson(const std::string arg);
@@ -34,6 +38,16 @@ public:
     static Bson parse_checked(JNIEnv* env, const jstring arg, const Bson::Type type, const std::string message);
     static std::string bson_to_string(const Bson& bson);
     static jstring bson_to_jstring(JNIEnv* env, const Bson& bson);
+
+    // Throws util::invalid_argument if the data is not a valid wrapping document.
+    static Bson binary_to_bson(const char* data, size_t size);
+    static Bson jbytes_to_bson(JNIEnv* env, const jbyteArray arg);
+    static Bson parse_checked(JNIEnv* env, const jbyteArray arg, const Bson::Type type, const std::string message);
+    static std::string bson_to_binary(const Bson& bson);
+    static jbyteArray bson_to_jbytes(JNIEnv* env, const Bson& bson);
+
+    // Appends the 12 bytes of the ObjectId, like they are stored in BSON.
+    static void append_object_id(std::string& out, const ObjectId& object_id);
 };
 
 } // jni_util
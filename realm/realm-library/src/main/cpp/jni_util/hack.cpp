@@ -17,10 +17,17 @@
 #include "hack.hpp"
 #include "log.hpp"
 
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include <realm/util/assert.hpp>
 
+#if REALM_WRAP_MEMMOVE && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #ifndef REALM_WRAP_MEMMOVE
 #error "REALM_WRAP_MEMMOVE is not defined!"
 #endif
@@ -40,6 +47,16 @@ typedef void* (*MemMoveFunc)(void *dest, const void *src, size_t n);
 static MemMoveFunc s_wrap_memmove_ptr = &__real_memmove;
 static MemMoveFunc s_wrap_memcpy_ptr = &__real_memcpy;
 
+// NOTE: Nothing in the replacements below may call memmove/memcpy, since those calls would be routed back through
+// the wrappers. This file is compiled with -fno-builtin so the compiler won't turn the copy loops into such calls
+// either.
+
+// Word sized loads and stores which are allowed to alias anything and to be unaligned. The compiler emits whatever
+// the target supports for unaligned access, which is a single LDR/STR on ARMv7.
+typedef size_t __attribute__((__may_alias__, __aligned__(1))) unaligned_word_t;
+typedef size_t __attribute__((__may_alias__)) aligned_word_t;
+static const size_t WORD_SIZE = sizeof(size_t);
+
 static void* hacked_memmove(void* s1, const void* s2, size_t n)
 {
     // adapted from https://github.com/dryc/libc11/blob/master/src/string/memmove.c
@@ -71,6 +88,208 @@ static void* hacked_memcpy(void* s1, const void* s2, size_t n)
     return static_cast<void*>(s1);
 }
 
+// Same semantics as hacked_memmove, but copies a machine word at a time once dest is word aligned. Each word is
+// loaded completely before it is stored, and the copy direction is chosen so that a store never overwrites source
+// bytes which have not been read yet. This keeps overlapping moves correct.
+static void* word_memmove(void* s1, const void* s2, size_t n)
+{
+    unsigned char* dest = static_cast<unsigned char*>(s1);
+    const unsigned char* src = static_cast<const unsigned char*>(s2);
+    if (dest == src || n == 0) {
+        return s1;
+    }
+
+    if (dest < src) {
+        while (n && (reinterpret_cast<uintptr_t>(dest) % WORD_SIZE) != 0) {
+            *dest++ = *src++;
+            n--;
+        }
+        while (n >= WORD_SIZE) {
+            size_t word = *reinterpret_cast<const unaligned_word_t*>(src);
+            *reinterpret_cast<aligned_word_t*>(dest) = word;
+            dest += WORD_SIZE;
+            src += WORD_SIZE;
+            n -= WORD_SIZE;
+        }
+        while (n--) {
+            *dest++ = *src++;
+        }
+    }
+    else {
+        dest += n;
+        src += n;
+        while (n && (reinterpret_cast<uintptr_t>(dest) % WORD_SIZE) != 0) {
+            *--dest = *--src;
+            n--;
+        }
+        while (n >= WORD_SIZE) {
+            dest -= WORD_SIZE;
+            src -= WORD_SIZE;
+            n -= WORD_SIZE;
+            size_t word = *reinterpret_cast<const unaligned_word_t*>(src);
+            *reinterpret_cast<aligned_word_t*>(dest) = word;
+        }
+        while (n--) {
+            *--dest = *--src;
+        }
+    }
+    return s1;
+}
+
+#if defined(__ARM_NEON)
+// Same as word_memmove, but moves 16 bytes per iteration through a NEON register. vld1q/vst1q don't require any
+// alignment, so no alignment prologue is needed. The tail is handled by word_memmove.
+static void* neon_memmove(void* s1, const void* s2, size_t n)
+{
+    uint8_t* dest = static_cast<uint8_t*>(s1);
+    const uint8_t* src = static_cast<const uint8_t*>(s2);
+    if (dest == src || n == 0) {
+        return s1;
+    }
+
+    if (dest < src) {
+        while (n >= 16) {
+            uint8x16_t chunk = vld1q_u8(src);
+            vst1q_u8(dest, chunk);
+            dest += 16;
+            src += 16;
+            n -= 16;
+        }
+        word_memmove(dest, src, n);
+    }
+    else {
+        while (n >= 16) {
+            n -= 16;
+            uint8x16_t chunk = vld1q_u8(src + n);
+            vst1q_u8(dest + n, chunk);
+        }
+        word_memmove(dest, src, n);
+    }
+    return s1;
+}
+#endif
+
+struct MemMoveVariant {
+    const char* name;
+    MemMoveFunc memmove_func;
+    // memcpy doesn't need to care about overlap, but the forward moving memmove implementations are just as fast.
+    MemMoveFunc memcpy_func;
+};
+
+static const MemMoveVariant s_variants[] = {
+    {"byte", &hacked_memmove, &hacked_memcpy},
+    {"word", &word_memmove, &word_memmove},
+#if defined(__ARM_NEON)
+    {"neon", &neon_memmove, &neon_memmove},
+#endif
+};
+
+// Checks the variant against the byte-by-byte reference implementation for all combinations of small offsets and
+// sizes, in both directions, with overlapping and non-overlapping ranges.
+static bool self_test(MemMoveFunc func)
+{
+    static const size_t BUF_SIZE = 96;
+    unsigned char expected[BUF_SIZE];
+    unsigned char actual[BUF_SIZE];
+
+    for (size_t src_offset = 0; src_offset < 2 * WORD_SIZE; ++src_offset) {
+        for (size_t dest_offset = 0; dest_offset < 2 * WORD_SIZE; ++dest_offset) {
+            for (size_t n = 0; n + 2 * WORD_SIZE <= BUF_SIZE && n <= 64; ++n) {
+                // Overlapping, within one buffer.
+                for (size_t i = 0; i < BUF_SIZE; ++i) {
+                    expected[i] = actual[i] = static_cast<unsigned char>(i * 7 + 1);
+                }
+                hacked_memmove(expected + dest_offset, expected + src_offset, n);
+                if (func(actual + dest_offset, actual + src_offset, n) != actual + dest_offset) {
+                    return false;
+                }
+                for (size_t i = 0; i < BUF_SIZE; ++i) {
+                    if (expected[i] != actual[i]) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    // Non-overlapping, between two buffers.
+    unsigned char src[BUF_SIZE];
+    for (size_t i = 0; i < BUF_SIZE; ++i) {
+        src[i] = static_cast<unsigned char>(i * 13 + 5);
+    }
+    for (size_t offset = 0; offset < 2 * WORD_SIZE; ++offset) {
+        size_t n = BUF_SIZE - 2 * WORD_SIZE;
+        for (size_t i = 0; i < BUF_SIZE; ++i) {
+            expected[i] = actual[i] = 0;
+        }
+        hacked_memcpy(expected + offset, src + WORD_SIZE - 1, n);
+        if (func(actual + offset, src + WORD_SIZE - 1, n) != actual + offset) {
+            return false;
+        }
+        for (size_t i = 0; i < BUF_SIZE; ++i) {
+            if (expected[i] != actual[i]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static uint64_t now_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// Times a mix of small and medium sized overlapping moves, similar to what core does when shifting array and
+// B+tree node contents. Takes well below a millisecond per variant on the affected devices.
+static uint64_t benchmark(MemMoveFunc func)
+{
+    static unsigned char buffer[4096 + 64];
+    static const size_t sizes[] = {8, 24, 100, 512, 4000};
+    uint64_t best = UINT64_MAX;
+    for (int round = 0; round < 3; ++round) {
+        uint64_t start = now_ns();
+        for (int i = 0; i < 16; ++i) {
+            for (size_t size : sizes) {
+                func(buffer + 1 + (i % 8), buffer + 9, size);
+                func(buffer + 9, buffer + 1 + (i % 8), size);
+            }
+        }
+        uint64_t elapsed = now_ns() - start;
+        if (elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best;
+}
+
+// Selects the fastest replacement which passes the self test. The byte-by-byte implementation is always the fallback.
+static void select_memmove_replacement()
+{
+    const MemMoveVariant* selected = &s_variants[0];
+    uint64_t selected_time = benchmark(selected->memmove_func);
+    for (const MemMoveVariant& variant : s_variants) {
+        if (&variant == &s_variants[0]) {
+            continue;
+        }
+        if (!self_test(variant.memmove_func)) {
+            Log::w("The '%1' memmove replacement failed its self test and won't be used.", variant.name);
+            continue;
+        }
+        uint64_t time = benchmark(variant.memmove_func);
+        Log::d("memmove replacement '%1': %2 ns.", variant.name, time);
+        if (time < selected_time) {
+            selected = &variant;
+            selected_time = time;
+        }
+    }
+    Log::i("Using the '%1' memmove replacement.", selected->name);
+    s_wrap_memmove_ptr = selected->memmove_func;
+    s_wrap_memcpy_ptr = selected->memcpy_func;
+}
+
 void* __wrap_memmove(void *dest, const void *src, size_t n)
 {
     return (*s_wrap_memmove_ptr)(dest, src, n);
@@ -96,6 +315,7 @@ static void check_memmove()
         Log::e("memmove is broken on this device. Switching to the builtin implementation.");
         s_wrap_memmove_ptr = &hacked_memmove;
         s_wrap_memcpy_ptr  = &hacked_memcpy;
+        select_memmove_replacement();
     }
     free(array);
 }
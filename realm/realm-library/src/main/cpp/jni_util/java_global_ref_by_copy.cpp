@@ -16,6 +16,7 @@
 
 #include "java_global_ref_by_copy.hpp"
 #include "jni_utils.hpp"
+#include "native_object_counter.hpp"
 
 #include <memory>
 
@@ -27,15 +28,22 @@ JavaGlobalRefByCopy::JavaGlobalRefByCopy() : m_ref(nullptr) {
 
 JavaGlobalRefByCopy::JavaGlobalRefByCopy(JNIEnv *env, jobject obj)
         : m_ref(obj ? env->NewGlobalRef(obj) : nullptr) {
+    if (m_ref) {
+        NativeObjectCounter::created(NativeObjectCounter::global_ref);
+    }
 }
 
 JavaGlobalRefByCopy::JavaGlobalRefByCopy(const JavaGlobalRefByCopy &rhs)
         : m_ref(rhs.m_ref ? jni_util::JniUtils::get_env(true)->NewGlobalRef(rhs.m_ref) : nullptr) {
+    if (m_ref) {
+        NativeObjectCounter::created(NativeObjectCounter::global_ref);
+    }
 }
 
 JavaGlobalRefByCopy::~JavaGlobalRefByCopy() {
     if (m_ref) {
         JniUtils::get_env()->DeleteGlobalRef(m_ref);
+        NativeObjectCounter::destroyed(NativeObjectCounter::global_ref);
     }
 }
 
@@ -25,6 +25,7 @@ JavaGlobalRefByMove::~JavaGlobalRefByMove()
 {
     if (m_ref) {
         JniUtils::get_env()->DeleteGlobalRef(m_ref);
+        NativeObjectCounter::destroyed(NativeObjectCounter::global_ref);
     }
 }
 
@@ -38,4 +39,7 @@ JavaGlobalRefByMove& JavaGlobalRefByMove::operator=(JavaGlobalRefByMove&& rhs)
 JavaGlobalRefByMove::JavaGlobalRefByMove(JavaGlobalRefByMove& rhs)
         : m_ref(rhs.m_ref ? jni_util::JniUtils::get_env(true)->NewGlobalRef(rhs.m_ref) : nullptr)
 {
+    if (m_ref) {
+        NativeObjectCounter::created(NativeObjectCounter::global_ref);
+    }
 }
@@ -19,6 +19,8 @@
 
 #include <jni.h>
 
+#include "native_object_counter.hpp"
+
 namespace realm {
 namespace jni_util {
 
@@ -43,6 +45,9 @@ public:
     JavaGlobalRefByMove(JNIEnv* env, jobject obj, bool release_local_ref = false)
         : m_ref(obj ? env->NewGlobalRef(obj) : nullptr)
     {
+        if (m_ref) {
+            NativeObjectCounter::created(NativeObjectCounter::global_ref);
+        }
         if (release_local_ref) {
             env->DeleteLocalRef(obj);
         }
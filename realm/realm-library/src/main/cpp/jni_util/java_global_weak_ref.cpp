@@ -16,6 +16,7 @@
 
 #include "java_global_weak_ref.hpp"
 #include "java_local_ref.hpp"
+#include "native_object_counter.hpp"
 
 using namespace realm::jni_util;
 
@@ -27,12 +28,16 @@ JavaGlobalWeakRef::JavaGlobalWeakRef()
 JavaGlobalWeakRef::JavaGlobalWeakRef(JNIEnv* env, jobject obj)
     : m_weak(obj ? env->NewWeakGlobalRef(obj) : nullptr)
 {
+    if (m_weak) {
+        NativeObjectCounter::created(NativeObjectCounter::weak_global_ref);
+    }
 }
 
 JavaGlobalWeakRef::~JavaGlobalWeakRef()
 {
     if (m_weak) {
         JniUtils::get_env()->DeleteWeakGlobalRef(m_weak);
+        NativeObjectCounter::destroyed(NativeObjectCounter::weak_global_ref);
     }
 }
 
@@ -52,10 +57,17 @@ JavaGlobalWeakRef& JavaGlobalWeakRef::operator=(JavaGlobalWeakRef&& rhs)
 JavaGlobalWeakRef::JavaGlobalWeakRef(const JavaGlobalWeakRef& rhs)
     : m_weak(JniUtils::get_env(true)->NewWeakGlobalRef(rhs.m_weak))
 {
+    if (m_weak) {
+        NativeObjectCounter::created(NativeObjectCounter::weak_global_ref);
+    }
 }
 
 JavaGlobalWeakRef& JavaGlobalWeakRef::operator=(const JavaGlobalWeakRef& rhs)
 {
+    if (this == &rhs) {
+        return *this;
+    }
+    this->~JavaGlobalWeakRef();
     new (this) JavaGlobalWeakRef(rhs);
     return *this;
 }
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REALM_JNI_UTIL_JAVA_LOCAL_FRAME_HPP
+#define REALM_JNI_UTIL_JAVA_LOCAL_FRAME_HPP
+
+#include <jni.h>
+
+namespace realm {
+namespace jni_util {
+
+// RAII wrapper of PushLocalFrame/PopLocalFrame. All local refs created while the frame is alive are released when it
+// is destroyed, so only refs created before the frame, or returned from pop(), are still valid afterwards.
+//
+// Use it when a lot of local refs are created without returning to Java, e.g. when converting native collections in
+// a loop or in callbacks running on native threads, where local refs are otherwise never released. Loops should call
+// step() once per iteration, which releases everything created so far whenever the frame capacity is used up.
+//
+// If the frame can't be pushed, an OutOfMemoryError is pending and the wrapper does nothing.
+class JavaLocalFrame {
+public:
+    static constexpr jint default_capacity = 32;
+
+    explicit JavaLocalFrame(JNIEnv* env, jint capacity = default_capacity)
+        : m_env(env)
+        , m_capacity(capacity)
+        , m_used(0)
+        , m_pushed(env->PushLocalFrame(capacity) == 0)
+    {
+    }
+
+    ~JavaLocalFrame()
+    {
+        if (m_pushed) {
+            m_env->PopLocalFrame(nullptr);
+        }
+    }
+
+    JavaLocalFrame(JavaLocalFrame&&) = delete;
+    JavaLocalFrame& operator=(JavaLocalFrame&&) = delete;
+    JavaLocalFrame(const JavaLocalFrame&) = delete;
+    JavaLocalFrame& operator=(const JavaLocalFrame&) = delete;
+
+    // Records that refs_created local refs were created since the last call. Once the capacity is used up, all local
+    // refs created in the frame are released and a new frame is pushed.
+    inline void step(jint refs_created = 1)
+    {
+        m_used += refs_created;
+        if (m_pushed && m_used >= m_capacity) {
+            m_env->PopLocalFrame(nullptr);
+            m_pushed = m_env->PushLocalFrame(m_capacity) == 0;
+            m_used = 0;
+        }
+    }
+
+    // Pops the frame and returns a local ref to result which is valid in the enclosing frame.
+    template <typename T>
+    inline T pop(T result)
+    {
+        if (!m_pushed) {
+            return result;
+        }
+        m_pushed = false;
+        return static_cast<T>(m_env->PopLocalFrame(result));
+    }
+
+private:
+    JNIEnv* m_env;
+    const jint m_capacity;
+    jint m_used;
+    bool m_pushed;
+};
+
+} // namespace jni_util
+} // namespace realm
+
+#endif // REALM_JNI_UTIL_JAVA_LOCAL_FRAME_HPP
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jni_probe.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <vector>
+
+using namespace realm::jni_util;
+
+std::atomic<bool> JniProbe::s_enabled(false);
+std::atomic<JniProbe::Site*> JniProbe::s_sites(nullptr);
+thread_local JniProbe::Site* JniProbe::t_current_site = nullptr;
+
+JniProbe::Site::Site(const char* function_name) noexcept
+    : name(function_name)
+    , next(s_sites.load(std::memory_order_relaxed))
+{
+    while (!s_sites.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed)) {
+    }
+}
+
+void JniProbe::set_enabled(bool enabled) noexcept
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+void JniProbe::record(Site& site, Clock::time_point start) noexcept
+{
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+    uint64_t ns = elapsed > 0 ? static_cast<uint64_t>(elapsed) : 0;
+    site.calls.fetch_add(1, std::memory_order_relaxed);
+    site.total_ns.fetch_add(ns, std::memory_order_relaxed);
+    uint64_t max = site.max_ns.load(std::memory_order_relaxed);
+    while (ns > max && !site.max_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed)) {
+    }
+}
+
+void JniProbe::reset() noexcept
+{
+    for (Site* site = s_sites.load(std::memory_order_acquire); site; site = site->next) {
+        site->calls.store(0, std::memory_order_relaxed);
+        site->total_ns.store(0, std::memory_order_relaxed);
+        site->max_ns.store(0, std::memory_order_relaxed);
+        site->exceptions.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::string JniProbe::dump()
+{
+    struct Entry {
+        const char* name;
+        uint64_t calls;
+        uint64_t total_ns;
+        uint64_t max_ns;
+        uint64_t exceptions;
+    };
+    std::vector<Entry> entries;
+    for (Site* site = s_sites.load(std::memory_order_acquire); site; site = site->next) {
+        uint64_t calls = site->calls.load(std::memory_order_relaxed);
+        if (calls == 0) {
+            continue;
+        }
+        entries.push_back({site->name, calls, site->total_ns.load(std::memory_order_relaxed),
+                           site->max_ns.load(std::memory_order_relaxed),
+                           site->exceptions.load(std::memory_order_relaxed)});
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.total_ns > b.total_ns;
+    });
+
+    std::string result = "function\tcalls\ttotal_ns\tmax_ns\texceptions\n";
+    char line[128];
+    for (const Entry& entry : entries) {
+        result.append(entry.name);
+        snprintf(line, sizeof(line), "\t%" PRIu64 "\t%" PRIu64 "\t%" PRIu64 "\t%" PRIu64 "\n", entry.calls,
+                 entry.total_ns, entry.max_ns, entry.exceptions);
+        result.append(line);
+    }
+    return result;
+}
+
+bool JniProbe::dump_to_file(const std::string& path)
+{
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file) {
+        return false;
+    }
+    std::string content = dump();
+    bool written = fwrite(content.data(), 1, content.size(), file) == content.size();
+    return fclose(file) == 0 && written;
+}
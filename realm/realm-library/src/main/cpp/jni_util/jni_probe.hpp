@@ -0,0 +1,124 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REALM_JNI_UTIL_JNI_PROBE_HPP
+#define REALM_JNI_UTIL_JNI_PROBE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace realm {
+namespace jni_util {
+
+// Per entry point statistics of the JNI functions: the number of calls, the total and the maximum wall time spent in
+// the function and the number of exceptions converted to Java exceptions by ConvertException while it was running.
+//
+// The probes are only compiled in when REALM_JNI_PROBES is set (see the CMake option of the same name), so regular
+// builds don't pay anything for them. Builds with probes still only record after set_enabled(true) has been called.
+class JniProbe {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // The statistics of one JNI function. Sites are function local statics which link themselves into a global list
+    // on first use, so only functions which have been called at least once show up in dumps.
+    struct Site {
+        explicit Site(const char* function_name) noexcept;
+
+        const char* const name;
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+        std::atomic<uint64_t> exceptions{0};
+        Site* next;
+    };
+
+    // Records one call of the given site for its lifetime.
+    class Scope {
+    public:
+        explicit Scope(Site& site) noexcept
+            : m_site(enabled() ? &site : nullptr)
+        {
+            if (m_site) {
+                m_previous = t_current_site;
+                t_current_site = m_site;
+                m_start = Clock::now();
+            }
+        }
+
+        ~Scope()
+        {
+            if (m_site) {
+                record(*m_site, m_start);
+                t_current_site = m_previous;
+            }
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Site* m_site;
+        Site* m_previous = nullptr;
+        Clock::time_point m_start;
+    };
+
+    static inline bool enabled() noexcept
+    {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    static void set_enabled(bool enabled) noexcept;
+
+    // Called by ConvertException. Attributes the exception to the innermost JNI function running on this thread.
+    static inline void exception_converted() noexcept
+    {
+        if (Site* site = t_current_site) {
+            site->exceptions.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Clears the statistics of all sites.
+    static void reset() noexcept;
+
+    // One line per called function, sorted by total time, descending.
+    static std::string dump();
+
+    // Writes dump() to the given file. Returns false if the file couldn't be written.
+    static bool dump_to_file(const std::string& path);
+
+private:
+    static void record(Site& site, Clock::time_point start) noexcept;
+
+    static std::atomic<bool> s_enabled;
+    static std::atomic<Site*> s_sites;
+    static thread_local Site* t_current_site;
+};
+
+} // namespace jni_util
+} // namespace realm
+
+// Placed as the first statement of every JNIEXPORT function.
+#if REALM_JNI_PROBES
+#define JNI_PROBE()                                                                                                  \
+    static realm::jni_util::JniProbe::Site jni_probe_site(__func__);                                                 \
+    realm::jni_util::JniProbe::Scope jni_probe_scope(jni_probe_site)
+#else
+#define JNI_PROBE()
+#endif
+
+#endif // REALM_JNI_UTIL_JNI_PROBE_HPP
@@ -16,7 +16,9 @@
 
 #include "jni_utils.hpp"
 #include "java_class.hpp"
+#include "java_local_frame.hpp"
 #include "java_method.hpp"
+#include "native_object_counter.hpp"
 
 #include <realm/util/assert.hpp>
 
@@ -26,17 +28,23 @@ using namespace realm::jni_util;
 using namespace std;
 
 static std::unique_ptr<JniUtils> s_instance;
+// Cached JNIEnv of the current thread. A JNIEnv is only valid on the thread it belongs to and stays the same for as
+// long as the thread is attached, so it is safe to cache it until the thread is detached.
+static thread_local JNIEnv* t_env = nullptr;
 
 void JniUtils::initialize(JavaVM* vm, jint vm_version) noexcept
 {
     REALM_ASSERT_DEBUG(!s_instance);
 
     s_instance = std::unique_ptr<JniUtils>(new JniUtils(vm, vm_version));
+    int ret = pthread_key_create(&s_instance->m_attached_thread_key, &JniUtils::detach_on_thread_exit);
+    REALM_ASSERT_RELEASE(ret == 0);
 }
 
 void JniUtils::release()
 {
     REALM_ASSERT_DEBUG(s_instance);
+    pthread_key_delete(s_instance->m_attached_thread_key);
     s_instance.release();
 }
 
@@ -44,31 +52,64 @@ JNIEnv* JniUtils::get_env(bool attach_if_needed)
 {
     REALM_ASSERT_DEBUG(s_instance);
 
+    if (t_env) {
+        return t_env;
+    }
+
     JNIEnv* env;
     if (s_instance->m_vm->GetEnv(reinterpret_cast<void**>(&env), s_instance->m_vm_version) != JNI_OK) {
         if (attach_if_needed) {
             jint ret = s_instance->m_vm->AttachCurrentThread(&env, nullptr);
             REALM_ASSERT_RELEASE(ret == JNI_OK);
+            s_instance->m_attach_count++;
+            // Any non-null value will trigger the destructor when the thread exits.
+            pthread_setspecific(s_instance->m_attached_thread_key, env);
         }
         else {
             REALM_ASSERT_RELEASE(false);
         }
     }
 
+    t_env = env;
     return env;
 }
 
 void JniUtils::detach_current_thread()
 {
+    t_env = nullptr;
+    pthread_setspecific(s_instance->m_attached_thread_key, nullptr);
     s_instance->m_vm->DetachCurrentThread();
+    s_instance->m_detach_count++;
+}
+
+void JniUtils::detach_on_thread_exit(void*)
+{
+    // Don't touch t_env here. Depending on the platform, thread_local storage might already be gone when the pthread
+    // key destructors run.
+    if (s_instance) {
+        s_instance->m_vm->DetachCurrentThread();
+        s_instance->m_detach_count++;
+    }
+}
+
+uint64_t JniUtils::attach_count() noexcept
+{
+    return s_instance ? s_instance->m_attach_count.load() : 0;
+}
+
+uint64_t JniUtils::detach_count() noexcept
+{
+    return s_instance ? s_instance->m_detach_count.load() : 0;
 }
 
 void JniUtils::keep_global_ref(JavaGlobalRefByMove& ref)
 {
     s_instance->m_global_refs.push_back(std::move(ref));
+    // Kept refs are never released before the library is unloaded, so they are only ever counted up.
+    NativeObjectCounter::created(NativeObjectCounter::kept_global_ref);
 }
 
-jobject JniUtils::to_hash_map(JNIEnv* env, std::map<std::string, std::string> map)
+jobject JniUtils::to_hash_map(JNIEnv* env, const std::map<std::string, std::string>& map)
 {
     static JavaClass hash_map_class(env, "java/util/HashMap");
     static JavaMethod hash_map_constructor(env, hash_map_class, "<init>", "(I)V");
@@ -76,17 +117,17 @@ jobject JniUtils::to_hash_map(JNIEnv* env, std::map<std::string, std::string> ma
 
     jobject hash_map = env->NewObject(hash_map_class, hash_map_constructor, (jint) map.size());
 
+    JavaLocalFrame frame(env);
     for (const auto& it : map)
     {
         jstring key = env->NewStringUTF(it.first.c_str());
         jstring value = env->NewStringUTF(it.second.c_str());
 
+        // put() returns the previous value as a local ref as well.
         env->CallObjectMethod(hash_map, hash_map_put,
                               key,
                               value);
-
-        env->DeleteLocalRef(key);
-        env->DeleteLocalRef(value);
+        frame.step(3);
     }
 
     return hash_map;
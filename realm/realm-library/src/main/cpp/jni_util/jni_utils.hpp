@@ -18,7 +18,10 @@
 #define REALM_JNI_UTIL_JNI_UTILS_HPP
 
 #include <jni.h>
+#include <pthread.h>
 
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <map>
 
@@ -41,24 +44,38 @@ public:
     static void release();
     // When attach_if_needed is false, returns the JNIEnv if there is one attached to this thread. Assert if there is
     // none. When attach_if_needed is true, try to attach and return a JNIEnv if necessary.
+    // The JNIEnv is cached per thread, so only the first call on each thread goes through JavaVM::GetEnv. Threads
+    // attached by this call are detached automatically when they exit.
     static JNIEnv* get_env(bool attach_if_needed = false);
     // Detach the current thread from the JVM. Only required for C++ threads that where attached in the first place.
-    // Failing to do so is a resource leak.
+    // Threads attached through get_env() are detached automatically on exit, but calling this earlier is harmless.
     static void detach_current_thread();
+    // Number of times a native thread has been attached to/detached from the JVM by this class since JNI_OnLoad.
+    static uint64_t attach_count() noexcept;
+    static uint64_t detach_count() noexcept;
     // Keep the given global reference until JNI_OnUnload is called.
     static void keep_global_ref(JavaGlobalRefByMove& ref);
     // Transforms a string map into a Java String HashMap
-    static jobject to_hash_map(JNIEnv* env, std::map<std::string, std::string> map);
+    static jobject to_hash_map(JNIEnv* env, const std::map<std::string, std::string>& map);
 
 private:
     JniUtils(JavaVM* vm, jint vm_version) noexcept
         : m_vm(vm)
         , m_vm_version(vm_version)
+        , m_attach_count(0)
+        , m_detach_count(0)
     {
     }
 
+    // pthread key destructor for threads attached in get_env().
+    static void detach_on_thread_exit(void*);
+
     JavaVM* m_vm;
     jint m_vm_version;
+    // Only has a value on threads that were attached by get_env(), so the destructor knows which ones to detach.
+    pthread_key_t m_attached_thread_key;
+    std::atomic<uint64_t> m_attach_count;
+    std::atomic<uint64_t> m_detach_count;
     std::vector<JavaGlobalRefByMove> m_global_refs;
 };
 
@@ -15,11 +15,14 @@
  */
 
 #include <algorithm>
+#include <condition_variable>
+#include <thread>
 
 #include <realm/util/assert.hpp>
 
 #include "jni_util/log.hpp"
 #include "jni_util/java_local_ref.hpp"
+#include "jni_util/jni_utils.hpp"
 
 using namespace realm;
 using namespace realm::jni_util;
@@ -42,21 +45,137 @@ protected:
     void log(Log::Level level, const char* tag, jthrowable throwable, const char* message) override;
 
 private:
-    JavaVM* m_jvm;
     // Global ref of the logger object.
     jobject m_java_logger;
     jmethodID m_log_method;
 
     inline JNIEnv* get_current_env() noexcept
     {
-        JNIEnv* env;
-        if (m_jvm->GetEnv((void**)&env, JNI_VERSION_1_6) != JNI_OK) {
-            m_jvm->AttachCurrentThread(&env, nullptr); // Should never fail
+        return JniUtils::get_env(true);
+    }
+};
+
+namespace realm {
+namespace jni_util {
+
+// Bounded ring buffer of log events for Java loggers, drained by its own thread. The thread keeps a strong reference
+// to the queue, so the queue outlives the Log instance if the process exits while the thread is still running.
+class AsyncLogQueue : public std::enable_shared_from_this<AsyncLogQueue> {
+public:
+    explicit AsyncLogQueue(size_t capacity)
+        : m_events(capacity)
+    {
+        REALM_ASSERT_RELEASE(capacity > 0);
+    }
+
+    void start()
+    {
+        m_thread = std::thread([self = shared_from_this()] {
+            self->run();
+        });
+    }
+
+    // Stops the thread after all queued events have been delivered.
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_not_empty.notify_one();
+        if (m_thread.get_id() == std::this_thread::get_id()) {
+            // A Java logger disabled async delivery from inside its own log() call.
+            m_thread.detach();
+        }
+        else {
+            m_thread.join();
         }
-        return env;
     }
+
+    // Returns false if the queue is full and the event has been dropped.
+    bool push(Log::Level level, const char* tag, const char* message)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_size == m_events.size()) {
+                m_dropped++;
+                return false;
+            }
+            Event& event = m_events[(m_head + m_size) % m_events.size()];
+            event.level = level;
+            event.tag = tag ? tag : "";
+            event.message = message ? message : "";
+            m_size++;
+            m_pushed++;
+        }
+        m_not_empty.notify_one();
+        return true;
+    }
+
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        uint64_t target = m_pushed;
+        m_drained.wait(lock, [&] { return m_delivered >= target || m_stopped; });
+    }
+
+    uint64_t dropped() const noexcept
+    {
+        return m_dropped.load();
+    }
+
+private:
+    struct Event {
+        Log::Level level;
+        std::string tag;
+        std::string message;
+    };
+
+    void run()
+    {
+        std::vector<Event> batch;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_not_empty.wait(lock, [&] { return m_size != 0 || m_stopping; });
+            if (m_size == 0) {
+                break;
+            }
+            // Move the pending events out, so producers are not blocked while calling into Java.
+            batch.clear();
+            while (m_size != 0) {
+                batch.push_back(std::move(m_events[m_head]));
+                m_head = (m_head + 1) % m_events.size();
+                m_size--;
+            }
+            lock.unlock();
+            for (auto& event : batch) {
+                Log::shared().deliver_to_java_loggers(event.level, event.tag.c_str(), event.message.c_str());
+            }
+            lock.lock();
+            m_delivered += batch.size();
+            m_drained.notify_all();
+        }
+        m_stopped = true;
+        m_drained.notify_all();
+    }
+
+    std::vector<Event> m_events;
+    size_t m_head = 0;
+    size_t m_size = 0;
+    uint64_t m_pushed = 0;
+    uint64_t m_delivered = 0;
+    std::atomic<uint64_t> m_dropped{0};
+    bool m_stopping = false;
+    bool m_stopped = false;
+    std::mutex m_mutex;
+    std::condition_variable m_not_empty;
+    std::condition_variable m_drained;
+    std::thread m_thread;
 };
 
+} // namespace jni_util
+} // namespace realm
+
 JniLogger::JniLogger()
     : m_is_java_logger(false)
 {
@@ -74,10 +193,6 @@ JniLogger::JniLogger(bool is_java_logger)
 JavaLogger::JavaLogger(JNIEnv* env, jobject java_logger)
     : JniLogger(true)
 {
-    jint ret = env->GetJavaVM(&m_jvm);
-    if (ret != 0) {
-        throw std::runtime_error(util::format("Failed to get Java vm. Error: %d", ret));
-    }
     m_java_logger = env->NewGlobalRef(java_logger);
     jclass cls = env->GetObjectClass(m_java_logger);
     m_log_method = env->GetMethodID(cls, "log", "(ILjava/lang/String;Ljava/lang/Throwable;Ljava/lang/String;)V");
@@ -107,7 +222,9 @@ bool JavaLogger::is_same_object(JNIEnv* env, jobject java_logger)
 }
 
 Log::Log()
-    : m_loggers()
+    : m_loggers(std::make_shared<const LoggerList>())
+    , m_logger_count(0)
+    , m_java_logger_count(0)
 {
     add_logger(get_default_logger());
 }
@@ -118,6 +235,17 @@ Log& Log::shared()
     return log;
 }
 
+template <typename Func>
+void Log::update_loggers(Func modify)
+{
+    auto loggers = std::make_shared<LoggerList>(*std::atomic_load(&m_loggers));
+    modify(*loggers);
+    m_logger_count = loggers->size();
+    m_java_logger_count = static_cast<size_t>(
+        std::count_if(loggers->begin(), loggers->end(), [](const auto& obj) { return obj->m_is_java_logger; }));
+    std::atomic_store(&m_loggers, std::shared_ptr<const LoggerList>(std::move(loggers)));
+}
+
 void Log::add_java_logger(JNIEnv* env, const jobject java_logger)
 {
     std::shared_ptr<JniLogger> logger = std::make_shared<JavaLogger>(env, java_logger);
@@ -127,30 +255,34 @@ void Log::add_java_logger(JNIEnv* env, const jobject java_logger)
 void Log::remove_java_logger(JNIEnv* env, const jobject java_logger)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_loggers.erase(std::remove_if(m_loggers.begin(), m_loggers.end(),
-                                   [&](const auto& obj) {
-                                       return obj->m_is_java_logger &&
-                                              std::static_pointer_cast<JavaLogger>(obj)->is_same_object(env,
-                                                                                                        java_logger);
-                                   }),
-                    m_loggers.end());
+    update_loggers([&](LoggerList& loggers) {
+        loggers.erase(std::remove_if(loggers.begin(), loggers.end(),
+                                     [&](const auto& obj) {
+                                         return obj->m_is_java_logger &&
+                                                std::static_pointer_cast<JavaLogger>(obj)->is_same_object(
+                                                    env, java_logger);
+                                     }),
+                      loggers.end());
+    });
 }
 
 void Log::add_logger(std::shared_ptr<JniLogger> logger)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    if (std::find(m_loggers.begin(), m_loggers.end(), logger) == m_loggers.end()) {
-        m_loggers.push_back(logger);
-    }
+    update_loggers([&](LoggerList& loggers) {
+        if (std::find(loggers.begin(), loggers.end(), logger) == loggers.end()) {
+            loggers.push_back(logger);
+        }
+    });
 }
 
 void Log::remove_logger(std::shared_ptr<JniLogger> logger)
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-
-    m_loggers.erase(
-        std::remove_if(m_loggers.begin(), m_loggers.end(), [&](const auto& obj) { return obj == logger; }),
-        m_loggers.end());
+    update_loggers([&](LoggerList& loggers) {
+        loggers.erase(std::remove_if(loggers.begin(), loggers.end(), [&](const auto& obj) { return obj == logger; }),
+                      loggers.end());
+    });
 }
 
 void Log::register_default_logger()
@@ -161,7 +293,7 @@ void Log::register_default_logger()
 void Log::clear_loggers()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_loggers.clear();
+    update_loggers([](LoggerList& loggers) { loggers.clear(); });
 }
 
 void Log::set_level(Level level)
@@ -170,12 +302,75 @@ void Log::set_level(Level level)
     CoreLoggerBridge::set_levels(level);
 }
 
-void Log::log(Level level, const char* tag, jthrowable throwable, const char* message)
+void Log::set_async_java_delivery(bool enabled, size_t capacity)
 {
-    if (s_level <= level) {
+    std::shared_ptr<AsyncLogQueue> old_queue;
+    {
         std::lock_guard<std::mutex> lock(m_mutex);
-        for (auto& logger : m_loggers) {
-            logger->log(level, tag, throwable, message);
+        old_queue = std::atomic_load(&m_async_queue);
+        std::shared_ptr<AsyncLogQueue> new_queue;
+        if (enabled) {
+            new_queue = std::make_shared<AsyncLogQueue>(capacity);
+            new_queue->start();
+        }
+        std::atomic_store(&m_async_queue, new_queue);
+    }
+    // Deliver what is left in the old queue outside the lock. Java loggers may log themselves.
+    if (old_queue) {
+        old_queue->stop();
+    }
+}
+
+void Log::flush_async_java_delivery()
+{
+    auto queue = std::atomic_load(&m_async_queue);
+    if (queue) {
+        queue->flush();
+    }
+}
+
+uint64_t Log::async_dropped_count() const noexcept
+{
+    auto queue = std::atomic_load(&m_async_queue);
+    return queue ? queue->dropped() : 0;
+}
+
+void Log::log(Level level, const char* tag, jthrowable throwable, const char* message)
+{
+    if (s_level > level) {
+        return;
+    }
+
+    auto loggers = std::atomic_load(&m_loggers);
+    std::shared_ptr<AsyncLogQueue> queue;
+    if (!throwable && m_java_logger_count.load(std::memory_order_relaxed) != 0) {
+        queue = std::atomic_load(&m_async_queue);
+    }
+
+    for (auto& logger : *loggers) {
+        if (queue && logger->m_is_java_logger) {
+            continue;
+        }
+        logger->log(level, tag, throwable, message);
+    }
+    if (queue) {
+        queue->push(level, tag, message);
+    }
+}
+
+void Log::deliver_to_java_loggers(Level level, const char* tag, const char* message)
+{
+    auto loggers = std::atomic_load(&m_loggers);
+    for (auto& logger : *loggers) {
+        if (logger->m_is_java_logger) {
+            logger->log(level, tag, nullptr, message);
+            // There is no Java caller on this thread to propagate a logger's exception to. Report and clear it, so
+            // the next logger can still be called.
+            JNIEnv* env = JniUtils::get_env(true);
+            if (env->ExceptionCheck()) {
+                env->ExceptionDescribe();
+                env->ExceptionClear();
+            }
         }
     }
 }
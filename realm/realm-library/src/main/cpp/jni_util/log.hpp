@@ -19,6 +19,7 @@
 
 #include <jni.h>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -33,9 +34,13 @@ namespace realm {
 namespace jni_util {
 
 class JniLogger;
+class AsyncLogQueue;
 
 // This is built for Realm logging, bother for Java and native side.
 // Multiple loggers can be registered. All registered loggers will receive the same log events.
+//
+// The logger list is copy-on-write. Adding or removing a logger takes m_mutex and publishes a new list, while log()
+// only loads the current list and never blocks on other log calls.
 class Log {
 public:
     enum Level {
@@ -68,6 +73,24 @@ public:
         return s_level;
     };
 
+    // Returns true if a message with the given level would reach at least one logger. Use this to avoid formatting
+    // messages nobody will see.
+    inline bool is_enabled(Level level) const noexcept
+    {
+        return s_level <= level && m_logger_count.load(std::memory_order_relaxed) != 0;
+    }
+
+    // When enabled, messages for Java loggers are copied into a bounded queue and delivered to Java by a dedicated
+    // thread, so the logging thread never calls into the JVM. Messages with a throwable are still delivered
+    // synchronously since the local ref is only valid on the calling thread. If the queue is full, new messages are
+    // dropped and counted in async_dropped_count().
+    void set_async_java_delivery(bool enabled, size_t capacity = DEFAULT_ASYNC_QUEUE_CAPACITY);
+    // Blocks until all messages queued before this call have been delivered to the Java loggers.
+    void flush_async_java_delivery();
+    uint64_t async_dropped_count() const noexcept;
+
+    static constexpr size_t DEFAULT_ASYNC_QUEUE_CAPACITY = 1024;
+
     void log(Level level, const char* tag, jthrowable throwable, const char* message);
 
     inline void log(Level level, const char* tag, const char* message)
@@ -104,32 +127,44 @@ public:
     template <typename... Args>
     inline static void t(const char* fmt, Args&&... args)
     {
-        shared().log(trace, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        if (shared().is_enabled(trace)) {
+            shared().log(trace, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        }
     }
     template <typename... Args>
     inline static void d(const char* fmt, Args&&... args)
     {
-        shared().log(debug, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        if (shared().is_enabled(debug)) {
+            shared().log(debug, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        }
     }
     template <typename... Args>
     inline static void i(const char* fmt, Args&&... args)
     {
-        shared().log(info, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        if (shared().is_enabled(info)) {
+            shared().log(info, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        }
     }
     template <typename... Args>
     inline static void w(const char* fmt, Args&&... args)
     {
-        shared().log(warn, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        if (shared().is_enabled(warn)) {
+            shared().log(warn, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        }
     }
     template <typename... Args>
     inline static void e(const char* fmt, Args&&... args)
     {
-        shared().log(error, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        if (shared().is_enabled(error)) {
+            shared().log(error, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        }
     }
     template <typename... Args>
     inline static void f(const char* fmt, Args&&... args)
     {
-        shared().log(fatal, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        if (shared().is_enabled(fatal)) {
+            shared().log(fatal, REALM_JNI_TAG, nullptr, util::format(fmt, {util::Printable(args)...}).c_str());
+        }
     }
 
     static realm::util::RootLogger::Level convert_to_core_log_level(Level level);
@@ -143,9 +178,22 @@ public:
     static Level s_level;
 
 private:
+    using LoggerList = std::vector<std::shared_ptr<JniLogger>>;
+
     Log();
 
-    std::vector<std::shared_ptr<JniLogger>> m_loggers;
+    // Publishes a modified copy of the current logger list. Must be called with m_mutex held.
+    template <typename Func>
+    void update_loggers(Func modify);
+    // Called on the async delivery thread.
+    void deliver_to_java_loggers(Level level, const char* tag, const char* message);
+    friend class AsyncLogQueue;
+
+    // Read with std::atomic_load and written with std::atomic_store under m_mutex.
+    std::shared_ptr<const LoggerList> m_loggers;
+    std::atomic<size_t> m_logger_count;
+    std::atomic<size_t> m_java_logger_count;
+    std::shared_ptr<AsyncLogQueue> m_async_queue;
     std::mutex m_mutex;
     // Log tag for generic Realm JNI.
     static const char* REALM_JNI_TAG;
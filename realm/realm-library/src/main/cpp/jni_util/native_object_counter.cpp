@@ -0,0 +1,29 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_object_counter.hpp"
+
+using namespace realm::jni_util;
+
+std::atomic<int64_t> NativeObjectCounter::s_counts[NativeObjectCounter::kind_count] = {};
+std::atomic<int64_t> NativeObjectCounter::s_high_water_marks[NativeObjectCounter::kind_count] = {};
+
+void NativeObjectCounter::reset_high_water_marks() noexcept
+{
+    for (int i = 0; i < kind_count; ++i) {
+        s_high_water_marks[i].store(s_counts[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REALM_JNI_UTIL_NATIVE_OBJECT_COUNTER_HPP
+#define REALM_JNI_UTIL_NATIVE_OBJECT_COUNTER_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace realm {
+namespace jni_util {
+
+// Process wide counters of the native objects and JNI references owned by the JNI layer. Every counted kind keeps
+// the number of currently live instances and the highest number seen since the last reset. This is meant for
+// attributing native memory growth and diagnosing global reference table overflows, so all updates are relaxed
+// atomics and cheap enough to stay enabled in release builds.
+//
+// The values of Kind must match the KIND_* constants in io.realm.internal.NativeObjectCounters.
+class NativeObjectCounter {
+public:
+    enum Kind {
+        obj = 0,               // Obj* handed to Java row accessors.
+        query = 1,             // Query* handed to Java TableQuery.
+        results = 2,           // ResultsWrapper.
+        list = 3,              // ListWrapper.
+        object = 4,            // ObjectWrapper.
+        collection_change = 5, // CollectionChangeSet copies handed to Java.
+        object_builder = 6,    // Property maps of OsObjectBuilder.
+        global_ref = 7,        // Global refs held by JavaGlobalRefByMove and JavaGlobalRefByCopy.
+        weak_global_ref = 8,   // Weak global refs held by JavaGlobalWeakRef.
+        kept_global_ref = 9,   // Global refs kept alive by JniUtils::keep_global_ref.
+    };
+    static constexpr int kind_count = 10;
+
+    static inline void created(Kind kind) noexcept
+    {
+        int64_t current = s_counts[kind].fetch_add(1, std::memory_order_relaxed) + 1;
+        int64_t max = s_high_water_marks[kind].load(std::memory_order_relaxed);
+        while (current > max &&
+               !s_high_water_marks[kind].compare_exchange_weak(max, current, std::memory_order_relaxed)) {
+        }
+    }
+
+    // Counts the given newly allocated object and returns it, so it can wrap a new expression.
+    template <typename T>
+    static inline T* created(Kind kind, T* ptr) noexcept
+    {
+        created(kind);
+        return ptr;
+    }
+
+    static inline void destroyed(Kind kind) noexcept
+    {
+        s_counts[kind].fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    static inline int64_t count(Kind kind) noexcept
+    {
+        return s_counts[kind].load(std::memory_order_relaxed);
+    }
+
+    static inline int64_t high_water_mark(Kind kind) noexcept
+    {
+        return s_high_water_marks[kind].load(std::memory_order_relaxed);
+    }
+
+    // Resets the high-water marks to the current counts.
+    static void reset_high_water_marks() noexcept;
+
+private:
+    static std::atomic<int64_t> s_counts[kind_count];
+    static std::atomic<int64_t> s_high_water_marks[kind_count];
+};
+
+} // namespace jni_util
+} // namespace realm
+
+#endif // REALM_JNI_UTIL_NATIVE_OBJECT_COUNTER_HPP
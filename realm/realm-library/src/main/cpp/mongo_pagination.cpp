@@ -0,0 +1,144 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "mongo_pagination.hpp"
+
+#include <realm/util/optional.hpp>
+
+#include "util.hpp"
+
+using namespace realm;
+using namespace realm::bson;
+
+static const std::string ID("_id");
+
+static bool has_key(const BsonDocument& document, const std::string& key)
+{
+    for (const auto& entry : document) {
+        if (entry.first == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int sort_direction(const std::string& key, const Bson& direction)
+{
+    double value;
+    switch (direction.type()) {
+        case Bson::Type::Int32:
+            value = static_cast<int32_t>(direction);
+            break;
+        case Bson::Type::Int64:
+            value = static_cast<double>(static_cast<int64_t>(direction));
+            break;
+        case Bson::Type::Double:
+            value = static_cast<double>(direction);
+            break;
+        default:
+            throw util::invalid_argument(
+                util::format("Paginated results can only be sorted by field values, not by '%1'.", key));
+    }
+    return value < 0 ? -1 : 1;
+}
+
+// Resolves dotted paths, like the server does for sort keys.
+static Bson field_value(const BsonDocument& document, const std::string& path)
+{
+    BsonDocument current = document;
+    size_t begin = 0;
+    while (true) {
+        size_t end = path.find('.', begin);
+        std::string key = path.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+        util::Optional<Bson> value;
+        for (const auto& entry : current) {
+            if (entry.first == key) {
+                value = entry.second;
+                break;
+            }
+        }
+        if (!value || (end != std::string::npos && value->type() != Bson::Type::Document)) {
+            break;
+        }
+        if (end == std::string::npos) {
+            return *value;
+        }
+        current = static_cast<BsonDocument>(*value);
+        begin = end + 1;
+    }
+    throw util::invalid_argument(
+        util::format("Paginated results must contain the sort field '%1' in every document.", path));
+}
+
+BsonDocument MongoPagination::unique_sort(const BsonDocument& sort)
+{
+    BsonDocument unique;
+    for (const auto& entry : sort) {
+        unique[entry.first] = Bson(int32_t(sort_direction(entry.first, entry.second)));
+    }
+    if (!has_key(unique, ID)) {
+        unique[ID] = Bson(int32_t(1));
+    }
+    return unique;
+}
+
+// For the sort {a: 1, b: -1, _id: 1} the documents after `last` are:
+// {$or: [{a: {$gt: last.a}},
+//        {a: last.a, b: {$lt: last.b}},
+//        {a: last.a, b: last.b, _id: {$gt: last._id}}]}
+BsonDocument MongoPagination::continuation_filter(const BsonDocument& sort, const BsonDocument& last)
+{
+    BsonArray alternatives;
+    BsonDocument equal_prefix;
+    for (const auto& entry : sort) {
+        Bson value = field_value(last, entry.first);
+        BsonDocument alternative = equal_prefix;
+        alternative[entry.first] =
+            BsonDocument({{sort_direction(entry.first, entry.second) > 0 ? "$gt" : "$lt", value}});
+        alternatives.push_back(alternative);
+        equal_prefix[entry.first] = value;
+    }
+    return BsonDocument({{"$or", alternatives}});
+}
+
+BsonDocument MongoPagination::and_filter(const BsonDocument& filter, const BsonDocument& continuation)
+{
+    if (filter.size() == 0) {
+        return continuation;
+    }
+    return BsonDocument({{"$and", BsonArray({filter, continuation})}});
+}
+
+BsonArray MongoPagination::page(BsonArray documents, const BsonDocument& sort, uint64_t page_size)
+{
+    Bson continuation;
+    // A short page is the last one, this saves a request which would return nothing.
+    if (!documents.empty() && documents.size() >= page_size) {
+        const Bson& last = documents.back();
+        if (last.type() != Bson::Type::Document) {
+            continuation = Bson("Paginated results must be documents.");
+        }
+        else {
+            try {
+                continuation = continuation_filter(sort, static_cast<BsonDocument>(last));
+            }
+            catch (const std::exception& e) {
+                continuation = Bson(std::string(e.what()));
+            }
+        }
+    }
+    return BsonArray({Bson(std::move(documents)), continuation});
+}
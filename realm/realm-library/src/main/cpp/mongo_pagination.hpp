@@ -0,0 +1,54 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REALM_MONGO_PAGINATION_HPP
+#define REALM_MONGO_PAGINATION_HPP
+
+#include <cstdint>
+
+#include <util/bson/bson.hpp>
+
+namespace realm {
+
+// Keyset pagination of remote find and aggregate queries.
+//
+// Results are fetched in pages of a limited size, ordered by a sort which is made unique by appending "_id". Instead
+// of skipping the documents already fetched, the query of the next page is restricted to the documents sorting after
+// the last document of the previous page. The server can use the indexes of the sort fields, so fetching a page
+// costs the same no matter how deep into the results it is.
+//
+// All result documents must contain the sort fields, each sort field must hold values of a single BSON type.
+class MongoPagination {
+public:
+    // Returns the sort with {"_id": 1} appended, unless the sort already includes "_id".
+    // Throws util::invalid_argument if a sort direction is not a number, e.g. a {$meta: "textScore"} sort.
+    static bson::BsonDocument unique_sort(const bson::BsonDocument& sort);
+
+    // Returns the filter matching the documents after `last` in the order of `sort`, which must be a unique sort.
+    // Throws util::invalid_argument if `last` is missing a sort field.
+    static bson::BsonDocument continuation_filter(const bson::BsonDocument& sort, const bson::BsonDocument& last);
+
+    // Returns the filter matching both filters.
+    static bson::BsonDocument and_filter(const bson::BsonDocument& filter, const bson::BsonDocument& continuation);
+
+    // Returns the page passed to Java: [documents, continuation filter]. The filter is null after the last page and
+    // an error message if the next page cannot be queried. Does not throw, as it runs in the completion handlers.
+    static bson::BsonArray page(bson::BsonArray documents, const bson::BsonDocument& sort, uint64_t page_size);
+};
+
+} // namespace realm
+
+#endif // REALM_MONGO_PAGINATION_HPP
@@ -0,0 +1,1044 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "native_network_transport.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <realm/util/assert.hpp>
+#include <realm/util/basic_system_errors.hpp>
+#include <realm/util/misc_ext_errors.hpp>
+#include <realm/util/network.hpp>
+#include <realm/util/network_ssl.hpp>
+#include <realm/util/optional.hpp>
+
+#include "jni_util/log.hpp"
+
+using namespace realm;
+using namespace realm::app;
+using namespace realm::jni_util;
+
+namespace network = realm::util::network;
+namespace ssl = realm::util::network::ssl;
+
+namespace {
+
+// Longest status or header line accepted from a server.
+constexpr size_t max_line_size = 8192;
+// Largest response body accepted from a server. Larger bodies fail the request instead of exhausting memory.
+constexpr size_t max_body_size = 256 * 1024 * 1024;
+
+bool equals_ignore_case(const std::string& a, const char* b)
+{
+    size_t size = std::strlen(b);
+    if (a.size() != size) {
+        return false;
+    }
+    for (size_t i = 0; i < size; ++i) {
+        if (std::tolower(static_cast<unsigned char>(a[i])) != std::tolower(static_cast<unsigned char>(b[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string trim(const char* begin, const char* end)
+{
+    while (begin < end && (*begin == ' ' || *begin == '\t')) {
+        ++begin;
+    }
+    while (end > begin && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r' || end[-1] == '\n')) {
+        --end;
+    }
+    return std::string(begin, end);
+}
+
+const char* method_name(HttpMethod method)
+{
+    switch (method) {
+        case HttpMethod::get:
+            return "GET";
+        case HttpMethod::post:
+            return "POST";
+        case HttpMethod::patch:
+            return "PATCH";
+        case HttpMethod::put:
+            return "PUT";
+        case HttpMethod::del:
+            return "DELETE";
+    }
+    return "GET";
+}
+
+struct Url {
+    bool tls = false;
+    std::string host;
+    network::Endpoint::port_type port = 0;
+    std::string target; // Path and query.
+
+    // Connections are only reused for requests with the same origin.
+    std::string origin() const
+    {
+        return std::string(tls ? "https://" : "http://") + host + ":" + std::to_string(port);
+    }
+
+    std::string host_header() const
+    {
+        bool default_port = (tls && port == 443) || (!tls && port == 80);
+        std::string name = host.find(':') != std::string::npos ? "[" + host + "]" : host;
+        return default_port ? name : name + ":" + std::to_string(port);
+    }
+};
+
+bool parse_url(const std::string& url, Url& out)
+{
+    size_t authority_begin;
+    if (url.compare(0, 8, "https://") == 0) {
+        out.tls = true;
+        authority_begin = 8;
+    }
+    else if (url.compare(0, 7, "http://") == 0) {
+        out.tls = false;
+        authority_begin = 7;
+    }
+    else {
+        return false;
+    }
+    size_t authority_end = url.find_first_of("/?#", authority_begin);
+    std::string authority = url.substr(authority_begin, authority_end - authority_begin);
+    std::string target = authority_end == std::string::npos ? "/" : url.substr(authority_end);
+    target = target.substr(0, target.find('#'));
+    if (target.empty() || target[0] == '?') {
+        target = "/" + target;
+    }
+
+    std::string port;
+    if (!authority.empty() && authority[0] == '[') {
+        size_t close = authority.find(']');
+        if (close == std::string::npos) {
+            return false;
+        }
+        out.host = authority.substr(1, close - 1);
+        if (close + 1 < authority.size()) {
+            if (authority[close + 1] != ':') {
+                return false;
+            }
+            port = authority.substr(close + 2);
+        }
+    }
+    else {
+        size_t colon = authority.rfind(':');
+        out.host = authority.substr(0, colon);
+        if (colon != std::string::npos) {
+            port = authority.substr(colon + 1);
+        }
+    }
+    if (out.host.empty()) {
+        return false;
+    }
+    if (port.empty()) {
+        out.port = out.tls ? 443 : 80;
+    }
+    else {
+        char* end;
+        unsigned long value = std::strtoul(port.c_str(), &end, 10);
+        if (*end != '\0' || value == 0 || value > 65535) {
+            return false;
+        }
+        out.port = static_cast<network::Endpoint::port_type>(value);
+    }
+    out.target = std::move(target);
+    return true;
+}
+
+// Resolves a Location header against the URL of the request.
+bool resolve_location(const Url& base, const std::string& location, Url& out)
+{
+    if (location.compare(0, 7, "http://") == 0 || location.compare(0, 8, "https://") == 0) {
+        return parse_url(location, out);
+    }
+    if (location.empty() || location[0] != '/' || location.compare(0, 2, "//") == 0) {
+        return false;
+    }
+    out = base;
+    out.target = location;
+    return true;
+}
+
+// Requests which can be sent again without changing the result, if it is unknown whether the server received them.
+bool is_idempotent(HttpMethod method)
+{
+    return method == HttpMethod::get || method == HttpMethod::put || method == HttpMethod::del;
+}
+
+// Parses a non-negative decimal (Content-Length) or hexadecimal (chunk size) length. Chunk sizes may be followed by
+// extensions.
+bool parse_length(const std::string& value, int base, size_t& out)
+{
+    const char* begin = value.c_str();
+    while (*begin == ' ' || *begin == '\t') {
+        ++begin;
+    }
+    if (!std::isxdigit(static_cast<unsigned char>(*begin))) {
+        return false;
+    }
+    char* end;
+    errno = 0;
+    unsigned long long length = std::strtoull(begin, &end, base);
+    if (errno == ERANGE || end == begin) {
+        return false;
+    }
+    while (*end == ' ' || *end == '\t') {
+        ++end;
+    }
+    if (*end != '\0' && !(base == 16 && *end == ';')) {
+        return false;
+    }
+    if (length > max_body_size) {
+        return false;
+    }
+    out = static_cast<size_t>(length);
+    return true;
+}
+
+Response error_response(int custom_status_code, std::string message)
+{
+    return Response{0, custom_status_code, {}, std::move(message)};
+}
+
+struct PendingRequest {
+    Request request;
+    Url url;
+    std::function<void(const Response)> completion_block;
+    size_t redirects = 0;
+    // Set when the request has been sent again after failing on a reused connection which the server had closed.
+    bool retried = false;
+};
+
+} // anonymous namespace
+
+class NativeHttpClient::Impl {
+public:
+    explicit Impl(Config config);
+    ~Impl();
+
+    void send(PendingRequest pending);
+    bool is_client_thread() const noexcept;
+
+private:
+    class Connection;
+
+    struct Origin {
+        std::vector<std::shared_ptr<Connection>> connections;
+        std::deque<PendingRequest> queue;
+    };
+
+    // The rest is only accessed on the thread of the client.
+    void dispatch(PendingRequest pending);
+    void complete(PendingRequest& pending, Response response);
+    void on_response(Connection& connection, PendingRequest pending, Response response);
+    void on_failure(Connection& connection, PendingRequest pending, bool retry, std::string message);
+    void fail_all(int custom_status_code, const std::string& message);
+    void on_idle(Connection& connection);
+    void remove(Connection& connection);
+    ssl::Context& ssl_context();
+    void shut_down();
+
+    const Config m_config;
+    network::Service m_service;
+    network::DeadlineTimer m_keep_running;
+    std::unique_ptr<ssl::Context> m_ssl_context;
+    std::map<std::string, Origin> m_origins;
+    std::thread m_thread;
+};
+
+// One keep-alive connection. Only one request is in flight at a time, responses are read completely before the
+// connection is handed back to the pool.
+class NativeHttpClient::Impl::Connection : public std::enable_shared_from_this<NativeHttpClient::Impl::Connection> {
+public:
+    Connection(Impl& client, const Url& url)
+        : m_client(client)
+        , m_url(url)
+        , m_origin(url.origin())
+        , m_resolver(client.m_service)
+        , m_socket(client.m_service)
+    {
+    }
+
+    const std::string& origin() const noexcept
+    {
+        return m_origin;
+    }
+
+    bool busy() const noexcept
+    {
+        return m_busy;
+    }
+
+    bool closed() const noexcept
+    {
+        return m_closed;
+    }
+
+    void start(PendingRequest pending)
+    {
+        REALM_ASSERT(!m_busy && !m_closed);
+        m_busy = true;
+        m_pending = std::move(pending);
+        m_reused = m_connected;
+        uint64_t id = ++m_operation_id;
+        if (m_timer) {
+            m_timer->cancel();
+        }
+        if (m_pending.request.timeout_ms > 0) {
+            wait(std::chrono::milliseconds(m_pending.request.timeout_ms), [this, id] {
+                fail(id, "Request timed out: " + m_pending.request.url);
+            });
+        }
+        if (m_connected) {
+            write_request(id);
+        }
+        else {
+            resolve(id);
+        }
+    }
+
+    // Closes the connection after idle_timeout unless a new request is started before.
+    void wait_idle()
+    {
+        uint64_t id = ++m_operation_id;
+        wait(m_client.m_config.idle_timeout, [this, id] {
+            if (id == m_operation_id && !m_busy) {
+                close();
+                m_client.remove(*this);
+            }
+        });
+    }
+
+    void close()
+    {
+        if (m_closed) {
+            return;
+        }
+        m_closed = true;
+        ++m_operation_id;
+        if (m_timer) {
+            m_timer->cancel();
+        }
+        m_resolver.cancel();
+        m_socket.close();
+    }
+
+    // Fails the request in flight, if any. Used when the client shuts down.
+    util::Optional<PendingRequest> take_pending()
+    {
+        if (!m_busy) {
+            return util::none;
+        }
+        m_busy = false;
+        return std::move(m_pending);
+    }
+
+private:
+    template <class H>
+    void wait(std::chrono::milliseconds delay, H handler)
+    {
+        // A fresh timer, so a canceled wait never has to complete before the next one starts.
+        m_timer.emplace(m_client.m_service);
+        m_timer->async_wait(delay, [self = shared_from_this(), handler = std::move(handler)](std::error_code ec) {
+            if (ec != util::error::operation_aborted) {
+                handler();
+            }
+        });
+    }
+
+    void resolve(uint64_t id)
+    {
+        network::Resolver::Query query(m_url.host, std::to_string(m_url.port));
+        m_resolver.async_resolve(query, [self = shared_from_this(), id](std::error_code ec,
+                                                                         network::Endpoint::List endpoints) {
+            if (id != self->m_operation_id) {
+                return;
+            }
+            if (ec) {
+                self->fail(id, "Cannot resolve '" + self->m_url.host + "': " + ec.message());
+                return;
+            }
+            self->m_endpoints = std::move(endpoints);
+            self->connect(id, 0);
+        });
+    }
+
+    void connect(uint64_t id, size_t endpoint_index)
+    {
+        if (endpoint_index >= m_endpoints.size()) {
+            fail(id, "Cannot connect to '" + m_url.host + "'");
+            return;
+        }
+        m_socket.async_connect(*(m_endpoints.begin() + endpoint_index),
+                               [self = shared_from_this(), id, endpoint_index](std::error_code ec) {
+                                   if (id != self->m_operation_id) {
+                                       return;
+                                   }
+                                   if (ec) {
+                                       self->m_socket.close();
+                                       self->connect(id, endpoint_index + 1);
+                                       return;
+                                   }
+                                   self->on_connected(id);
+                               });
+    }
+
+    void on_connected(uint64_t id)
+    {
+        m_socket.set_option(network::SocketBase::no_delay(true));
+        if (!m_url.tls) {
+            m_connected = true;
+            write_request(id);
+            return;
+        }
+        const Config& config = m_client.m_config;
+        m_ssl_stream.emplace(m_socket, m_client.ssl_context(), ssl::Stream::client);
+        m_ssl_stream->set_host_name(m_url.host);
+        m_ssl_stream->set_server_port(m_url.port);
+        if (config.ssl_verify_callback) {
+            m_ssl_stream->use_verify_callback(config.ssl_verify_callback);
+        }
+        m_ssl_stream->set_verify_mode(ssl::VerifyMode::peer);
+        m_ssl_stream->async_handshake([self = shared_from_this(), id](std::error_code ec) {
+            if (id != self->m_operation_id) {
+                return;
+            }
+            if (ec) {
+                self->fail(id, "TLS handshake with '" + self->m_url.host + "' failed: " + ec.message());
+                return;
+            }
+            self->m_connected = true;
+            self->write_request(id);
+        });
+    }
+
+    void write_request(uint64_t id)
+    {
+        const Request& request = m_pending.request;
+        const Config& config = m_client.m_config;
+        bool send_body = !(request.method == HttpMethod::get && request.body.empty());
+
+        std::string& out = m_write_buffer;
+        out.clear();
+        out.reserve(512 + (send_body ? request.body.size() : 0));
+        out.append(method_name(request.method)).append(" ").append(m_pending.url.target).append(" HTTP/1.1\r\n");
+        out.append("Host: ").append(m_url.host_header()).append("\r\n");
+        auto append_header = [&](const std::string& name, const std::string& value) {
+            if (equals_ignore_case(name, "Host") || equals_ignore_case(name, "Content-Length") ||
+                equals_ignore_case(name, "Connection")) {
+                return;
+            }
+            out.append(name).append(": ").append(value).append("\r\n");
+        };
+        for (const auto& header : config.custom_headers) {
+            append_header(header.first, header.second);
+        }
+        for (const auto& header : request.headers) {
+            if (header.first == "Authorization") {
+                append_header(config.authorization_header_name, header.second);
+            }
+            else {
+                append_header(header.first, header.second);
+            }
+        }
+        if (send_body) {
+            out.append("Content-Length: ").append(std::to_string(request.body.size())).append("\r\n");
+        }
+        out.append("\r\n");
+        if (send_body) {
+            out.append(request.body);
+        }
+
+        async_write(out.data(), out.size(), [self = shared_from_this(), id](std::error_code ec, size_t) {
+            if (id != self->m_operation_id) {
+                return;
+            }
+            if (ec) {
+                // The request was not sent completely, so the server cannot have executed it.
+                self->fail(id, "Cannot send request: " + ec.message(), true);
+                return;
+            }
+            self->m_response = Response{0, 0, {}, {}};
+            self->m_chunked = false;
+            self->m_content_length = -1;
+            self->m_keep_alive = true;
+            self->read_status_line(id);
+        });
+    }
+
+    void read_status_line(uint64_t id)
+    {
+        async_read_until(m_line, max_line_size, '\n', [self = shared_from_this(), id](std::error_code ec, size_t n) {
+            if (id != self->m_operation_id) {
+                return;
+            }
+            if (ec) {
+                // The server may have closed a kept alive connection before it got the request, but it may also
+                // have executed the request and failed before responding. So only idempotent requests are sent
+                // again.
+                self->fail(id, "Cannot read response: " + ec.message(),
+                           is_idempotent(self->m_pending.request.method));
+                return;
+            }
+            // HTTP/1.x 200 Reason
+            const char* line = self->m_line;
+            if (n < 12 || std::strncmp(line, "HTTP/1.", 7) != 0) {
+                self->fail(id, "Invalid HTTP response");
+                return;
+            }
+            if (line[7] == '0') {
+                self->m_keep_alive = false;
+            }
+            self->m_response.http_status_code = std::atoi(line + 9);
+            self->read_header_line(id);
+        });
+    }
+
+    void read_header_line(uint64_t id)
+    {
+        async_read_until(m_line, max_line_size, '\n', [self = shared_from_this(), id](std::error_code ec, size_t n) {
+            if (id != self->m_operation_id) {
+                return;
+            }
+            if (ec) {
+                self->fail(id, "Cannot read response headers: " + ec.message());
+                return;
+            }
+            const char* begin = self->m_line;
+            const char* end = begin + n;
+            if (n <= 2) {
+                // End of the headers. 1xx responses are followed by the real response.
+                int status = self->m_response.http_status_code;
+                if (status >= 100 && status < 200) {
+                    self->m_response.headers.clear();
+                    self->read_status_line(id);
+                }
+                else {
+                    self->read_body(id);
+                }
+                return;
+            }
+            const char* colon = std::find(begin, end, ':');
+            if (colon == end) {
+                self->fail(id, "Invalid HTTP response header");
+                return;
+            }
+            std::string name = trim(begin, colon);
+            std::string value = trim(colon + 1, end);
+            if (equals_ignore_case(name, "Content-Length")) {
+                size_t length;
+                if (!parse_length(value, 10, length)) {
+                    self->fail(id, "Invalid or too large Content-Length: " + value);
+                    return;
+                }
+                self->m_content_length = static_cast<int64_t>(length);
+            }
+            else if (equals_ignore_case(name, "Transfer-Encoding")) {
+                self->m_chunked = value.find("chunked") != std::string::npos;
+            }
+            else if (equals_ignore_case(name, "Connection")) {
+                if (equals_ignore_case(value, "close")) {
+                    self->m_keep_alive = false;
+                }
+                else if (equals_ignore_case(value, "keep-alive")) {
+                    self->m_keep_alive = true;
+                }
+            }
+            self->m_response.headers[std::move(name)] = std::move(value);
+            self->read_header_line(id);
+        });
+    }
+
+    void read_body(uint64_t id)
+    {
+        int status = m_response.http_status_code;
+        if (status == 204 || status == 304) {
+            succeed(id);
+        }
+        else if (m_chunked) {
+            read_chunk_size(id);
+        }
+        else if (m_content_length >= 0) {
+            read_body_bytes(id, static_cast<size_t>(m_content_length), [this, id] {
+                succeed(id);
+            });
+        }
+        else {
+            // No framing, the body ends with the connection.
+            m_keep_alive = false;
+            read_until_closed(id);
+        }
+    }
+
+    template <class H>
+    void read_body_bytes(uint64_t id, size_t size, H handler)
+    {
+        if (size == 0) {
+            handler();
+            return;
+        }
+        // Read straight into the body of the response.
+        std::string& body = m_response.body;
+        size_t offset = body.size();
+        if (size > max_body_size - offset) {
+            fail(id, "The response body is too large.");
+            return;
+        }
+        body.resize(offset + size);
+        async_read(&body[offset], size,
+                   [self = shared_from_this(), id, handler = std::move(handler)](std::error_code ec, size_t) {
+                       if (id != self->m_operation_id) {
+                           return;
+                       }
+                       if (ec) {
+                           self->fail(id, "Cannot read response body: " + ec.message());
+                           return;
+                       }
+                       handler();
+                   });
+    }
+
+    void read_chunk_size(uint64_t id)
+    {
+        async_read_until(m_line, max_line_size, '\n', [self = shared_from_this(), id](std::error_code ec, size_t n) {
+            if (id != self->m_operation_id) {
+                return;
+            }
+            if (ec) {
+                self->fail(id, "Cannot read response body: " + ec.message());
+                return;
+            }
+            size_t size;
+            if (!parse_length(trim(self->m_line, self->m_line + n), 16, size)) {
+                self->fail(id, "Invalid or too large chunk size in the response body.");
+                return;
+            }
+            if (size == 0) {
+                self->read_trailer(id);
+                return;
+            }
+            self->read_body_bytes(id, size, [self, id] {
+                // The CRLF after the chunk data.
+                self->async_read_until(self->m_line, max_line_size, '\n', [self, id](std::error_code ec, size_t) {
+                    if (id != self->m_operation_id) {
+                        return;
+                    }
+                    if (ec) {
+                        self->fail(id, "Cannot read response body: " + ec.message());
+                        return;
+                    }
+                    self->read_chunk_size(id);
+                });
+            });
+        });
+    }
+
+    void read_trailer(uint64_t id)
+    {
+        async_read_until(m_line, max_line_size, '\n', [self = shared_from_this(), id](std::error_code ec, size_t n) {
+            if (id != self->m_operation_id) {
+                return;
+            }
+            if (ec) {
+                self->fail(id, "Cannot read response body: " + ec.message());
+                return;
+            }
+            if (n <= 2) {
+                self->succeed(id);
+            }
+            else {
+                self->read_trailer(id);
+            }
+        });
+    }
+
+    void read_until_closed(uint64_t id)
+    {
+        std::string& body = m_response.body;
+        size_t offset = body.size();
+        if (offset >= max_body_size) {
+            fail(id, "The response body is too large.");
+            return;
+        }
+        body.resize(offset + 16384);
+        async_read(&body[offset], 16384, [self = shared_from_this(), id, offset](std::error_code ec, size_t n) {
+            if (id != self->m_operation_id) {
+                return;
+            }
+            self->m_response.body.resize(offset + n);
+            if (ec == util::MiscExtErrors::end_of_input || ec == util::MiscExtErrors::premature_end_of_input) {
+                self->succeed(id);
+            }
+            else if (ec) {
+                self->fail(id, "Cannot read response body: " + ec.message());
+            }
+            else {
+                self->read_until_closed(id);
+            }
+        });
+    }
+
+    void succeed(uint64_t id)
+    {
+        REALM_ASSERT(id == m_operation_id);
+        ++m_operation_id;
+        if (m_timer) {
+            m_timer->cancel();
+        }
+        m_busy = false;
+        if (!m_keep_alive) {
+            close();
+        }
+        m_client.on_response(*this, std::move(m_pending), std::move(m_response));
+    }
+
+    // Servers may close idle connections at any time, so a request failing on a reused connection is retried once
+    // on a new connection if may_retry is set, i.e. if the server cannot have executed it or executing it again does
+    // no harm.
+    void fail(uint64_t id, std::string message, bool may_retry = false)
+    {
+        if (id != m_operation_id) {
+            return;
+        }
+        m_busy = false;
+        close();
+        m_client.on_failure(*this, std::move(m_pending), may_retry && m_reused, std::move(message));
+    }
+
+    template <class H>
+    void async_write(const char* data, size_t size, H handler)
+    {
+        if (m_ssl_stream) {
+            m_ssl_stream->async_write(data, size, std::move(handler));
+        }
+        else {
+            m_socket.async_write(data, size, std::move(handler));
+        }
+    }
+
+    template <class H>
+    void async_read(char* buffer, size_t size, H handler)
+    {
+        if (m_ssl_stream) {
+            m_ssl_stream->async_read(buffer, size, m_read_ahead_buffer, std::move(handler));
+        }
+        else {
+            m_socket.async_read(buffer, size, m_read_ahead_buffer, std::move(handler));
+        }
+    }
+
+    template <class H>
+    void async_read_until(char* buffer, size_t size, char delim, H handler)
+    {
+        if (m_ssl_stream) {
+            m_ssl_stream->async_read_until(buffer, size, delim, m_read_ahead_buffer, std::move(handler));
+        }
+        else {
+            m_socket.async_read_until(buffer, size, delim, m_read_ahead_buffer, std::move(handler));
+        }
+    }
+
+    Impl& m_client;
+    const Url m_url;
+    const std::string m_origin;
+    network::Resolver m_resolver;
+    network::Endpoint::List m_endpoints;
+    network::Socket m_socket;
+    util::Optional<ssl::Stream> m_ssl_stream;
+    network::ReadAheadBuffer m_read_ahead_buffer;
+    util::Optional<network::DeadlineTimer> m_timer;
+    // Incremented whenever the current operation ends, so completion handlers of stale operations do nothing.
+    uint64_t m_operation_id = 0;
+    bool m_connected = false;
+    bool m_closed = false;
+    bool m_busy = false;
+    bool m_reused = false;
+
+    PendingRequest m_pending;
+    std::string m_write_buffer;
+    char m_line[max_line_size];
+    Response m_response;
+    bool m_chunked = false;
+    int64_t m_content_length = -1;
+    bool m_keep_alive = true;
+};
+
+NativeHttpClient::Impl::Impl(Config config)
+    : m_config(std::move(config))
+    , m_keep_running(m_service)
+{
+    // The service returns from run() when it has nothing to do, so keep a wait pending until the client is closed.
+    m_keep_running.async_wait(std::chrono::hours(24 * 365), [](std::error_code) {});
+    m_thread = std::thread([this] {
+        // run() only returns once the client is closed. An exception thrown by a handler leaves the request it was
+        // handling unfinished, so all requests are failed to not leave any caller waiting, and the loop keeps
+        // serving new requests.
+        for (;;) {
+            try {
+                m_service.run();
+                return;
+            }
+            catch (std::exception& e) {
+                Log::e("The native network transport failed: %1", e.what());
+                try {
+                    fail_all(error_unknown, std::string("The native network transport failed: ") + e.what());
+                }
+                catch (std::exception& e) {
+                    Log::e("The native network transport failed to fail pending requests: %1", e.what());
+                }
+            }
+        }
+    });
+}
+
+NativeHttpClient::Impl::~Impl()
+{
+    m_service.post([this] {
+        shut_down();
+    });
+    m_thread.join();
+}
+
+bool NativeHttpClient::Impl::is_client_thread() const noexcept
+{
+    return std::this_thread::get_id() == m_thread.get_id();
+}
+
+void NativeHttpClient::Impl::send(PendingRequest pending)
+{
+    m_service.post([this, pending = std::move(pending)]() mutable {
+        dispatch(std::move(pending));
+    });
+}
+
+void NativeHttpClient::Impl::dispatch(PendingRequest pending)
+{
+    Origin& origin = m_origins[pending.url.origin()];
+    for (auto& connection : origin.connections) {
+        if (!connection->busy()) {
+            connection->start(std::move(pending));
+            return;
+        }
+    }
+    if (origin.connections.size() < m_config.max_connections_per_origin) {
+        auto connection = std::make_shared<Connection>(*this, pending.url);
+        origin.connections.push_back(connection);
+        connection->start(std::move(pending));
+        return;
+    }
+    origin.queue.push_back(std::move(pending));
+}
+
+void NativeHttpClient::Impl::complete(PendingRequest& pending, Response response)
+{
+    try {
+        pending.completion_block(std::move(response));
+    }
+    catch (std::exception& e) {
+        Log::e("Unhandled exception in a network request completion: %1", e.what());
+    }
+}
+
+void NativeHttpClient::Impl::on_response(Connection& connection, PendingRequest pending, Response response)
+{
+    int status = response.http_status_code;
+    bool redirect = status == 301 || status == 302 || status == 303 || status == 307 || status == 308;
+    auto location = response.headers.find("Location");
+    Url url;
+    if (redirect && location != response.headers.end() && pending.redirects < m_config.max_redirects &&
+        resolve_location(pending.url, location->second, url)) {
+        if (url.origin() != pending.url.origin()) {
+            // Don't leak the access token to another server.
+            auto& headers = pending.request.headers;
+            for (auto it = headers.begin(); it != headers.end();) {
+                if (equals_ignore_case(it->first, "Authorization") ||
+                    equals_ignore_case(it->first, m_config.authorization_header_name.c_str())) {
+                    it = headers.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+        }
+        pending.url = url;
+        pending.request.url = url.tls ? "https://" + url.host_header() + url.target
+                                      : "http://" + url.host_header() + url.target;
+        if (status == 303) {
+            pending.request.method = HttpMethod::get;
+            pending.request.body.clear();
+        }
+        ++pending.redirects;
+        pending.retried = false;
+    }
+    else {
+        redirect = false;
+        complete(pending, std::move(response));
+    }
+
+    if (connection.closed()) {
+        remove(connection);
+    }
+    else {
+        on_idle(connection);
+    }
+    if (redirect) {
+        dispatch(std::move(pending));
+    }
+}
+
+void NativeHttpClient::Impl::on_failure(Connection& connection, PendingRequest pending, bool retry,
+                                        std::string message)
+{
+    remove(connection);
+    if (retry && !pending.retried) {
+        pending.retried = true;
+        dispatch(std::move(pending));
+        return;
+    }
+    complete(pending, error_response(error_io, std::move(message)));
+}
+
+void NativeHttpClient::Impl::on_idle(Connection& connection)
+{
+    Origin& origin = m_origins[connection.origin()];
+    if (origin.queue.empty()) {
+        connection.wait_idle();
+        return;
+    }
+    PendingRequest pending = std::move(origin.queue.front());
+    origin.queue.pop_front();
+    connection.start(std::move(pending));
+}
+
+void NativeHttpClient::Impl::remove(Connection& connection)
+{
+    auto it = m_origins.find(connection.origin());
+    if (it == m_origins.end()) {
+        return;
+    }
+    Origin& origin = it->second;
+    auto& connections = origin.connections;
+    connections.erase(std::remove_if(connections.begin(), connections.end(),
+                                     [&](const std::shared_ptr<Connection>& c) {
+                                         return c.get() == &connection;
+                                     }),
+                      connections.end());
+    // A queued request may now get a connection of its own.
+    if (!origin.queue.empty() && connections.size() < m_config.max_connections_per_origin) {
+        PendingRequest pending = std::move(origin.queue.front());
+        origin.queue.pop_front();
+        dispatch(std::move(pending));
+    }
+    else if (connections.empty() && origin.queue.empty()) {
+        m_origins.erase(it);
+    }
+}
+
+ssl::Context& NativeHttpClient::Impl::ssl_context()
+{
+    if (!m_ssl_context) {
+        m_ssl_context = std::make_unique<ssl::Context>();
+        if (!m_config.ssl_trust_certificate_path.empty()) {
+            m_ssl_context->use_verify_file(m_config.ssl_trust_certificate_path);
+        }
+        else if (!m_config.ssl_verify_callback) {
+            m_ssl_context->use_default_verify();
+        }
+    }
+    return *m_ssl_context;
+}
+
+void NativeHttpClient::Impl::shut_down()
+{
+    m_keep_running.cancel();
+    fail_all(error_unknown, "The network transport has been closed.");
+}
+
+void NativeHttpClient::Impl::fail_all(int custom_status_code, const std::string& message)
+{
+    std::vector<PendingRequest> pending_requests;
+    for (auto& entry : m_origins) {
+        for (auto& connection : entry.second.connections) {
+            if (auto pending = connection->take_pending()) {
+                pending_requests.push_back(std::move(*pending));
+            }
+            connection->close();
+        }
+        for (auto& pending : entry.second.queue) {
+            pending_requests.push_back(std::move(pending));
+        }
+    }
+    m_origins.clear();
+    for (auto& pending : pending_requests) {
+        complete(pending, error_response(custom_status_code, message));
+    }
+}
+
+NativeHttpClient::NativeHttpClient(Config config)
+    : m_impl(std::make_unique<Impl>(std::move(config)))
+{
+}
+
+NativeHttpClient::~NativeHttpClient() = default;
+
+void NativeHttpClient::send(Request request, std::function<void(const Response)> completion_block)
+{
+    PendingRequest pending;
+    if (!parse_url(request.url, pending.url)) {
+        completion_block(error_response(error_unknown, "Unsupported URL: " + request.url));
+        return;
+    }
+    pending.request = std::move(request);
+    pending.completion_block = std::move(completion_block);
+    m_impl->send(std::move(pending));
+}
+
+bool NativeHttpClient::is_client_thread() const noexcept
+{
+    return m_impl->is_client_thread();
+}
+
+void NativeNetworkTransport::send_request_to_server(const Request request,
+                                                    std::function<void(const Response)> completion_block)
+{
+    if (m_client->is_client_thread()) {
+        m_client->send(request, std::move(completion_block));
+        return;
+    }
+    // The App APIs of the SDK read the result of a request when the native call returns, like with the synchronous
+    // OkHttp transport. So wait for the response and call the completion on the calling thread, where requests
+    // chained by Object Store from the completion, e.g. refreshing the access token, are waited for as well.
+    std::promise<Response> promise;
+    std::future<Response> future = promise.get_future();
+    m_client->send(request, [&promise](const Response response) {
+        promise.set_value(response);
+    });
+    completion_block(future.get());
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REALM_NATIVE_NETWORK_TRANSPORT
+#define REALM_NATIVE_NETWORK_TRANSPORT
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+#include "sync/generic_network_transport.hpp"
+
+namespace realm {
+
+// HTTP/1.1 client which sends the requests of Object Store without going through the JVM. Requests are executed on a
+// thread owned by the client, using the network stack of Realm Sync. Connections are kept alive and reused for
+// later requests to the same origin, so most requests skip the TCP and TLS handshakes. Up to
+// max_connections_per_origin requests run concurrently per origin, further requests are queued until a connection
+// becomes available.
+//
+// Completion handlers are called on the thread of the client. A failed request completes with a response with the
+// http_status_code 0 and one of the custom_status_code values of io.realm.internal.objectstore.OsJavaNetworkTransport.
+class NativeHttpClient {
+public:
+    using SSLVerifyCallback = bool(const std::string& server_address, uint_fast16_t server_port,
+                                   const char* pem_data, size_t pem_size, int preverify_ok, int depth);
+
+    struct Config {
+        size_t max_connections_per_origin = 5;
+        // Idle connections are closed after this. Kept short to not hold server resources when the app is idle.
+        std::chrono::milliseconds idle_timeout = std::chrono::seconds(5);
+        size_t max_redirects = 5;
+        // The name of the header carrying the access token, replaces "Authorization" in the requests.
+        std::string authorization_header_name = "Authorization";
+        // Added to all requests.
+        std::map<std::string, std::string> custom_headers;
+        // Server certificates are verified with the callback if set, otherwise with the CA certificates of the given
+        // PEM file, otherwise with the default locations of OpenSSL.
+        std::function<SSLVerifyCallback> ssl_verify_callback;
+        std::string ssl_trust_certificate_path;
+    };
+
+    // Custom status codes, must match OsJavaNetworkTransport.
+    static constexpr int error_io = 1000;
+    static constexpr int error_unknown = 1002;
+
+    explicit NativeHttpClient(Config config);
+    // Pending requests are completed with an error.
+    ~NativeHttpClient();
+
+    // Thread safe.
+    void send(app::Request request, std::function<void(const app::Response)> completion_block);
+    // Whether this is the thread completion handlers are called on.
+    bool is_client_thread() const noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> m_impl;
+};
+
+// GenericNetworkTransport sending through a NativeHttpClient. Object Store creates a transport per request, so they
+// share the client and its connections.
+//
+// Requests sent from any thread but the one of the client block until they complete, and their completion is called
+// on the sending thread.
+struct NativeNetworkTransport : public app::GenericNetworkTransport {
+    explicit NativeNetworkTransport(std::shared_ptr<NativeHttpClient> client)
+        : m_client(std::move(client))
+    {
+    }
+
+    void send_request_to_server(const app::Request request,
+                                std::function<void(const app::Response)> completion_block) override;
+
+private:
+    std::shared_ptr<NativeHttpClient> m_client;
+};
+
+} // namespace realm
+
+#endif // REALM_NATIVE_NETWORK_TRANSPORT
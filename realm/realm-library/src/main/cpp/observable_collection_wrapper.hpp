@@ -17,14 +17,18 @@
 #ifndef REALM_JNI_IMPL_OBSERVABLE_COLLECTION_WRAPPER_HPP
 #define REALM_JNI_IMPL_OBSERVABLE_COLLECTION_WRAPPER_HPP
 
+#include "java_class_global_def.hpp"
 #include "jni_util/java_class.hpp"
 #include "jni_util/java_global_weak_ref.hpp"
 #include "jni_util/java_method.hpp"
 #include "jni_util/log.hpp"
+#include "jni_util/native_object_counter.hpp"
 
 #include <results.hpp>
 #include <realm/util/optional.hpp>
 
+#include <type_traits>
+
 namespace realm {
 namespace _impl {
 
@@ -39,9 +43,13 @@ public:
         , m_notification_token()
         , m_collection(std::move(collection))
     {
+        jni_util::NativeObjectCounter::created(counter_kind());
     }
 
-    ~ObservableCollectionWrapper() = default;
+    ~ObservableCollectionWrapper()
+    {
+        jni_util::NativeObjectCounter::destroyed(counter_kind());
+    }
 
     ObservableCollectionWrapper(ObservableCollectionWrapper&&) = delete;
     ObservableCollectionWrapper& operator=(ObservableCollectionWrapper&&) = delete;
@@ -56,6 +64,12 @@ public:
     void stop_listening();
 
 private:
+    static constexpr jni_util::NativeObjectCounter::Kind counter_kind()
+    {
+        return std::is_same<T, Results>::value ? jni_util::NativeObjectCounter::results
+                                               : jni_util::NativeObjectCounter::list;
+    }
+
     jni_util::JavaGlobalWeakRef m_collection_weak_ref;
     NotificationToken m_notification_token;
     T m_collection;
@@ -64,8 +78,8 @@ private:
 template <typename T>
 void ObservableCollectionWrapper<T>::start_listening(JNIEnv* env, jobject j_collection_object)
 {
-    static jni_util::JavaClass os_results_class(env, "io/realm/internal/ObservableCollection");
-    static jni_util::JavaMethod notify_change_listeners(env, os_results_class, "notifyChangeListeners", "(J)V");
+    const jni_util::JavaMethod& notify_change_listeners =
+        JavaClassGlobalDef::observable_collection_notify_change_listeners(env);
 
     if (!m_collection_weak_ref) {
         m_collection_weak_ref = jni_util::JavaGlobalWeakRef(env, j_collection_object);
@@ -89,7 +103,10 @@ void ObservableCollectionWrapper<T>::start_listening(JNIEnv* env, jobject j_coll
         m_collection_weak_ref.call_with_local_ref(env, [&](JNIEnv* local_env, jobject collection_obj) {
             local_env->CallVoidMethod(
                 collection_obj, notify_change_listeners,
-                reinterpret_cast<jlong>(changes.empty() ? 0 : new CollectionChangeSet(changes)));
+                reinterpret_cast<jlong>(changes.empty() ? 0
+                                                        : jni_util::NativeObjectCounter::created(
+                                                              jni_util::NativeObjectCounter::collection_change,
+                                                              new CollectionChangeSet(changes))));
         });
     };
 
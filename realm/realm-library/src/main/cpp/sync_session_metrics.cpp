@@ -0,0 +1,203 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sync_session_metrics.hpp"
+
+#include <algorithm>
+
+using namespace realm;
+
+using Clock = std::chrono::steady_clock;
+
+// Shared with the listeners, which can outlive the metrics object until they are unregistered.
+struct SyncSessionMetrics::Counters {
+    mutable std::mutex mutex;
+    Snapshot values{};
+
+    // Last transferred bytes reported, to compute the increases. Not reset with the values.
+    bool has_upload_progress = false;
+    uint64_t uploaded = 0;
+    bool has_download_progress = false;
+    uint64_t downloaded = 0;
+
+    // Set while uploadable changes are waiting for an acknowledgement.
+    bool upload_pending = false;
+    Clock::time_point upload_pending_since;
+
+    bool connected_once = false;
+    SyncSession::ConnectionState connection_state;
+    Clock::time_point connection_state_since;
+
+    static int64_t elapsed_ms(Clock::time_point since, Clock::time_point now)
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(now - since).count();
+    }
+
+    static Value time_value(SyncSession::ConnectionState state)
+    {
+        switch (state) {
+            case SyncSession::ConnectionState::Disconnected:
+                return disconnected_ms;
+            case SyncSession::ConnectionState::Connecting:
+                return connecting_ms;
+            case SyncSession::ConnectionState::Connected:
+                return connected_ms;
+        }
+        return disconnected_ms;
+    }
+
+    void on_upload_progress(uint64_t transferred, uint64_t transferrable)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto now = Clock::now();
+        if (has_upload_progress && transferred > uploaded) {
+            values[bytes_uploaded] += static_cast<int64_t>(transferred - uploaded);
+            values[upload_batches]++;
+        }
+        has_upload_progress = true;
+        uploaded = transferred;
+
+        if (transferred < transferrable) {
+            if (!upload_pending) {
+                upload_pending = true;
+                upload_pending_since = now;
+            }
+        }
+        else if (upload_pending) {
+            upload_pending = false;
+            int64_t latency = elapsed_ms(upload_pending_since, now);
+            values[upload_latency_count]++;
+            values[upload_latency_total_ms] += latency;
+            values[upload_latency_max_ms] = std::max(values[upload_latency_max_ms], latency);
+        }
+    }
+
+    void on_download_progress(uint64_t transferred, uint64_t)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (has_download_progress && transferred > downloaded) {
+            values[bytes_downloaded] += static_cast<int64_t>(transferred - downloaded);
+            values[download_batches]++;
+        }
+        has_download_progress = true;
+        downloaded = transferred;
+    }
+
+    void on_connection_change(SyncSession::ConnectionState, SyncSession::ConnectionState new_state)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto now = Clock::now();
+        values[time_value(connection_state)] += elapsed_ms(connection_state_since, now);
+        connection_state = new_state;
+        connection_state_since = now;
+        if (new_state == SyncSession::ConnectionState::Connected) {
+            if (connected_once) {
+                values[reconnects]++;
+            }
+            connected_once = true;
+        }
+    }
+
+    // Starts following a new session of the same Realm, keeping the values recorded so far.
+    void on_session_changed(SyncSession::ConnectionState state)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto now = Clock::now();
+        values[time_value(connection_state)] += elapsed_ms(connection_state_since, now);
+        connection_state = state;
+        connection_state_since = now;
+        // The transferred bytes of the new session are the baseline for the next increases.
+        has_upload_progress = false;
+        has_download_progress = false;
+        upload_pending = false;
+    }
+};
+
+SyncSessionMetrics::SyncSessionMetrics(std::shared_ptr<SyncSession> session)
+    : m_counters(std::make_shared<Counters>())
+{
+    m_counters->connection_state = session->connection_state();
+    m_counters->connection_state_since = Clock::now();
+    m_counters->connected_once = m_counters->connection_state == SyncSession::ConnectionState::Connected;
+    register_listeners(std::move(session));
+}
+
+SyncSessionMetrics::~SyncSessionMetrics()
+{
+    unregister_listeners();
+}
+
+void SyncSessionMetrics::attach(std::shared_ptr<SyncSession> session)
+{
+    std::lock_guard<std::mutex> lock(m_session_mutex);
+    // Compares the owners, so a session destroyed in the meantime is never mistaken for the current one.
+    if (!m_session.owner_before(session) && !session.owner_before(m_session)) {
+        return;
+    }
+    unregister_listeners();
+    m_counters->on_session_changed(session->connection_state());
+    register_listeners(std::move(session));
+}
+
+void SyncSessionMetrics::register_listeners(std::shared_ptr<SyncSession> session)
+{
+    auto counters = m_counters;
+    m_upload_token = session->register_progress_notifier(
+        [counters](uint64_t transferred, uint64_t transferrable) {
+            counters->on_upload_progress(transferred, transferrable);
+        },
+        SyncSession::NotifierType::upload, true);
+    m_download_token = session->register_progress_notifier(
+        [counters](uint64_t transferred, uint64_t transferrable) {
+            counters->on_download_progress(transferred, transferrable);
+        },
+        SyncSession::NotifierType::download, true);
+    m_connection_token = session->register_connection_change_callback(
+        [counters](SyncSession::ConnectionState old_state, SyncSession::ConnectionState new_state) {
+            counters->on_connection_change(old_state, new_state);
+        });
+    m_session = session;
+}
+
+void SyncSessionMetrics::unregister_listeners()
+{
+    if (auto session = m_session.lock()) {
+        session->unregister_progress_notifier(m_upload_token);
+        session->unregister_progress_notifier(m_download_token);
+        session->unregister_connection_change_callback(m_connection_token);
+    }
+}
+
+SyncSessionMetrics::Snapshot SyncSessionMetrics::snapshot() const
+{
+    std::lock_guard<std::mutex> lock(m_counters->mutex);
+    Snapshot snapshot = m_counters->values;
+    // Include the time spent in the current state so far.
+    snapshot[Counters::time_value(m_counters->connection_state)] +=
+        Counters::elapsed_ms(m_counters->connection_state_since, Clock::now());
+    return snapshot;
+}
+
+void SyncSessionMetrics::reset()
+{
+    std::lock_guard<std::mutex> lock(m_counters->mutex);
+    m_counters->values.fill(0);
+    m_counters->connection_state_since = Clock::now();
+    // An upload waiting for an acknowledgement is measured from now on.
+    if (m_counters->upload_pending) {
+        m_counters->upload_pending_since = m_counters->connection_state_since;
+    }
+}
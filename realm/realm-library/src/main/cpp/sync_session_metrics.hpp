@@ -0,0 +1,91 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef REALM_SYNC_SESSION_METRICS_HPP
+#define REALM_SYNC_SESSION_METRICS_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "sync/sync_session.hpp"
+
+namespace realm {
+
+// Counters describing the traffic and the connection of a sync session, recorded by listeners registered on the
+// session for as long as the metrics object lives. All counters start at zero when the metrics are created or
+// reset. Object Store can replace the session of a Realm, e.g. when the Realm is opened after the session was
+// stopped, the metrics must then be attached to the new session to keep recording.
+//
+// The counters are derived from the progress and connection notifications of the session:
+// - Bytes are the increases of the transferred bytes reported by the progress notifications.
+// - A batch is a progress notification which increased the transferred bytes. For downloads it is a DOWNLOAD
+//   message integrated into the Realm, for uploads an acknowledgement of uploaded changesets by the server.
+// - The upload latency is the time from local changes becoming uploadable until the server acknowledged all of
+//   them.
+// - A reconnect is every connection established after the first one.
+class SyncSessionMetrics {
+public:
+    // Order of the values in a snapshot, must match SyncSessionMetrics.java.
+    enum Value {
+        bytes_uploaded,
+        bytes_downloaded,
+        upload_batches,
+        download_batches,
+        upload_latency_count,
+        upload_latency_total_ms,
+        upload_latency_max_ms,
+        reconnects,
+        disconnected_ms,
+        connecting_ms,
+        connected_ms,
+        value_count
+    };
+    using Snapshot = std::array<int64_t, value_count>;
+
+    explicit SyncSessionMetrics(std::shared_ptr<SyncSession> session);
+    // Unregisters the listeners if the session is still alive.
+    ~SyncSessionMetrics();
+
+    SyncSessionMetrics(const SyncSessionMetrics&) = delete;
+    SyncSessionMetrics& operator=(const SyncSessionMetrics&) = delete;
+
+    // Moves the listeners to the given session if it isn't the one recorded. Thread safe.
+    void attach(std::shared_ptr<SyncSession> session);
+
+    // Thread safe.
+    Snapshot snapshot() const;
+    void reset();
+
+private:
+    struct Counters;
+
+    void register_listeners(std::shared_ptr<SyncSession> session);
+    void unregister_listeners();
+
+    std::mutex m_session_mutex;
+    std::weak_ptr<SyncSession> m_session;
+    std::shared_ptr<Counters> m_counters;
+    uint64_t m_upload_token;
+    uint64_t m_download_token;
+    uint64_t m_connection_token;
+};
+
+} // namespace realm
+
+#endif // REALM_SYNC_SESSION_METRICS_HPP
@@ -48,6 +48,9 @@ void ThrowRealmFileException(JNIEnv* env, const std::string& message, realm::Rea
 
 void ConvertException(JNIEnv* env, const char* file, int line)
 {
+#if REALM_JNI_PROBES
+    JniProbe::exception_converted();
+#endif
     ostringstream ss;
     try {
         throw;
@@ -35,6 +35,7 @@
 #include "java_exception_def.hpp"
 #include "jni_util/log.hpp"
 #include "jni_util/java_exception_thrower.hpp"
+#include "jni_util/jni_probe.hpp"
 
 #define CHECK_PARAMETERS 1 // Check all parameters in API and throw exceptions in java if invalid
 
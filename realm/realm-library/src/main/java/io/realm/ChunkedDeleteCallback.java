@@ -0,0 +1,41 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm;
+
+import io.realm.internal.Keep;
+
+/**
+ * Callback reporting the progress of {@link RealmQuery#deleteAllInChunks(long, ChunkedDeleteCallback)} and deciding
+ * whether it continues.
+ * <p>
+ * The callback is called on the thread deleting the objects, after each chunk has been committed and outside of a
+ * write transaction.
+ */
+@Keep
+public interface ChunkedDeleteCallback {
+
+    /**
+     * Called after a chunk of objects has been deleted.
+     *
+     * @param deletedObjects the number of objects deleted so far.
+     * @param totalObjects the number of objects matching the query when the deletion started. Objects matching the
+     * query which are added concurrently are deleted as well, so {@code deletedObjects} can exceed it.
+     * @return {@code true} to continue with the next chunk, {@code false} to stop. Chunks already deleted stay
+     * deleted.
+     */
+    boolean onChunkDeleted(long deletedObjects, long totalObjects);
+}
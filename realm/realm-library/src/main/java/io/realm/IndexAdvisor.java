@@ -0,0 +1,196 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.List;
+import java.util.Locale;
+
+import io.realm.internal.Keep;
+
+/**
+ * Records which fields are queried without a search index, to find the fields worth adding
+ * {@link io.realm.annotations.Index} to.
+ * <p>
+ * While enabled, every equality, {@code in()} and range predicate of a {@link RealmQuery} on a field of the queried
+ * class which could be indexed but is not is recorded, together with the number of objects the predicate has to
+ * scan. Predicates through links are not recorded. Recording is disabled by default and applies to all Realms of the
+ * process.
+ * <p>
+ * A search index replaces the scan of equality and {@code in()} predicates with a lookup, range predicates are not
+ * sped up by it. Recommendations are therefore ranked by the objects scanned by equality and {@code in()}
+ * predicates, fields only queried by ranges come last.
+ */
+public final class IndexAdvisor {
+
+    private IndexAdvisor() {
+    }
+
+    /**
+     * Enables or disables recording of unindexed predicates. Disabling keeps the statistics recorded so far.
+     *
+     * @param enabled {@code true} to record predicates.
+     */
+    public static void setEnabled(boolean enabled) {
+        nativeSetEnabled(enabled);
+    }
+
+    /**
+     * Returns whether unindexed predicates are recorded.
+     *
+     * @return {@code true} if predicates are recorded.
+     */
+    public static boolean isEnabled() {
+        return nativeIsEnabled();
+    }
+
+    /**
+     * Returns the recorded statistics of all fields queried without an index, the fields which would gain the most
+     * from an index first.
+     *
+     * @return the ranked recommendations.
+     */
+    public static List<Recommendation> getRecommendations() {
+        return Collections.unmodifiableList(Arrays.asList(nativeGetRecommendations()));
+    }
+
+    /**
+     * Discards all recorded statistics.
+     */
+    public static void reset() {
+        nativeReset();
+    }
+
+    /**
+     * Adds a search index to every field whose equality and {@code in()} predicates scanned at least the given number
+     * of objects, for example from a background job while the app is idle. Indexing a field rewrites it, which takes
+     * time proportional to the number of objects of its class.
+     * <p>
+     * The schema of a {@link Realm} is reset to the indexes declared by the model classes when it is opened, so for
+     * typed Realms this is only useful to evaluate an index before adding {@link io.realm.annotations.Index} to the
+     * model.
+     *
+     * @param realm the Realm to add the indexes to, must be in a write transaction.
+     * @param minRowsScanned the number of objects the predicates on a field must have scanned to index it.
+     * @return the recommendations of the fields which were indexed.
+     * @throws IllegalStateException if the Realm is not in a write transaction.
+     */
+    public static List<Recommendation> addIndexes(DynamicRealm realm, long minRowsScanned) {
+        realm.checkIfValidAndInTransaction();
+        List<Recommendation> indexed = new ArrayList<>();
+        RealmSchema schema = realm.getSchema();
+        for (Recommendation recommendation : getRecommendations()) {
+            if (recommendation.getRowsScanned() == 0 || recommendation.getRowsScanned() < minRowsScanned) {
+                continue;
+            }
+            RealmObjectSchema objectSchema = schema.get(recommendation.getClassName());
+            String fieldName = recommendation.getFieldName();
+            if (objectSchema == null || !objectSchema.hasField(fieldName) || objectSchema.hasIndex(fieldName)) {
+                continue;
+            }
+            objectSchema.addIndex(fieldName);
+            indexed.add(recommendation);
+        }
+        return indexed;
+    }
+
+    /**
+     * Statistics of the unindexed predicates on a field.
+     */
+    @Keep
+    public static final class Recommendation {
+        private final String className;
+        private final String fieldName;
+        private final long equalityPredicates;
+        private final long inPredicates;
+        private final long rangePredicates;
+        private final long rowsScanned;
+        private final long rangeRowsScanned;
+
+        // Created from JNI
+        Recommendation(String className, String fieldName, long equalityPredicates, long inPredicates,
+                       long rangePredicates, long rowsScanned, long rangeRowsScanned) {
+            this.className = className;
+            this.fieldName = fieldName;
+            this.equalityPredicates = equalityPredicates;
+            this.inPredicates = inPredicates;
+            this.rangePredicates = rangePredicates;
+            this.rowsScanned = rowsScanned;
+            this.rangeRowsScanned = rangeRowsScanned;
+        }
+
+        public String getClassName() {
+            return className;
+        }
+
+        public String getFieldName() {
+            return fieldName;
+        }
+
+        /**
+         * Returns the number of equality predicates on the field, not counting those of {@code in()}.
+         */
+        public long getEqualityPredicates() {
+            return equalityPredicates;
+        }
+
+        /**
+         * Returns the number of {@code in()} predicates on the field.
+         */
+        public long getInPredicates() {
+            return inPredicates;
+        }
+
+        /**
+         * Returns the number of range predicates on the field, like {@code greaterThan()} or {@code between()}.
+         */
+        public long getRangePredicates() {
+            return rangePredicates;
+        }
+
+        /**
+         * Returns the number of objects scanned by equality and {@code in()} predicates, which an index would avoid.
+         */
+        public long getRowsScanned() {
+            return rowsScanned;
+        }
+
+        /**
+         * Returns the number of objects scanned by range predicates.
+         */
+        public long getRangeRowsScanned() {
+            return rangeRowsScanned;
+        }
+
+        @Override
+        public String toString() {
+            return String.format(Locale.US, "%s.%s: equality=%d, in=%d, range=%d, rowsScanned=%d, rangeRowsScanned=%d",
+                    className, fieldName, equalityPredicates, inPredicates, rangePredicates, rowsScanned,
+                    rangeRowsScanned);
+        }
+    }
+
+    private static native void nativeSetEnabled(boolean enabled);
+
+    private static native boolean nativeIsEnabled();
+
+    private static native Recommendation[] nativeGetRecommendations();
+
+    private static native void nativeReset();
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm;
+
+import javax.annotation.Nullable;
+
+/**
+ * Listener notified about the progress of schema changes which process all objects of a class during a migration,
+ * like adding a field, adding an index, changing whether a field is required or transforming all objects.
+ * <p>
+ * Changes rewriting a column are done in one step by the storage engine, so they are reported when they start, with
+ * {@code processedObjects == 0}, and when they complete, with {@code processedObjects == totalObjects}.
+ * {@link RealmObjectSchema#transform(RealmObjectSchema.Function)} also reports its progress while it runs.
+ * <p>
+ * The listener is called on the thread running the migration.
+ *
+ * @see RealmSchema#setMigrationProgressListener(MigrationProgressListener)
+ */
+public interface MigrationProgressListener {
+
+    /**
+     * The schema changes reporting their progress.
+     */
+    enum SchemaChange {
+        ADD_FIELD,
+        ADD_INDEX,
+        SET_REQUIRED,
+        SET_NULLABLE,
+        TRANSFORM
+    }
+
+    /**
+     * Called when a schema change made progress.
+     *
+     * @param change the schema change in progress.
+     * @param className the class whose objects are processed.
+     * @param fieldName the field which is changed, or {@code null} for {@link SchemaChange#TRANSFORM}.
+     * @param processedObjects the number of objects processed so far.
+     * @param totalObjects the number of objects of the class.
+     */
+    void onProgress(SchemaChange change, String className, @Nullable String fieldName,
+                    long processedObjects, long totalObjects);
+}
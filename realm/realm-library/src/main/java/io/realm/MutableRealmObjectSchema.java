@@ -20,6 +20,7 @@ import java.util.Locale;
 
 import javax.annotation.Nonnull;
 
+import io.realm.MigrationProgressListener.SchemaChange;
 import io.realm.internal.CheckedRow;
 import io.realm.internal.OsObjectStore;
 import io.realm.internal.OsResults;
@@ -33,6 +34,8 @@ import io.realm.internal.fields.FieldDescriptor;
  */
 class MutableRealmObjectSchema extends RealmObjectSchema {
 
+    private static final int TRANSFORM_PROGRESS_MIN_INTERVAL = 1000;
+
     /**
      * Creates a mutable schema object for a given Realm class.
      *
@@ -113,7 +116,9 @@ class MutableRealmObjectSchema extends RealmObjectSchema {
             nullable = false;
         }
 
+        long totalObjects = startProgress(SchemaChange.ADD_FIELD, fieldName);
         long columnKey = table.addColumn(metadata.fieldType, fieldName, nullable);
+        finishProgress(SchemaChange.ADD_FIELD, fieldName, totalObjects);
         try {
             addModifiers(fieldName, attributes);
         } catch (Exception e) {
@@ -198,7 +203,7 @@ class MutableRealmObjectSchema extends RealmObjectSchema {
         if (table.hasSearchIndex(columnKey)) {
             throw new IllegalStateException(fieldName + " already has an index.");
         }
-        table.addSearchIndex(columnKey);
+        addSearchIndex(fieldName, columnKey);
         return this;
     }
 
@@ -230,7 +235,7 @@ class MutableRealmObjectSchema extends RealmObjectSchema {
         final RealmFieldType fieldType = getFieldType(fieldName);
         if (fieldType != RealmFieldType.STRING && !table.hasSearchIndex(columnKey)) {
             // No exception will be thrown since adding PrimaryKey implies the column has an index.
-            table.addSearchIndex(columnKey);
+            addSearchIndex(fieldName, columnKey);
         }
         OsObjectStore.setPrimaryKeyForObject(realm.sharedRealm, getClassName(), fieldName);
         return this;
@@ -270,6 +275,8 @@ class MutableRealmObjectSchema extends RealmObjectSchema {
             throw new IllegalStateException("Field is already nullable: " + fieldName);
         }
 
+        SchemaChange change = required ? SchemaChange.SET_REQUIRED : SchemaChange.SET_NULLABLE;
+        long totalObjects = startProgress(change, fieldName);
         if (required) {
             try {
                 table.convertColumnToNotNullable(columnKey);
@@ -284,6 +291,7 @@ class MutableRealmObjectSchema extends RealmObjectSchema {
         } else {
             table.convertColumnToNullable(columnKey);
         }
+        finishProgress(change, fieldName, totalObjects);
         return this;
     }
 
@@ -305,12 +313,22 @@ class MutableRealmObjectSchema extends RealmObjectSchema {
                 throw new UnsupportedOperationException("Too many results to iterate: " + original_size);
             }
             int size = (int) result.size();
+            boolean reportProgress = schema.hasMigrationProgressListener();
+            String className = getClassName();
+            // Reports about every percent, but not for every object of small classes.
+            int progressInterval = Math.max(TRANSFORM_PROGRESS_MIN_INTERVAL, size / 100);
             for (int i = 0; i < size; i++) {
+                if (reportProgress && i % progressInterval == 0) {
+                    schema.notifyMigrationProgress(SchemaChange.TRANSFORM, className, null, i, size);
+                }
                 DynamicRealmObject obj = new DynamicRealmObject(realm, new CheckedRow(result.getUncheckedRow(i)));
                 if (obj.isValid()) {
                     function.apply(obj);
                 }
             }
+            if (reportProgress) {
+                schema.notifyMigrationProgress(SchemaChange.TRANSFORM, className, null, size, size);
+            }
         }
 
         return this;
@@ -368,6 +386,26 @@ class MutableRealmObjectSchema extends RealmObjectSchema {
         }
     }
 
+    private void addSearchIndex(String fieldName, long columnKey) {
+        long totalObjects = startProgress(SchemaChange.ADD_INDEX, fieldName);
+        table.addSearchIndex(columnKey);
+        finishProgress(SchemaChange.ADD_INDEX, fieldName, totalObjects);
+    }
+
+    // Reports the start of a schema change processing all objects and returns their number.
+    private long startProgress(SchemaChange change, String fieldName) {
+        if (!schema.hasMigrationProgressListener()) {
+            return 0;
+        }
+        long totalObjects = table.size();
+        schema.notifyMigrationProgress(change, getClassName(), fieldName, 0, totalObjects);
+        return totalObjects;
+    }
+
+    private void finishProgress(SchemaChange change, String fieldName, long totalObjects) {
+        schema.notifyMigrationProgress(change, getClassName(), fieldName, totalObjects, totalObjects);
+    }
+
     static boolean containsAttribute(FieldAttribute[] attributeList, FieldAttribute attribute) {
         //noinspection ConstantConditions
         if (attributeList == null || attributeList.length == 0) {
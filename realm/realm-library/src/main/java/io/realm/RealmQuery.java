@@ -2068,6 +2068,46 @@ public class RealmQuery<E> {
         return createRealmResults(query, queryDescriptors, false);
     }
 
+    /**
+     * Deletes all objects matching the query in chunks, each deleted and committed in its own write transaction.
+     * <p>
+     * Deleting a large number of objects in a single transaction holds the write lock for a long time and creates a
+     * large version of the Realm which readers have to catch up with. Deleting in chunks bounds both by the chunk
+     * size, at the cost of other threads and processes possibly observing the intermediate states. This Realm is
+     * only refreshed once the deletion stops, so its change listeners are notified once about all deleted chunks.
+     * <p>
+     * The query is run again for every chunk, so objects matching it which are added while the deletion runs are
+     * deleted as well. Sorting, distinct and limit are not supported.
+     *
+     * @param chunkSize the maximum number of objects deleted per write transaction.
+     * @param callback called after each chunk with the progress of the deletion. Returning {@code false} stops the
+     * deletion, the chunks deleted so far stay deleted.
+     * @return the number of deleted objects.
+     * @throws IllegalArgumentException if {@code chunkSize} is not positive.
+     * @throws IllegalStateException if the Realm is in a write transaction or frozen, or if the query is sorted,
+     * distinct or limited.
+     */
+    public long deleteAllInChunks(long chunkSize, @Nullable ChunkedDeleteCallback callback) {
+        realm.checkIfValid();
+        realm.checkAllowWritesOnUiThread();
+        if (forValues) {
+            throw new UnsupportedOperationException("deleteAllInChunks() available only when type parameter 'E' is implementing RealmModel.");
+        }
+        if (chunkSize <= 0) {
+            throw new IllegalArgumentException("'chunkSize' must be positive: " + chunkSize);
+        }
+        if (realm.isInTransaction()) {
+            throw new IllegalStateException("deleteAllInChunks() commits its own write transactions and cannot be called inside one.");
+        }
+        if (realm.isFrozen()) {
+            throw new IllegalStateException("Frozen Realms cannot be modified.");
+        }
+        if (!queryDescriptors.isEmpty()) {
+            throw new IllegalStateException("deleteAllInChunks() does not support sorted, distinct or limited queries.");
+        }
+        return query.removeChunked(realm.sharedRealm, chunkSize, callback);
+    }
+
     /**
      * Sorts the query result by the specific field name in ascending order.
      * <p>
@@ -22,8 +22,10 @@ import android.os.Looper;
 import org.bson.types.Decimal128;
 import org.bson.types.ObjectId;
 
+import java.util.Collections;
 import java.util.Date;
 import java.util.Locale;
+import java.util.Map;
 
 import javax.annotation.Nullable;
 
@@ -36,6 +38,7 @@ import io.realm.internal.Table;
 import io.realm.internal.UncheckedRow;
 import io.realm.internal.Util;
 import io.realm.internal.android.JsonUtils;
+import io.realm.internal.objectstore.OsObjectBuilder;
 import io.realm.log.RealmLog;
 import io.realm.rx.CollectionChange;
 
@@ -182,34 +185,7 @@ public class RealmResults<E> extends OrderedRealmCollectionImpl<E> {
         // Does implicit conversion if needed.
         RealmFieldType type = schema.getFieldType(fieldName);
         if (isString && type != RealmFieldType.STRING) {
-            switch (type) {
-                case BOOLEAN:
-                    value = Boolean.parseBoolean(strValue);
-                    break;
-                case INTEGER:
-                    value = Long.parseLong(strValue);
-                    break;
-                case FLOAT:
-                    value = Float.parseFloat(strValue);
-                    break;
-                case DOUBLE:
-                    value = Double.parseDouble(strValue);
-                    break;
-                case DATE:
-                    value = JsonUtils.stringToDate(strValue);
-                    break;
-                case DECIMAL128:
-                    value = Decimal128.parse(strValue);
-                    break;
-                case OBJECT_ID:
-                    value = new ObjectId(strValue);
-                    break;
-                default:
-                    throw new IllegalArgumentException(String.format(Locale.US,
-                            "Field %s is not a String field, " +
-                                    "and the provide value could not be automatically converted: %s. Use a typed" +
-                                    "setter instead", fieldName, value));
-            }
+            value = convertString(fieldName, type, strValue);
         }
 
         //noinspection ConstantConditions
@@ -249,6 +225,114 @@ public class RealmResults<E> extends OrderedRealmCollectionImpl<E> {
         }
     }
 
+    /**
+     * Updates several fields of all objects inside the query result in a single pass over the objects.
+     * <p>
+     * Calling one of the setters for each field visits every object once per field and looks the field up by its
+     * name each time. This method resolves the fields once and then sets all of them on each object, which is
+     * considerably faster when updating several fields of many objects.
+     * <p>
+     * Values are converted like by {@link #setValue(String, Object)}. Lists are not supported, use
+     * {@link #setList(String, RealmList)} for them.
+     *
+     * @param values the new values by field name.
+     * @throws IllegalArgumentException if a field could not be found or is a list, or if a value didn't match the field
+     * type or could not be converted to match the underlying field type. No object is updated then.
+     * @throws IllegalStateException if a field is a primary key property.
+     */
+    public void setValues(Map<String, ?> values) {
+        baseRealm.checkIfValidAndInTransaction();
+        Table table = osResults.getTable();
+        RealmObjectSchema schema = getRealm().getSchema().get(table.getClassName());
+        OsObjectBuilder builder = new OsObjectBuilder(table, Collections.<ImportFlag>emptySet());
+        try {
+            for (Map.Entry<String, ?> entry : values.entrySet()) {
+                String fieldName = entry.getKey();
+                checkNonEmptyFieldName(fieldName);
+                fieldName = mapFieldNameToInternalName(fieldName);
+                long columnKey = table.getColumnKey(fieldName);
+                if (columnKey == Table.NO_MATCH) {
+                    throw new IllegalArgumentException(String.format("Field '%s' could not be found in class '%s'", fieldName, table.getClassName()));
+                }
+                Object value = entry.getValue();
+                RealmFieldType type = schema.getFieldType(fieldName);
+                if (value instanceof String && type != RealmFieldType.STRING) {
+                    value = convertString(fieldName, type, (String) value);
+                }
+                addValue(builder, fieldName, columnKey, value);
+            }
+            osResults.setValues(builder);
+        } finally {
+            builder.close();
+        }
+    }
+
+    private void addValue(OsObjectBuilder builder, String fieldName, long columnKey, @Nullable Object value) {
+        if (value == null) {
+            builder.addNull(columnKey);
+            return;
+        }
+        Class<?> valueClass = value.getClass();
+        if (valueClass == Boolean.class) {
+            checkType(fieldName, RealmFieldType.BOOLEAN);
+            builder.addBoolean(columnKey, (Boolean) value);
+        } else if (valueClass == Byte.class || valueClass == Short.class || valueClass == Integer.class || valueClass == Long.class) {
+            checkType(fieldName, RealmFieldType.INTEGER);
+            builder.addInteger(columnKey, ((Number) value).longValue());
+        } else if (valueClass == Float.class) {
+            checkType(fieldName, RealmFieldType.FLOAT);
+            builder.addFloat(columnKey, (Float) value);
+        } else if (valueClass == Double.class) {
+            checkType(fieldName, RealmFieldType.DOUBLE);
+            builder.addDouble(columnKey, (Double) value);
+        } else if (valueClass == String.class) {
+            checkType(fieldName, RealmFieldType.STRING);
+            builder.addString(columnKey, (String) value);
+        } else if (value instanceof Date) {
+            checkType(fieldName, RealmFieldType.DATE);
+            builder.addDate(columnKey, (Date) value);
+        } else if (value instanceof Decimal128) {
+            checkType(fieldName, RealmFieldType.DECIMAL128);
+            builder.addDecimal128(columnKey, (Decimal128) value);
+        } else if (value instanceof ObjectId) {
+            checkType(fieldName, RealmFieldType.OBJECT_ID);
+            builder.addObjectId(columnKey, (ObjectId) value);
+        } else if (value instanceof byte[]) {
+            checkType(fieldName, RealmFieldType.BINARY);
+            builder.addByteArray(columnKey, (byte[]) value);
+        } else if (value instanceof RealmModel) {
+            checkType(fieldName, RealmFieldType.OBJECT);
+            checkRealmObjectConstraints(fieldName, (RealmModel) value);
+            builder.addObject(columnKey, (RealmModel) value);
+        } else {
+            throw new IllegalArgumentException("Value is of a type not supported: " + value.getClass());
+        }
+    }
+
+    private Object convertString(String fieldName, RealmFieldType type, String value) {
+        switch (type) {
+            case BOOLEAN:
+                return Boolean.parseBoolean(value);
+            case INTEGER:
+                return Long.parseLong(value);
+            case FLOAT:
+                return Float.parseFloat(value);
+            case DOUBLE:
+                return Double.parseDouble(value);
+            case DATE:
+                return JsonUtils.stringToDate(value);
+            case DECIMAL128:
+                return Decimal128.parse(value);
+            case OBJECT_ID:
+                return new ObjectId(value);
+            default:
+                throw new IllegalArgumentException(String.format(Locale.US,
+                        "Field %s is not a String field, " +
+                                "and the provide value could not be automatically converted: %s. Use a typed" +
+                                "setter instead", fieldName, value));
+        }
+    }
+
     /**
      * Sets the value to {@code null} for the given field in all of the objects in the collection.
      *
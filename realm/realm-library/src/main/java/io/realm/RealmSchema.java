@@ -53,6 +53,8 @@ public abstract class RealmSchema {
     final BaseRealm realm;
     // Cached field look up
     private final ColumnIndices columnIndices;
+    @Nullable
+    private MigrationProgressListener migrationProgressListener;
 
     /**
      * Creates a wrapper to easily manipulate the current schema of a Realm.
@@ -135,6 +137,28 @@ public abstract class RealmSchema {
         return realm.getSharedRealm().hasTable(Table.getTableNameForClass(className));
     }
 
+    /**
+     * Sets a listener notified about the progress of schema changes which process all objects of a class, like
+     * making a field required on a large class. Only the schema of a {@link DynamicRealm} can be changed, so this is
+     * typically set at the beginning of {@link RealmMigration#migrate(DynamicRealm, long, long)}.
+     *
+     * @param listener the listener to notify, or {@code null} to remove the current one.
+     */
+    public void setMigrationProgressListener(@Nullable MigrationProgressListener listener) {
+        this.migrationProgressListener = listener;
+    }
+
+    final boolean hasMigrationProgressListener() {
+        return migrationProgressListener != null;
+    }
+
+    final void notifyMigrationProgress(MigrationProgressListener.SchemaChange change, String className,
+                                       @Nullable String fieldName, long processedObjects, long totalObjects) {
+        if (migrationProgressListener != null) {
+            migrationProgressListener.onProgress(change, className, fieldName, processedObjects, totalObjects);
+        }
+    }
+
     void checkNotEmpty(String str, String error) {
         //noinspection ConstantConditions
         if (str == null || str.isEmpty()) {
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm.internal;
+
+/**
+ * Per function statistics of the native JNI functions.
+ * <p>
+ * For every native function the number of calls, the total and the maximum wall time spent in it and the number of
+ * native exceptions converted to Java exceptions are recorded. The probes are only compiled into the native library
+ * when it is built with {@code -PenableJniProbes=true} (the {@code REALM_JNI_PROBES} CMake option), and even then
+ * nothing is recorded until {@link #setEnabled(boolean)} is called. In all other builds the methods of this class are
+ * no-ops and the dumps are empty.
+ */
+public final class JniProbes {
+
+    private JniProbes() {
+    }
+
+    /**
+     * Returns {@code true} if the native library has been built with the probes.
+     */
+    public static boolean isAvailable() {
+        return nativeIsAvailable();
+    }
+
+    /**
+     * Starts or stops recording. The statistics recorded so far are kept.
+     */
+    public static void setEnabled(boolean enabled) {
+        nativeSetEnabled(enabled);
+    }
+
+    public static boolean isEnabled() {
+        return nativeIsEnabled();
+    }
+
+    /**
+     * Clears the statistics of all functions.
+     */
+    public static void reset() {
+        nativeReset();
+    }
+
+    /**
+     * Returns the statistics as tab separated lines of function name, calls, total nanoseconds, max nanoseconds and
+     * exceptions, sorted by the total time. The first line is a header. Functions which haven't been called since the
+     * last reset are left out.
+     */
+    public static String dump() {
+        return nativeDump();
+    }
+
+    /**
+     * Writes {@link #dump()} to the given file, replacing its content.
+     *
+     * @throws IllegalArgumentException if the file cannot be written.
+     */
+    public static void dumpToFile(String path) {
+        nativeDumpToFile(path);
+    }
+
+    private static native boolean nativeIsAvailable();
+
+    private static native void nativeSetEnabled(boolean enabled);
+
+    private static native boolean nativeIsEnabled();
+
+    private static native void nativeReset();
+
+    private static native String nativeDump();
+
+    private static native void nativeDumpToFile(String path);
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm.internal;
+
+import java.util.Locale;
+
+/**
+ * Diagnostic counters for the native objects and JNI references owned by the native layer.
+ * <p>
+ * For every kind of object the number of currently live instances and the highest number seen since the last call to
+ * {@link #resetHighWaterMarks()} are tracked. Steadily growing counts point to native memory which is not released,
+ * while the global reference counts can be compared against the global reference table limit of the VM.
+ * <p>
+ * The KIND_* values must match {@code NativeObjectCounter::Kind} in native code.
+ */
+public final class NativeObjectCounters {
+
+    /** Native row accessors ({@code Obj}) owned by {@link UncheckedRow}s. */
+    public static final int KIND_OBJ = 0;
+    /** Native queries owned by {@link TableQuery}s. */
+    public static final int KIND_QUERY = 1;
+    /** Native results owned by {@link OsResults}. */
+    public static final int KIND_RESULTS = 2;
+    /** Native lists owned by {@link OsList}s. */
+    public static final int KIND_LIST = 3;
+    /** Native objects owned by {@link OsObject}s. */
+    public static final int KIND_OBJECT = 4;
+    /** Native change sets owned by {@link OsCollectionChangeSet}s. */
+    public static final int KIND_COLLECTION_CHANGE_SET = 5;
+    /** Native property maps owned by {@link io.realm.internal.objectstore.OsObjectBuilder}s. */
+    public static final int KIND_OBJECT_BUILDER = 6;
+    /** JNI global references held by native code. */
+    public static final int KIND_GLOBAL_REF = 7;
+    /** JNI weak global references held by native code. */
+    public static final int KIND_WEAK_GLOBAL_REF = 8;
+    /** JNI global references kept alive until the library is unloaded. These are included in KIND_GLOBAL_REF. */
+    public static final int KIND_KEPT_GLOBAL_REF = 9;
+
+    private static final String[] KIND_NAMES = {
+            "Obj", "Query", "Results", "List", "Object", "CollectionChangeSet", "ObjectBuilder",
+            "GlobalRef", "WeakGlobalRef", "KeptGlobalRef"
+    };
+    static final int KIND_COUNT = KIND_NAMES.length;
+
+    private NativeObjectCounters() {
+    }
+
+    /**
+     * Returns the number of currently live native instances of the given kind.
+     *
+     * @param kind one of the KIND_* constants.
+     */
+    public static long getCount(int kind) {
+        checkKind(kind);
+        return nativeGetCount(kind);
+    }
+
+    /**
+     * Returns the highest number of live native instances of the given kind since the last call to
+     * {@link #resetHighWaterMarks()}.
+     *
+     * @param kind one of the KIND_* constants.
+     */
+    public static long getHighWaterMark(int kind) {
+        checkKind(kind);
+        return nativeGetHighWaterMark(kind);
+    }
+
+    /**
+     * Resets all high-water marks to the current counts.
+     */
+    public static void resetHighWaterMarks() {
+        nativeResetHighWaterMarks();
+    }
+
+    /**
+     * Returns the number of threads which have been attached to the VM by native code and are not detached yet.
+     */
+    public static long getAttachedThreadCount() {
+        return nativeGetAttachedThreadCount();
+    }
+
+    /**
+     * Returns a human readable summary of all counters, suitable for logging.
+     */
+    public static String dump() {
+        StringBuilder sb = new StringBuilder("NativeObjectCounters[");
+        for (int kind = 0; kind < KIND_COUNT; kind++) {
+            sb.append(String.format(Locale.US, "%s=%d/%d, ",
+                    KIND_NAMES[kind], nativeGetCount(kind), nativeGetHighWaterMark(kind)));
+        }
+        sb.append("AttachedThreads=").append(nativeGetAttachedThreadCount()).append("]");
+        return sb.toString();
+    }
+
+    private static void checkKind(int kind) {
+        if (kind < 0 || kind >= KIND_COUNT) {
+            throw new IllegalArgumentException("Unknown native object kind: " + kind);
+        }
+    }
+
+    private static native long nativeGetCount(int kind);
+
+    private static native long nativeGetHighWaterMark(int kind);
+
+    private static native void nativeResetHighWaterMarks();
+
+    private static native long nativeGetAttachedThreadCount();
+}
@@ -89,6 +89,12 @@ public class ObjectServerFacade {
     public void wrapObjectStoreSessionIfRequired(OsRealmConfig config) {
     }
 
+    /**
+     * An instance of this Realm was opened, which creates the OS session if none was running.
+     */
+    public void realmOpened(OsRealmConfig config) {
+    }
+
     public String getSyncServerCertificateAssetName(RealmConfiguration config) {
         return null;
     }
@@ -490,6 +490,13 @@ public class OsResults implements NativeObject, ObservableCollection {
         }
     }
 
+    /**
+     * Sets all values of the builder on every object in a single pass. Lists are not supported.
+     */
+    public void setValues(OsObjectBuilder builder) {
+        nativeSetMany(nativePtr, builder.getNativePtr());
+    }
+
     // Interface wrapping adding the specific list type
     private interface AddListTypeDelegate<T> {
         void addList(OsObjectBuilder builder, RealmList<T> list);
@@ -758,6 +765,8 @@ public class OsResults implements NativeObject, ObservableCollection {
 
     private static native void nativeSetList(long nativePtr, String fieldName, long builderNativePtr);
 
+    private static native void nativeSetMany(long nativePtr, long builderNativePtr);
+
     // Non-static, we need this OsResults object in JNI.
     private native void nativeStartListening(long nativePtr);
 
@@ -246,7 +246,9 @@ public final class OsSharedRealm implements Closeable, NativeObject {
     public static OsSharedRealm getInstance(OsRealmConfig.Builder configBuilder, VersionID version) {
         OsRealmConfig osRealmConfig = configBuilder.build();
         ObjectServerFacade.getSyncFacadeIfPossible().wrapObjectStoreSessionIfRequired(osRealmConfig);
-        return new OsSharedRealm(osRealmConfig, version);
+        OsSharedRealm sharedRealm = new OsSharedRealm(osRealmConfig, version);
+        ObjectServerFacade.getSyncFacadeIfPossible().realmOpened(osRealmConfig);
+        return sharedRealm;
     }
 
     public static void initialize(File tempDirectory) {
@@ -24,6 +24,7 @@ import java.util.Date;
 import javax.annotation.Nullable;
 
 import io.realm.Case;
+import io.realm.ChunkedDeleteCallback;
 import io.realm.Sort;
 import io.realm.log.RealmLog;
 
@@ -45,6 +46,10 @@ public class TableQuery implements NativeObject {
     // the first action to validate the syntax of the query.
     private boolean queryValidated = true;
 
+    // Receives whether a minimum/maximum aggregate found a value, so the result can be returned from native code as a
+    // primitive instead of a boxed object. Queries are thread confined, so it is safe to reuse it between calls.
+    private final boolean[] aggregateFound = new boolean[1];
+
     // TODO: Can we protect this?
     public TableQuery(NativeContext context, Table table, long nativeQueryPtr) {
         if (DEBUG) {
@@ -522,12 +527,14 @@ public class TableQuery implements NativeObject {
 
     public Long maximumInt(long columnKey) {
         validateQuery();
-        return nativeMaximumInt(nativePtr, columnKey);
+        long result = nativeMaximumInt(nativePtr, columnKey, aggregateFound);
+        return aggregateFound[0] ? result : null;
     }
 
     public Long minimumInt(long columnKey) {
         validateQuery();
-        return nativeMinimumInt(nativePtr, columnKey);
+        long result = nativeMinimumInt(nativePtr, columnKey, aggregateFound);
+        return aggregateFound[0] ? result : null;
     }
 
     public double averageInt(long columnKey) {
@@ -544,12 +551,14 @@ public class TableQuery implements NativeObject {
 
     public Float maximumFloat(long columnKey) {
         validateQuery();
-        return nativeMaximumFloat(nativePtr, columnKey);
+        float result = nativeMaximumFloat(nativePtr, columnKey, aggregateFound);
+        return aggregateFound[0] ? result : null;
     }
 
     public Float minimumFloat(long columnKey) {
         validateQuery();
-        return nativeMinimumFloat(nativePtr, columnKey);
+        float result = nativeMinimumFloat(nativePtr, columnKey, aggregateFound);
+        return aggregateFound[0] ? result : null;
     }
 
     public double averageFloat(long columnKey) {
@@ -576,12 +585,14 @@ public class TableQuery implements NativeObject {
 
     public Double maximumDouble(long columnKey) {
         validateQuery();
-        return nativeMaximumDouble(nativePtr, columnKey);
+        double result = nativeMaximumDouble(nativePtr, columnKey, aggregateFound);
+        return aggregateFound[0] ? result : null;
     }
 
     public Double minimumDouble(long columnKey) {
         validateQuery();
-        return nativeMinimumDouble(nativePtr, columnKey);
+        double result = nativeMinimumDouble(nativePtr, columnKey, aggregateFound);
+        return aggregateFound[0] ? result : null;
     }
 
     public double averageDouble(long columnKey) {
@@ -611,20 +622,14 @@ public class TableQuery implements NativeObject {
 
     public Date maximumDate(long columnKey) {
         validateQuery();
-        Long result = nativeMaximumTimestamp(nativePtr, columnKey);
-        if (result != null) {
-            return new Date(result);
-        }
-        return null;
+        long result = nativeMaximumTimestamp(nativePtr, columnKey, aggregateFound);
+        return aggregateFound[0] ? new Date(result) : null;
     }
 
     public Date minimumDate(long columnKey) {
         validateQuery();
-        Long result = nativeMinimumTimestamp(nativePtr, columnKey);
-        if (result != null) {
-            return new Date(result);
-        }
-        return null;
+        long result = nativeMinimumTimestamp(nativePtr, columnKey, aggregateFound);
+        return aggregateFound[0] ? new Date(result) : null;
     }
 
     public Decimal128 minimumDecimal128(long columnKey) {
@@ -669,6 +674,15 @@ public class TableQuery implements NativeObject {
         return nativeRemove(nativePtr);
     }
 
+    /**
+     * Deletes the matching objects in chunks of at most {@code chunkSize} objects, each in its own write transaction.
+     * Must be called outside of a write transaction.
+     */
+    public long removeChunked(OsSharedRealm sharedRealm, long chunkSize, @Nullable ChunkedDeleteCallback callback) {
+        validateQuery();
+        return nativeRemoveChunked(sharedRealm.getNativePtr(), nativePtr, chunkSize, callback);
+    }
+
     private void throwImmutable() {
         throw new IllegalStateException("Mutable method call during read transaction.");
     }
@@ -803,17 +817,17 @@ public class TableQuery implements NativeObject {
 
     private native long nativeSumInt(long nativeQueryPtr, long columnKey);
 
-    private native Long nativeMaximumInt(long nativeQueryPtr, long columnKey);
+    private native long nativeMaximumInt(long nativeQueryPtr, long columnKey, boolean[] found);
 
-    private native Long nativeMinimumInt(long nativeQueryPtr, long columnKey);
+    private native long nativeMinimumInt(long nativeQueryPtr, long columnKey, boolean[] found);
 
     private native double nativeAverageInt(long nativeQueryPtr, long columnKey);
 
     private native double nativeSumFloat(long nativeQueryPtr, long columnKey);
 
-    private native Float nativeMaximumFloat(long nativeQueryPtr, long columnKey);
+    private native float nativeMaximumFloat(long nativeQueryPtr, long columnKey, boolean[] found);
 
-    private native Float nativeMinimumFloat(long nativeQueryPtr, long columnKey);
+    private native float nativeMinimumFloat(long nativeQueryPtr, long columnKey, boolean[] found);
 
     private native double nativeAverageFloat(long nativeQueryPtr, long columnKey);
 
@@ -821,11 +835,11 @@ public class TableQuery implements NativeObject {
 
     private native long[] nativeSumDecimal128(long nativeQueryPtr, long columnKey);
 
-    private native Double nativeMaximumDouble(long nativeQueryPtr, long columnKey);
+    private native double nativeMaximumDouble(long nativeQueryPtr, long columnKey, boolean[] found);
 
     private native long[] nativeMaximumDecimal128(long nativeQueryPtr, long columnKey);
 
-    private native Double nativeMinimumDouble(long nativeQueryPtr, long columnKey);
+    private native double nativeMinimumDouble(long nativeQueryPtr, long columnKey, boolean[] found);
 
     private native long[] nativeMinimumDecimal128(long nativeQueryPtr, long columnKey);
 
@@ -833,9 +847,9 @@ public class TableQuery implements NativeObject {
 
     private native long[] nativeAverageDecimal128(long nativeQueryPtr, long columnKey);
 
-    private native Long nativeMaximumTimestamp(long nativeQueryPtr, long columnKey);
+    private native long nativeMaximumTimestamp(long nativeQueryPtr, long columnKey, boolean[] found);
 
-    private native Long nativeMinimumTimestamp(long nativeQueryPtr, long columnKey);
+    private native long nativeMinimumTimestamp(long nativeQueryPtr, long columnKey, boolean[] found);
 
     private native void nativeIsNull(long nativePtr, long[] columnKeys, long[] tablePtrs);
 
@@ -845,5 +859,8 @@ public class TableQuery implements NativeObject {
 
     private native long nativeRemove(long nativeQueryPtr);
 
+    private native long nativeRemoveChunked(long sharedRealmPtr, long nativeQueryPtr, long chunkSize,
+                                            @Nullable ChunkedDeleteCallback callback);
+
     private static native long nativeGetFinalizerPtr();
 }
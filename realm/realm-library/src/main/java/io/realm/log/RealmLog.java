@@ -96,6 +96,21 @@ public final class RealmLog {
         nativeRegisterDefaultLogger();
     }
 
+    /**
+     * Enables or disables asynchronous delivery of log events to the {@link RealmLogger}s added through
+     * {@link #add(RealmLogger)}. When enabled, log events are queued and passed to the loggers on a dedicated
+     * background thread, so slow loggers don't block the thread that is logging, e.g. the sync client thread.
+     * <p>
+     * The queue is bounded. Events are dropped if the loggers can't keep up. Events with a {@link Throwable} are always
+     * delivered on the logging thread.
+     *
+     * @param enabled {@code true} to deliver log events asynchronously, {@code false} to deliver them on the thread
+     * that logged them. Disabling it delivers all pending events before returning.
+     */
+    public static void setAsyncDelivery(boolean enabled) {
+        nativeSetAsyncDelivery(enabled);
+    }
+
     /**
      * Logs a {@link LogLevel#TRACE} exception.
      *
@@ -312,10 +327,14 @@ public final class RealmLog {
 
     private static native int nativeGetLogLevel();
 
+    private static native void nativeSetAsyncDelivery(boolean enabled);
+
     // Methods below are used for testing core logger bridge only.
     static native long nativeCreateCoreLoggerBridge(@SuppressWarnings("SameParameterValue") String tag);
 
     static native void nativeCloseCoreLoggerBridge(long nativePtr);
 
     static native void nativeLogToCoreLoggerBridge(long nativePtr, int level, String message);
+
+    static native void nativeFlushAsyncDelivery();
 }
@@ -33,9 +33,12 @@ import io.realm.internal.objectstore.OsApp;
 import io.realm.mongodb.App;
 import io.realm.RealmConfiguration;
 import io.realm.mongodb.AppConfiguration;
+import io.realm.mongodb.sync.ProgressListener;
+import io.realm.mongodb.sync.ProgressMode;
 import io.realm.mongodb.sync.Sync;
 import io.realm.mongodb.User;
 import io.realm.mongodb.sync.SyncConfiguration;
+import io.realm.mongodb.sync.SyncSession;
 import io.realm.exceptions.DownloadingRealmInterruptedException;
 import io.realm.exceptions.RealmException;
 import io.realm.internal.android.AndroidCapabilities;
@@ -163,6 +166,12 @@ public class SyncObjectServerFacade extends ObjectServerFacade {
         }
     }
 
+    @Override
+    public void realmOpened(OsRealmConfig config) {
+        // The Java session already exists, this binds it to the OS session the Realm may just have created.
+        wrapObjectStoreSessionIfRequired(config);
+    }
+
     //FIXME remove this reflection call once we redesign the SyncManager to separate interface
     //      from implementation to avoid issue like exposing internal method like SyncManager#removeSession
     //      or SyncSession#close. This happens because SyncObjectServerFacade is internal, whereas
@@ -201,12 +210,29 @@ public class SyncObjectServerFacade extends ObjectServerFacade {
         }
     }
 
-    private void downloadInitialFullRealm(SyncConfiguration syncConfig) {
+    private void downloadInitialFullRealm(final SyncConfiguration syncConfig) {
+        final ProgressListener progressListener = syncConfig.getInitialRemoteDataProgressListener();
+        final SyncSession session = (progressListener != null)
+                ? syncConfig.getUser().getApp().getSync().getOrCreateSession(syncConfig)
+                : null;
+        // The native session only exists once the task has started, so the listener is registered from there. It is
+        // only registered for the duration of the async open task.
+        Runnable registerProgressListener = (session == null) ? null : new Runnable() {
+            @Override
+            public void run() {
+                session.addDownloadProgressListener(ProgressMode.CURRENT_CHANGES, progressListener);
+            }
+        };
         OsAsyncOpenTask task = new OsAsyncOpenTask(new OsRealmConfig.Builder(syncConfig).build());
         try {
-            task.start(syncConfig.getInitialRemoteDataTimeout(TimeUnit.MILLISECONDS), TimeUnit.MILLISECONDS);
+            task.start(syncConfig.getInitialRemoteDataTimeout(TimeUnit.MILLISECONDS), TimeUnit.MILLISECONDS,
+                    registerProgressListener);
         } catch (InterruptedException e) {
             throw new DownloadingRealmInterruptedException(syncConfig, e);
+        } finally {
+            if (session != null) {
+                session.removeProgressListener(progressListener);
+            }
         }
     }
 
@@ -2,7 +2,9 @@ package io.realm.internal.events;
 
 import org.bson.codecs.configuration.CodecRegistry;
 
+import java.io.EOFException;
 import java.io.IOException;
+import java.nio.ByteBuffer;
 
 import io.realm.internal.objectserver.EventStream;
 import io.realm.internal.objectstore.OsJavaNetworkTransport;
@@ -11,10 +13,14 @@ import io.realm.mongodb.AppException;
 import io.realm.mongodb.mongo.events.BaseChangeEvent;
 
 public class NetworkEventStream<T> implements EventStream<T> {
+    private static final int READ_BUFFER_SIZE = 16 * 1024;
+
     private final OsJavaNetworkTransport.Response response;
     private final OsWatchStream watchStream;
     private final CodecRegistry codecRegistry;
     private final Class<T> documentClass;
+    // Whatever is available on the network is read at once, events are usually much smaller than this.
+    private final ByteBuffer readBuffer = ByteBuffer.allocateDirect(READ_BUFFER_SIZE);
 
     public NetworkEventStream(OsJavaNetworkTransport.Response response, CodecRegistry codecRegistry, Class<T> documentClass) {
         this.response = response;
@@ -31,18 +37,21 @@ public class NetworkEventStream<T> implements EventStream<T> {
      */
     @Override
     public BaseChangeEvent<T> getNextEvent() throws AppException, IOException {
-        while (true) {
-            watchStream.feedLine(response.readBodyLine());
-            String watchStreamState = watchStream.getState();
-
-            if (watchStreamState.equals(OsWatchStream.HAVE_EVENT)) {
-                return ChangeEvent.fromBsonDocument(watchStream.getNextEvent(), documentClass, codecRegistry);
-            }
-            if (watchStreamState.equals(OsWatchStream.HAVE_ERROR)) {
-                response.close();
-                throw watchStream.getError();
+        int watchStreamState = watchStream.getState();
+        while (watchStreamState == OsWatchStream.NEED_DATA) {
+            readBuffer.clear();
+            int length = response.readBody(readBuffer);
+            if (length == -1) {
+                throw new EOFException("The change stream was closed by the server.");
             }
+            watchStreamState = watchStream.feedBytes(readBuffer, length);
+        }
+
+        if (watchStreamState == OsWatchStream.HAVE_ERROR) {
+            response.close();
+            throw watchStream.getError();
         }
+        return ChangeEvent.fromBsonDocument(watchStream.getNextEvent(), documentClass, codecRegistry);
     }
 
     /**
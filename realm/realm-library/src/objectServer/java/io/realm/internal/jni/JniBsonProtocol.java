@@ -16,6 +16,8 @@
 
 package io.realm.internal.jni;
 
+import org.bson.BsonBinaryReader;
+import org.bson.BsonBinaryWriter;
 import org.bson.BsonValue;
 import org.bson.codecs.Codec;
 import org.bson.codecs.Decoder;
@@ -24,6 +26,7 @@ import org.bson.codecs.Encoder;
 import org.bson.codecs.EncoderContext;
 import org.bson.codecs.configuration.CodecConfigurationException;
 import org.bson.codecs.configuration.CodecRegistry;
+import org.bson.io.BasicOutputBuffer;
 import org.bson.json.JsonMode;
 import org.bson.json.JsonReader;
 import org.bson.json.JsonWriter;
@@ -31,6 +34,9 @@ import org.bson.json.JsonWriterSettings;
 
 import java.io.StringReader;
 import java.io.StringWriter;
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.List;
 
 import io.realm.mongodb.ErrorCode;
 import io.realm.mongodb.AppException;
@@ -40,6 +46,10 @@ import io.realm.mongodb.AppException;
  * <p>
  * For now this just encapsulated the BSON value in a document with key {@value VALUE}. This
  * overcomes the shortcoming of {@code org.bson.JsonWrite} not being able to serialize single values.
+ * <p>
+ * Values are either encoded as extended JSON strings or as binary BSON byte arrays. The binary
+ * encoding skips printing and parsing text on both sides of JNI, and should be used for everything
+ * exchanged with MongoDB Realm.
  */
 public class JniBsonProtocol {
 
@@ -97,6 +107,99 @@ public class JniBsonProtocol {
         }
     }
 
+    public static <T> byte[] encodeBinary(T value, CodecRegistry registry) {
+        // catch possible missing codecs before the actual encoding
+        return encodeBinary(value, (Encoder<T>) getCodec(value.getClass(), registry));
+    }
+
+    public static <T> byte[] encodeBinary(T value, Encoder<T> encoder) {
+        try {
+            BasicOutputBuffer buffer = new BasicOutputBuffer();
+            BsonBinaryWriter binaryWriter = new BsonBinaryWriter(buffer);
+            binaryWriter.writeStartDocument();
+            binaryWriter.writeName(VALUE);
+            encoder.encode(binaryWriter, value, EncoderContext.builder().build());
+            binaryWriter.writeEndDocument();
+            binaryWriter.close();
+            return buffer.toByteArray();
+        } catch (CodecConfigurationException e) {
+            // same exception as in the guard above, but needed here as well nonetheless as the
+            // result might be wrapped inside an iterable or a map and the codec for the end type
+            // might be missing
+            throw new AppException(ErrorCode.BSON_CODEC_NOT_FOUND, "Could not resolve encoder for end type", e);
+        } catch (Exception e) {
+            throw new AppException(ErrorCode.BSON_ENCODING, "Error encoding value", e);
+        }
+    }
+
+    /**
+     * Encodes the values as a number of binary arrays, each holding at most {@code maxCount}
+     * values and at most {@code maxBytes} bytes, unless a single value is larger than that. An
+     * empty list is encoded as a single empty array.
+     */
+    public static <T> List<BinaryBatch> encodeBinaryBatches(List<? extends T> values, CodecRegistry registry, int maxCount, int maxBytes) {
+        List<BinaryBatch> batches = new ArrayList<>();
+        int offset = 0;
+        do {
+            try {
+                BasicOutputBuffer buffer = new BasicOutputBuffer();
+                BsonBinaryWriter binaryWriter = new BsonBinaryWriter(buffer);
+                binaryWriter.writeStartDocument();
+                binaryWriter.writeName(VALUE);
+                binaryWriter.writeStartArray();
+                int count = 0;
+                while (offset + count < values.size() && count < maxCount) {
+                    T value = values.get(offset + count);
+                    Encoder<T> encoder = (Encoder<T>) getCodec(value.getClass(), registry);
+                    binaryWriter.mark();
+                    encoder.encode(binaryWriter, value, EncoderContext.builder().build());
+                    // Two more bytes are needed to end the array and the document
+                    if (count > 0 && buffer.getPosition() + 2 > maxBytes) {
+                        binaryWriter.reset();
+                        break;
+                    }
+                    count++;
+                }
+                binaryWriter.writeEndArray();
+                binaryWriter.writeEndDocument();
+                binaryWriter.close();
+                batches.add(new BinaryBatch(buffer.toByteArray(), offset, count));
+                offset += count;
+            } catch (AppException e) {
+                throw e;
+            } catch (CodecConfigurationException e) {
+                throw new AppException(ErrorCode.BSON_CODEC_NOT_FOUND, "Could not resolve encoder for end type", e);
+            } catch (Exception e) {
+                throw new AppException(ErrorCode.BSON_ENCODING, "Error encoding value", e);
+            }
+        } while (offset < values.size());
+        return batches;
+    }
+
+    public static <T> T decode(byte[] bytes, Class<T> clz, CodecRegistry registry) {
+        // catch possible missing codecs before the actual decoding
+        return decode(bytes, getCodec(clz, registry));
+    }
+
+    public static <T> T decode(byte[] bytes, Decoder<T> decoder) {
+        try {
+            BsonBinaryReader binaryReader = new BsonBinaryReader(ByteBuffer.wrap(bytes));
+            binaryReader.readStartDocument();
+            binaryReader.readName(VALUE);
+            T value = decoder.decode(binaryReader, DecoderContext.builder().build());
+            binaryReader.readEndDocument();
+            binaryReader.close();
+            return value;
+        } catch (CodecConfigurationException e) {
+            // same exception as in the guard above, but needed here as well nonetheless as the
+            // result might be wrapped inside an iterable or a map and the codec for the end type
+            // might be missing
+            throw new AppException(ErrorCode.BSON_CODEC_NOT_FOUND, "Could not resolve decoder for end type", e);
+        } catch (Exception e) {
+            throw new AppException(ErrorCode.BSON_DECODING, "Error decoding value of " + bytes.length + " bytes", e);
+        }
+    }
+
     public static <T> Codec<T> getCodec(Class<T> clz, CodecRegistry registry) {
         try {
             return registry.get(clz);
@@ -104,4 +207,20 @@ public class JniBsonProtocol {
             throw new AppException(ErrorCode.BSON_CODEC_NOT_FOUND, "Could not resolve codec for " + clz.getSimpleName(), e);
         }
     }
+
+    /**
+     * A binary encoded array holding the values {@code offset} to {@code offset + size - 1} of a
+     * list.
+     */
+    public static class BinaryBatch {
+        public final byte[] data;
+        public final int offset;
+        public final int size;
+
+        BinaryBatch(byte[] data, int offset, int size) {
+            this.data = data;
+            this.offset = offset;
+            this.size = size;
+        }
+    }
 }
@@ -1,6 +1,8 @@
 package io.realm.internal.network;
 
 import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.charset.Charset;
 import java.util.HashMap;
 import java.util.Map;
 import java.util.concurrent.TimeUnit;
@@ -25,6 +27,7 @@ import okio.BufferedSource;
 public class OkHttpNetworkTransport extends OsJavaNetworkTransport {
 
     public static final MediaType JSON = MediaType.parse("application/json; charset=utf-8");
+    private static final Charset UTF8 = Charset.forName("UTF-8");
 
     private volatile OkHttpClient client = null;
     private volatile OkHttpClient streamClient = null;
@@ -36,7 +39,11 @@ public class OkHttpNetworkTransport extends OsJavaNetworkTransport {
         this.httpLogObfuscator = httpLogObfuscator;
     }
 
-    private okhttp3.Request makeRequest(String method, String url, Map<String, String> headers, String body){
+    private okhttp3.Request makeRequest(String method, String url, Map<String, String> headers, String body) {
+        return makeRequest(method, url, headers, RequestBody.create(JSON, body));
+    }
+
+    private okhttp3.Request makeRequest(String method, String url, Map<String, String> headers, RequestBody body){
         okhttp3.Request.Builder builder = new okhttp3.Request.Builder().url(url);
 
         // Ensure that we have correct custom headers until OS handles it.
@@ -63,16 +70,16 @@ public class OkHttpNetworkTransport extends OsJavaNetworkTransport {
                 builder.get();
                 break;
             case "delete":
-                builder.delete(RequestBody.create(JSON, body));
+                builder.delete(body);
                 break;
             case "patch":
-                builder.patch(RequestBody.create(JSON, body));
+                builder.patch(body);
                 break;
             case "post":
-                builder.post(RequestBody.create(JSON, body));
+                builder.post(body);
                 break;
             case "put":
-                builder.put(RequestBody.create(JSON, body));
+                builder.put(body);
                 break;
             default:
                 throw new IllegalArgumentException("Unknown method type: " + method);
@@ -82,23 +89,26 @@ public class OkHttpNetworkTransport extends OsJavaNetworkTransport {
     }
 
 
-    @SuppressFBWarnings("REC_CATCH_EXCEPTION")
     @Override
     public OsJavaNetworkTransport.Response sendRequest(String method, String url, long timeoutMs, Map<String, String> headers, String body) {
+        return sendRequest(method, url, timeoutMs, headers, body.getBytes(UTF8));
+    }
+
+    // Bodies are passed on as bytes, so they are never decoded to Java strings on the way to or from native code.
+    @SuppressFBWarnings("REC_CATCH_EXCEPTION")
+    @Override
+    public OsJavaNetworkTransport.Response sendRequest(String method, String url, long timeoutMs, Map<String, String> headers, byte[] body) {
         try {
             OkHttpClient client = getClient(timeoutMs);
 
             okhttp3.Response response = null;
             try {
-                okhttp3.Request request = makeRequest(method, url, headers, body);
+                okhttp3.Request request = makeRequest(method, url, headers, RequestBody.create(JSON, body));
 
                 Call call = client.newCall(request);
                 response = call.execute();
                 ResponseBody responseBody = response.body();
-                String result = "";
-                if (responseBody != null) {
-                    result = responseBody.string();
-                }
+                byte[] result = (responseBody != null) ? responseBody.bytes() : new byte[0];
                 return Response.httpResponse(response.code(), parseHeaders(response.headers()), result);
             } catch (IOException ex) {
                 return Response.ioError(ex.toString());
@@ -193,12 +203,20 @@ public class OkHttpNetworkTransport extends OsJavaNetworkTransport {
             super(httpResponseCode, customResponseCode, headers, body);
         }
 
+        private Response(int httpResponseCode, int customResponseCode, Map<String, String> headers, byte[] body) {
+            super(httpResponseCode, customResponseCode, headers, body);
+        }
+
         private Response(int httpResponseCode, Map<String, String> headers, BufferedSource bufferedSource) {
             super(httpResponseCode, 0, headers, "");
 
             this.bufferedSource = bufferedSource;
         }
 
+        public static OsJavaNetworkTransport.Response httpResponse(int statusCode, Map<String, String> responseHeaders, byte[] body) {
+            return new Response(statusCode, 0, responseHeaders, body);
+        }
+
         public static OsJavaNetworkTransport.Response httpResponse(int httpResponseCode, Map<String, String> headers, BufferedSource originalResponse) {
             return new Response(httpResponseCode, headers, originalResponse);
         }
@@ -213,6 +231,16 @@ public class OkHttpNetworkTransport extends OsJavaNetworkTransport {
             }
         }
 
+        @Override
+        public int readBody(ByteBuffer buffer) throws IOException {
+            if (!closed){
+                return bufferedSource.read(buffer);
+            } else{
+                bufferedSource.close();
+                throw new IOException("Stream closed");
+            }
+        }
+
         /**
          * Closes the current stream.
          *
@@ -30,6 +30,21 @@ public class OsApp implements NativeObject {
     }
 
     public OsApp(AppConfiguration config, String userAgentBindingInfo, String appDefinedUserAgent, String syncDir) {
+        OkHttpNetworkTransport okHttpTransport = new OkHttpNetworkTransport(config.getHttpLogObfuscator());
+        okHttpTransport.setAuthorizationHeaderName(config.getAuthorizationHeaderName());
+        for (Map.Entry<String, String> entry : config.getCustomRequestHeaders().entrySet()) {
+            okHttpTransport.addCustomRequestHeader(entry.getKey(), entry.getValue());
+        }
+        long nativeTransportPtr = 0;
+        if (config.isNativeNetworkTransportEnabled()) {
+            OsNativeNetworkTransport nativeTransport = new OsNativeNetworkTransport(
+                    config.getAuthorizationHeaderName(), config.getCustomRequestHeaders(), okHttpTransport);
+            nativeTransportPtr = nativeTransport.getNativePtr();
+            this.networkTransport = nativeTransport;
+        } else {
+            this.networkTransport = okHttpTransport;
+        }
+
         synchronized (OsApp.class) { // We need to synchronize access as OS caches the App instance
             nativePtr = nativeCreate(
                     config.getAppId(),
@@ -43,13 +58,8 @@ public class OsApp implements NativeObject {
                     appDefinedUserAgent,
                     "android",
                     android.os.Build.VERSION.RELEASE,
-                    io.realm.BuildConfig.VERSION_NAME);
-        }
-
-        this.networkTransport = new OkHttpNetworkTransport(config.getHttpLogObfuscator());
-        networkTransport.setAuthorizationHeaderName(config.getAuthorizationHeaderName());
-        for (Map.Entry<String, String> entry : config.getCustomRequestHeaders().entrySet()) {
-            networkTransport.addCustomRequestHeader(entry.getKey(), entry.getValue());
+                    io.realm.BuildConfig.VERSION_NAME,
+                    nativeTransportPtr);
         }
     }
 
@@ -124,7 +134,8 @@ public class OsApp implements NativeObject {
                                      String appUserInfo,
                                      String platform,
                                      String platformVersion,
-                                     String sdkVersion);
+                                     String sdkVersion,
+                                     long nativeTransportPtr);
 
     private static native void nativeLogin(long nativeAppPtr, long nativeCredentialsPtr, OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 
@@ -5,6 +5,8 @@ import java.util.concurrent.CountDownLatch;
 import java.util.concurrent.TimeUnit;
 import java.util.concurrent.atomic.AtomicReference;
 
+import javax.annotation.Nullable;
+
 import io.realm.mongodb.ErrorCode;
 import io.realm.mongodb.AppException;
 import io.realm.internal.KeepMember;
@@ -29,7 +31,25 @@ public class OsAsyncOpenTask {
     }
 
     public void start(long timeOut, TimeUnit unit) throws InterruptedException {
+        start(timeOut, unit, null);
+    }
+
+    /**
+     * Starts the task and waits for it to complete.
+     *
+     * @param sessionCreatedCallback called once the task has created the sync session, before waiting for the
+     * download to complete. The callback can register listeners on the session.
+     */
+    public void start(long timeOut, TimeUnit unit, @Nullable Runnable sessionCreatedCallback) throws InterruptedException {
         this.nativePtr = start(config.getNativePtr());
+        if (sessionCreatedCallback != null) {
+            try {
+                sessionCreatedCallback.run();
+            } catch (RuntimeException e) {
+                cancel(nativePtr);
+                throw e;
+            }
+        }
 
         try {
             taskComplete.await(timeOut, unit);
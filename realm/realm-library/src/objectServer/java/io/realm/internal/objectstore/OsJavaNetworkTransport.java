@@ -17,6 +17,8 @@ package io.realm.internal.objectstore;
 
 import java.io.Closeable;
 import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.charset.Charset;
 import java.util.HashMap;
 import java.util.Map;
 
@@ -36,6 +38,8 @@ public abstract class OsJavaNetworkTransport {
     public static final int ERROR_INTERRUPTED = 1001;
     public static final int ERROR_UNKNOWN = 1002;
 
+    private static final Charset UTF8 = Charset.forName("UTF-8");
+
     // Header configuration
     private String authorizationHeaderName;
     private Map<String, String> customHeaders = new HashMap<>();
@@ -56,6 +60,27 @@ public abstract class OsJavaNetworkTransport {
      */
     protected abstract Response sendRequest(String method, String url, long timeoutMs, Map<String, String> headers, String body);
 
+    /**
+     * This method is being called from JNI in order to execute the network transport itself. Request and response
+     * bodies are UTF-8 encoded bytes, so they don't have to be converted to and from Java strings when crossing JNI.
+     *
+     * The default implementation delegates to {@link #sendRequest(String, String, long, Map, String)}. Transports
+     * able to send and receive bytes should override this.
+     *
+     * Warning: This method is not allowed to throw. Any exception should be wrapped in a {@link Response}
+     * and be returned as a result.
+     *
+     * @param method Which kind of HTTP method in lowercase.
+     * @param url Url to connect to.
+     * @param timeoutMs How long does the request has to complete?
+     * @param headers Which headers to send?
+     * @param body UTF-8 encoded body to include.
+     * @return Result of the request. All exceptions should also be wrapped in this.
+     */
+    protected Response sendRequest(String method, String url, long timeoutMs, Map<String, String> headers, byte[] body) {
+        return sendRequest(method, url, timeoutMs, headers, new String(body, UTF8));
+    }
+
     /**
      * This method is being called from Java when executing streaming requests.
      * It returns a {@link Response} which body can be access line by line.
@@ -98,7 +123,9 @@ public abstract class OsJavaNetworkTransport {
         private final int httpResponseCode;
         private final int customResponseCode;
         private final Map<String, String> headers;
-        private final String body;
+        // At least one of them is set, the other one is created on first access.
+        private String body;
+        private byte[] bodyBytes;
 
         protected Response(int httpResponseCode, int customResponseCode, Map<String, String> headers, String body) {
             this.httpResponseCode = httpResponseCode;
@@ -107,6 +134,13 @@ public abstract class OsJavaNetworkTransport {
             this.body = body;
         }
 
+        protected Response(int httpResponseCode, int customResponseCode, Map<String, String> headers, byte[] body) {
+            this.httpResponseCode = httpResponseCode;
+            this.customResponseCode = customResponseCode;
+            this.headers = headers;
+            this.bodyBytes = body;
+        }
+
         public int getHttpResponseCode() {
             return httpResponseCode;
         }
@@ -133,13 +167,33 @@ public abstract class OsJavaNetworkTransport {
         }
 
         public String getBody() {
+            if (body == null && bodyBytes != null) {
+                body = new String(bodyBytes, UTF8);
+            }
             return body;
         }
 
+        // Returns the body as UTF-8 encoded bytes. Called from JNI.
+        public byte[] getBodyBytes() {
+            if (bodyBytes == null) {
+                bodyBytes = (body != null) ? body.getBytes(UTF8) : new byte[0];
+            }
+            return bodyBytes;
+        }
+
         public String readBodyLine() throws IOException {
             return null;
         }
 
+        /**
+         * Reads the next chunk of a streamed body into the buffer, starting at its position.
+         *
+         * @return the number of bytes read, or -1 if the end of the body has been reached.
+         */
+        public int readBody(ByteBuffer buffer) throws IOException {
+            return -1;
+        }
+
         public boolean isOpen() {
             return false;
         }
@@ -151,7 +205,7 @@ public abstract class OsJavaNetworkTransport {
                     "httpResponseCode=" + httpResponseCode +
                     ", customResponseCode=" + customResponseCode +
                     ", headers=" + headers +
-                    ", body='" + body + '\'' +
+                    ", body='" + getBody() + '\'' +
                     '}';
         }
 
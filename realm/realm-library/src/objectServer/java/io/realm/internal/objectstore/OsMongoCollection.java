@@ -27,11 +27,18 @@ import org.bson.conversions.Bson;
 import org.bson.types.ObjectId;
 
 import java.io.IOException;
+import java.nio.ByteBuffer;
 import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.ThreadFactory;
 import java.util.concurrent.ThreadPoolExecutor;
+import java.util.concurrent.atomic.AtomicInteger;
 import java.util.concurrent.atomic.AtomicReference;
 
 import javax.annotation.Nullable;
@@ -46,12 +53,15 @@ import io.realm.internal.network.StreamNetworkTransport;
 import io.realm.internal.objectserver.EventStream;
 import io.realm.mongodb.App;
 import io.realm.mongodb.AppException;
+import io.realm.mongodb.ErrorCode;
 import io.realm.mongodb.mongo.MongoNamespace;
 import io.realm.mongodb.mongo.iterable.AggregateIterable;
 import io.realm.mongodb.mongo.iterable.FindIterable;
 import io.realm.mongodb.mongo.options.CountOptions;
 import io.realm.mongodb.mongo.options.FindOneAndModifyOptions;
 import io.realm.mongodb.mongo.options.FindOptions;
+import io.realm.mongodb.mongo.options.InsertManyException;
+import io.realm.mongodb.mongo.options.InsertManyOptions;
 import io.realm.mongodb.mongo.options.InsertManyResult;
 import io.realm.mongodb.mongo.options.UpdateOptions;
 import io.realm.mongodb.mongo.result.DeleteResult;
@@ -81,10 +91,27 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
 
     private static final long nativeFinalizerPtr = nativeGetFinalizerMethodPtr();
 
+    /**
+     * Runs requests sent on behalf of another operation which is already running, e.g. the additional batches of
+     * insertMany() and the next page prefetched by a paged cursor. Not the network pool of the app: those operations
+     * often run on it themselves, and its queue is bounded, so waiting for it could deadlock or be rejected. Idle
+     * threads terminate.
+     */
+    public static final ExecutorService CONCURRENT_REQUEST_EXECUTOR = Executors.newCachedThreadPool(new ThreadFactory() {
+        private final AtomicInteger threadCount = new AtomicInteger(0);
+
+        @Override
+        public Thread newThread(Runnable runnable) {
+            Thread thread = new Thread(runnable, "RealmMongoRequest-" + threadCount.incrementAndGet());
+            thread.setDaemon(true);
+            return thread;
+        }
+    });
+
     private final long nativePtr;
     private final Class<DocumentT> documentClass;
     private final CodecRegistry codecRegistry;
-    private final String encodedEmptyDocument;
+    private final byte[] encodedEmptyDocument;
     private final ThreadPoolExecutor threadPoolExecutor = App.NETWORK_POOL_EXECUTOR;
     private final String serviceName;
     private final MongoNamespace namespace;
@@ -101,7 +128,7 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
         this.serviceName = serviceName;
         this.documentClass = documentClass;
         this.codecRegistry = codecRegistry;
-        this.encodedEmptyDocument = JniBsonProtocol.encode(new Document(), codecRegistry);
+        this.encodedEmptyDocument = JniBsonProtocol.encodeBinary(new Document(), codecRegistry);
         this.streamNetworkTransport = streamNetworkTransport;
     }
 
@@ -154,10 +181,10 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
             }
         };
 
-        final String filterString = JniBsonProtocol.encode(filter, codecRegistry);
+        final byte[] encodedFilter = JniBsonProtocol.encodeBinary(filter, codecRegistry);
         final int limit = (options == null) ? 0 : options.getLimit();
 
-        nativeCount(nativePtr, filterString, limit, callback);
+        nativeCount(nativePtr, encodedFilter, limit, callback);
 
         return ResultHandler.handleResult(success, error);
     }
@@ -259,22 +286,22 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
             }
         };
 
-        final String encodedFilter = JniBsonProtocol.encode(filter, codecRegistry);
+        final byte[] encodedFilter = JniBsonProtocol.encodeBinary(filter, codecRegistry);
 
         // default to empty docs or update if needed
-        String projectionString = encodedEmptyDocument;
-        String sortString = encodedEmptyDocument;
+        byte[] encodedProjection = encodedEmptyDocument;
+        byte[] encodedSort = encodedEmptyDocument;
 
         switch (type) {
             case FIND_ONE:
-                nativeFindOne(FIND_ONE, nativePtr, encodedFilter, projectionString, sortString, 0, callback);
+                nativeFindOne(FIND_ONE, nativePtr, encodedFilter, encodedProjection, encodedSort, 0, callback);
                 break;
             case FIND_ONE_WITH_OPTIONS:
                 Util.checkNull(options, "options");
-                projectionString = JniBsonProtocol.encode(options.getProjection(), codecRegistry);
-                sortString = JniBsonProtocol.encode(options.getSort(), codecRegistry);
+                encodedProjection = JniBsonProtocol.encodeBinary(options.getProjection(), codecRegistry);
+                encodedSort = JniBsonProtocol.encodeBinary(options.getSort(), codecRegistry);
 
-                nativeFindOne(FIND_ONE_WITH_OPTIONS, nativePtr, encodedFilter, projectionString, sortString, options.getLimit(), callback);
+                nativeFindOne(FIND_ONE_WITH_OPTIONS, nativePtr, encodedFilter, encodedProjection, encodedSort, options.getLimit(), callback);
                 break;
             default:
                 throw new IllegalArgumentException("Invalid fineOne type: " + type);
@@ -289,34 +316,118 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
         OsJNIResultCallback<InsertOneResult> callback = new OsJNIResultCallback<InsertOneResult>(success, error) {
             @Override
             protected InsertOneResult mapSuccess(Object result) {
-                BsonValue id = JniBsonProtocol.decode((String) result, BsonValue.class, codecRegistry);
+                BsonValue id = JniBsonProtocol.decode((byte[]) result, BsonValue.class, codecRegistry);
                 return new InsertOneResult(id);
             }
         };
 
-        final String encodedDocument = JniBsonProtocol.encode(document, codecRegistry);
+        final byte[] encodedDocument = JniBsonProtocol.encodeBinary(document, codecRegistry);
         nativeInsertOne(nativePtr, encodedDocument, callback);
         return ResultHandler.handleResult(success, error);
     }
 
     public InsertManyResult insertMany(final List<? extends DocumentT> documents) {
-        AtomicReference<InsertManyResult> success = new AtomicReference<>(null);
+        return insertMany(documents, new InsertManyOptions());
+    }
+
+    public InsertManyResult insertMany(final List<? extends DocumentT> documents, final InsertManyOptions options) {
+        if (documents.isEmpty()) {
+            throw new IllegalArgumentException("The list of documents to insert must not be empty.");
+        }
+        final List<JniBsonProtocol.BinaryBatch> batches = JniBsonProtocol.encodeBinaryBatches(documents,
+                codecRegistry, options.getMaxBatchSize(), options.getMaxBatchBytes());
+        final Map<Long, BsonValue> insertedIdsMap = new HashMap<>();
+        final AtomicInteger nextBatch = new AtomicInteger(0);
+        final AtomicReference<Throwable> firstError = new AtomicReference<>(null);
+        final InsertManyOptions.ProgressListener progressListener = options.getProgressListener();
+
+        // Each worker inserts batches until all have been taken or one failed. The calling thread is one of the
+        // workers, so with a single request in flight no other thread is involved.
+        Runnable worker = new Runnable() {
+            @Override
+            public void run() {
+                try {
+                    int index;
+                    while (firstError.get() == null && (index = nextBatch.getAndIncrement()) < batches.size()) {
+                        JniBsonProtocol.BinaryBatch batch = batches.get(index);
+                        Map<Long, BsonValue> batchIds = insertBatch(batch);
+                        synchronized (insertedIdsMap) {
+                            insertedIdsMap.putAll(batchIds);
+                            if (progressListener != null) {
+                                progressListener.onProgress(insertedIdsMap.size(), documents.size());
+                            }
+                        }
+                    }
+                } catch (Throwable e) {
+                    // Also stops the other workers
+                    firstError.compareAndSet(null, e);
+                }
+            }
+        };
+
+        int helpers = Math.min(options.getMaxRequestsInFlight(), batches.size()) - 1;
+        List<Future<?>> helperFutures = new ArrayList<>(Math.max(helpers, 0));
+        for (int i = 0; i < helpers; i++) {
+            helperFutures.add(CONCURRENT_REQUEST_EXECUTOR.submit(worker));
+        }
+        worker.run();
+        try {
+            for (Future<?> future : helperFutures) {
+                // Workers catch everything, and requests in flight are bounded by their timeout
+                future.get();
+            }
+        } catch (InterruptedException e) {
+            firstError.compareAndSet(null, e);
+            Thread.currentThread().interrupt();
+            throw partialFailure(new AppException(ErrorCode.NETWORK_INTERRUPTED, e), insertedIdsMap);
+        } catch (ExecutionException e) {
+            firstError.compareAndSet(null, e.getCause());
+        }
+
+        Throwable error = firstError.get();
+        if (error instanceof Error) {
+            throw (Error) error;
+        } else if (error instanceof AppException) {
+            throw partialFailure((AppException) error, insertedIdsMap);
+        } else if (error != null) {
+            throw partialFailure(new AppException(ErrorCode.UNKNOWN, error), insertedIdsMap);
+        }
+        return new InsertManyResult(insertedIdsMap);
+    }
+
+    // Attaches the ids of the batches which succeeded, so callers know what was written.
+    private static InsertManyException partialFailure(AppException error, Map<Long, BsonValue> insertedIdsMap) {
+        synchronized (insertedIdsMap) {
+            return new InsertManyException(error, new InsertManyResult(new HashMap<>(insertedIdsMap)));
+        }
+    }
+
+    // Returns the ids of the inserted documents by their index in the full list of documents.
+    private Map<Long, BsonValue> insertBatch(final JniBsonProtocol.BinaryBatch batch) {
+        AtomicReference<Map<Long, BsonValue>> success = new AtomicReference<>(null);
         AtomicReference<AppException> error = new AtomicReference<>(null);
-        OsJNIResultCallback<InsertManyResult> callback = new OsJNIResultCallback<InsertManyResult>(success, error) {
+        OsJNIResultCallback<Map<Long, BsonValue>> callback = new OsJNIResultCallback<Map<Long, BsonValue>>(success, error) {
             @Override
-            protected InsertManyResult mapSuccess(Object result) {
-                Object[] objects = (Object[]) result;
+            protected Map<Long, BsonValue> mapSuccess(Object result) {
                 Map<Long, BsonValue> insertedIdsMap = new HashMap<>();
-                for (int i = 0; i < objects.length; i++) {
-                    BsonValue id = JniBsonProtocol.decode((String) objects[i], BsonValue.class, codecRegistry);
-                    insertedIdsMap.put((long) i, id);
+                if (result instanceof byte[]) {
+                    // ObjectIds packed by 12 bytes
+                    ByteBuffer packedIds = ByteBuffer.wrap((byte[]) result);
+                    for (int i = 0; packedIds.remaining() >= 12; i++) {
+                        insertedIdsMap.put((long) (batch.offset + i), new BsonObjectId(new ObjectId(packedIds)));
+                    }
+                } else {
+                    Object[] objects = (Object[]) result;
+                    for (int i = 0; i < objects.length; i++) {
+                        BsonValue id = JniBsonProtocol.decode((byte[]) objects[i], BsonValue.class, codecRegistry);
+                        insertedIdsMap.put((long) (batch.offset + i), id);
+                    }
                 }
-                return new InsertManyResult(insertedIdsMap);
+                return insertedIdsMap;
             }
         };
 
-        final String encodedDocumentArray = JniBsonProtocol.encode(documents, codecRegistry);
-        nativeInsertMany(nativePtr, encodedDocumentArray, callback);
+        nativeInsertMany(nativePtr, batch.data, callback);
         return ResultHandler.handleResult(success, error);
     }
 
@@ -338,13 +449,13 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
             }
         };
 
-        final String jsonDocument = JniBsonProtocol.encode(filter, codecRegistry);
+        final byte[] encodedFilter = JniBsonProtocol.encodeBinary(filter, codecRegistry);
         switch (type) {
             case DELETE_ONE:
-                nativeDelete(DELETE_ONE, nativePtr, jsonDocument, callback);
+                nativeDelete(DELETE_ONE, nativePtr, encodedFilter, callback);
                 break;
             case DELETE_MANY:
-                nativeDelete(DELETE_MANY, nativePtr, jsonDocument, callback);
+                nativeDelete(DELETE_MANY, nativePtr, encodedFilter, callback);
                 break;
             default:
                 throw new IllegalArgumentException("Invalid delete type: " + type);
@@ -381,7 +492,7 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
         OsJNIResultCallback<UpdateResult> callback = new OsJNIResultCallback<UpdateResult>(success, error) {
             @Override
             protected UpdateResult mapSuccess(Object result) {
-                BsonArray array = JniBsonProtocol.decode((String) result, BsonArray.class, codecRegistry);
+                BsonArray array = JniBsonProtocol.decode((byte[]) result, BsonArray.class, codecRegistry);
                 long matchedCount = array.get(0).asInt32().getValue();
                 long modifiedCount = array.get(1).asInt32().getValue();
                 BsonValue upsertedId = array.get(2);
@@ -393,18 +504,18 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
             }
         };
 
-        final String jsonFilter = JniBsonProtocol.encode(filter, codecRegistry);
-        final String jsonUpdate = JniBsonProtocol.encode(update, codecRegistry);
+        final byte[] encodedFilter = JniBsonProtocol.encodeBinary(filter, codecRegistry);
+        final byte[] encodedUpdate = JniBsonProtocol.encodeBinary(update, codecRegistry);
 
         switch (type) {
             case UPDATE_ONE:
             case UPDATE_MANY:
-                nativeUpdate(type, nativePtr, jsonFilter, jsonUpdate, false, callback);
+                nativeUpdate(type, nativePtr, encodedFilter, encodedUpdate, false, callback);
                 break;
             case UPDATE_ONE_WITH_OPTIONS:
             case UPDATE_MANY_WITH_OPTIONS:
                 Util.checkNull(options, "options");
-                nativeUpdate(type, nativePtr, jsonFilter, jsonUpdate, options.isUpsert(), callback);
+                nativeUpdate(type, nativePtr, encodedFilter, encodedUpdate, options.isUpsert(), callback);
                 break;
             default:
                 throw new IllegalArgumentException("Invalid update type: " + type);
@@ -496,18 +607,18 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
             }
         };
 
-        final String encodedFilter = JniBsonProtocol.encode(filter, codecRegistry);
-        final String encodedUpdate = JniBsonProtocol.encode(update, codecRegistry);
+        final byte[] encodedFilter = JniBsonProtocol.encodeBinary(filter, codecRegistry);
+        final byte[] encodedUpdate = JniBsonProtocol.encodeBinary(update, codecRegistry);
 
         // default to empty docs or update if needed
-        String encodedProjection = encodedEmptyDocument;
-        String encodedSort = encodedEmptyDocument;
+        byte[] encodedProjection = encodedEmptyDocument;
+        byte[] encodedSort = encodedEmptyDocument;
         if (options != null) {
             if (options.getProjection() != null) {
-                encodedProjection = JniBsonProtocol.encode(options.getProjection(), codecRegistry);
+                encodedProjection = JniBsonProtocol.encodeBinary(options.getProjection(), codecRegistry);
             }
             if (options.getSort() != null) {
-                encodedSort = JniBsonProtocol.encode(options.getSort(), codecRegistry);
+                encodedSort = JniBsonProtocol.encodeBinary(options.getSort(), codecRegistry);
             }
         }
 
@@ -544,7 +655,7 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
         if (result == null) {
             return null;
         } else {
-            return JniBsonProtocol.decode((String) result, resultClass, codecRegistry);
+            return JniBsonProtocol.decode((byte[]) result, resultClass, codecRegistry);
         }
     }
 
@@ -596,63 +707,63 @@ public class OsMongoCollection<DocumentT> implements NativeObject {
     private static native long nativeGetFinalizerMethodPtr();
 
     private static native void nativeCount(long remoteMongoCollectionPtr,
-                                           String filter,
+                                           byte[] filter,
                                            long limit,
                                            OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 
     private static native void nativeFindOne(int findOneType,
                                              long nativePtr,
-                                             String filter,
-                                             String projection,
-                                             String sort,
+                                             byte[] filter,
+                                             byte[] projection,
+                                             byte[] sort,
                                              long limit,
                                              OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 
     private static native void nativeInsertOne(long remoteMongoCollectionPtr,
-                                               String document,
+                                               byte[] document,
                                                OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 
     private static native void nativeInsertMany(long remoteMongoCollectionPtr,
-                                                String documents,
+                                                byte[] documents,
                                                 OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 
     private static native void nativeDelete(int deleteType,
                                             long remoteMongoCollectionPtr,
-                                            String document,
+                                            byte[] document,
                                             OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 
     private static native void nativeUpdate(int updateType,
                                             long remoteMongoCollectionPtr,
-                                            String filter,
-                                            String update,
+                                            byte[] filter,
+                                            byte[] update,
                                             boolean upsert,
                                             OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 
     private static native void nativeFindOneAndUpdate(int findOneAndUpdateType,
                                                       long remoteMongoCollectionPtr,
-                                                      String filter,
-                                                      String update,
-                                                      String projection,
-                                                      String sort,
+                                                      byte[] filter,
+                                                      byte[] update,
+                                                      byte[] projection,
+                                                      byte[] sort,
                                                       boolean upsert,
                                                       boolean returnNewDocument,
                                                       OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 
     private static native void nativeFindOneAndReplace(int findOneAndReplaceType,
                                                        long remoteMongoCollectionPtr,
-                                                       String filter,
-                                                       String update,
-                                                       String projection,
-                                                       String sort,
+                                                       byte[] filter,
+                                                       byte[] update,
+                                                       byte[] projection,
+                                                       byte[] sort,
                                                        boolean upsert,
                                                        boolean returnNewDocument,
                                                        OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 
     private static native void nativeFindOneAndDelete(int findOneAndDeleteType,
                                                       long remoteMongoCollectionPtr,
-                                                      String filter,
-                                                      String projection,
-                                                      String sort,
+                                                      byte[] filter,
+                                                      byte[] projection,
+                                                      byte[] sort,
                                                       boolean upsert,
                                                       boolean returnNewDocument,
                                                       OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
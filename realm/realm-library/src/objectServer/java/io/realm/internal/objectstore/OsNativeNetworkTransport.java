@@ -0,0 +1,121 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm.internal.objectstore;
+
+import java.io.IOException;
+import java.nio.charset.Charset;
+import java.util.HashMap;
+import java.util.Map;
+
+import io.realm.internal.Keep;
+import io.realm.internal.NativeContext;
+import io.realm.internal.NativeObject;
+import io.realm.mongodb.AppException;
+
+/**
+ * Network transport executing requests with a native HTTP client instead of a Java one.
+ * <p>
+ * When used by an {@link OsApp}, the requests of ObjectStore never enter the JVM: the native client keeps a pool of
+ * keep-alive connections per server and completes requests asynchronously on its own thread. Requests sent through
+ * {@link #sendRequest(String, String, long, Map, byte[])} use the same client. Streaming requests are not supported
+ * by the native client and are delegated to the given streaming transport.
+ * <p>
+ * The authorization header name and the custom headers are fixed when the transport is created.
+ */
+public class OsNativeNetworkTransport extends OsJavaNetworkTransport implements NativeObject {
+
+    private static final long nativeFinalizerPtr = nativeGetFinalizerMethodPtr();
+
+    private final long nativePtr;
+    private final OsJavaNetworkTransport streamingTransport;
+
+    public OsNativeNetworkTransport(String authorizationHeaderName,
+                                    Map<String, String> customHeaders,
+                                    OsJavaNetworkTransport streamingTransport) {
+        this.streamingTransport = streamingTransport;
+        setAuthorizationHeaderName(authorizationHeaderName);
+        for (Map.Entry<String, String> entry : customHeaders.entrySet()) {
+            addCustomRequestHeader(entry.getKey(), entry.getValue());
+        }
+        this.nativePtr = nativeCreate(authorizationHeaderName, toJNIFriendlyHeaders(customHeaders));
+        NativeContext.dummyContext.addReference(this);
+    }
+
+    @Override
+    public long getNativePtr() {
+        return nativePtr;
+    }
+
+    @Override
+    public long getNativeFinalizerPtr() {
+        return nativeFinalizerPtr;
+    }
+
+    @Override
+    public Response sendRequest(String method, String url, long timeoutMs, Map<String, String> headers, String body) {
+        return sendRequest(method, url, timeoutMs, headers, body.getBytes(Charset.forName("UTF-8")));
+    }
+
+    @Override
+    public Response sendRequest(String method, String url, long timeoutMs, Map<String, String> headers, byte[] body) {
+        return nativeSendRequest(nativePtr, method, url, timeoutMs, toJNIFriendlyHeaders(headers), body);
+    }
+
+    @Override
+    public Response sendStreamingRequest(Request request) throws IOException, AppException {
+        return streamingTransport.sendStreamingRequest(request);
+    }
+
+    // Serializes headers to pairs of { key, value }, like Response.getJNIFriendlyHeaders().
+    private static String[] toJNIFriendlyHeaders(Map<String, String> headers) {
+        String[] jniHeaders = new String[headers.size() * 2];
+        int i = 0;
+        for (Map.Entry<String, String> entry : headers.entrySet()) {
+            jniHeaders[i] = entry.getKey();
+            jniHeaders[i + 1] = entry.getValue();
+            i = i + 2;
+        }
+        return jniHeaders;
+    }
+
+    // Created from JNI
+    @Keep
+    static class NativeResponse extends Response {
+        NativeResponse(int httpResponseCode, int customResponseCode, String[] headers, byte[] body) {
+            super(httpResponseCode, customResponseCode, toMap(headers), body);
+        }
+
+        private static Map<String, String> toMap(String[] headers) {
+            Map<String, String> map = new HashMap<>(headers.length / 2);
+            for (int i = 0; i + 1 < headers.length; i = i + 2) {
+                map.put(headers[i], headers[i + 1]);
+            }
+            return map;
+        }
+
+        @Override
+        public void close() {
+        }
+    }
+
+    private static native long nativeGetFinalizerMethodPtr();
+
+    private static native long nativeCreate(String authorizationHeaderName, String[] customHeaders);
+
+    private static native Response nativeSendRequest(long nativePtr, String method, String url, long timeoutMs,
+                                                     String[] headers, byte[] body);
+}
@@ -129,7 +129,7 @@ public class OsSyncUser implements NativeObject {
     }
 
     public Document getCustomData() {
-        String encodedData = nativeCustomData(nativePtr);
+        byte[] encodedData = nativeCustomData(nativePtr);
         // Stitch also used default codec registry for parsing access token
         return JniBsonProtocol.decode(encodedData, AppConfiguration.DEFAULT_BSON_CODEC_REGISTRY.get(Document.class));
     }
@@ -181,6 +181,6 @@ public class OsSyncUser implements NativeObject {
     private static native void nativeSetState(long nativePtr, byte state);
     private static native String nativeGetProviderType(long nativePtr);
     private static native String nativeGetDeviceId(long nativePtr);
-    private static native String nativeCustomData(long nativeUserPtr);
+    private static native byte[] nativeCustomData(long nativeUserPtr);
     private static native void nativeRefreshCustomData(long nativeUserPtr, OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 }
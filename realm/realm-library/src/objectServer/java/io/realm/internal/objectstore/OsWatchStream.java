@@ -1,23 +1,42 @@
 package io.realm.internal.objectstore;
 
+import org.bson.BsonArray;
 import org.bson.BsonDocument;
+import org.bson.BsonValue;
 import org.bson.codecs.configuration.CodecRegistry;
 
+import java.nio.ByteBuffer;
+import java.util.ArrayDeque;
+
+import javax.annotation.Nullable;
+
+import io.realm.internal.NativeContext;
 import io.realm.internal.NativeObject;
 import io.realm.internal.jni.JniBsonProtocol;
 import io.realm.mongodb.AppException;
 
+/**
+ * Parses the body of a change stream response.
+ * <p>
+ * The raw body is fed as it is read from the network, the native stream splits it into lines and collects all events
+ * they contain. The events are fetched from native in batches and handed out one by one by {@link #getNextEvent()}.
+ */
 public class OsWatchStream implements NativeObject {
-    public static final String NEED_DATA = "NEED_DATA";
-    public static final String HAVE_EVENT = "HAVE_EVENT";
-    public static final String HAVE_ERROR = "HAVE_ERROR";
+    // Must match the states returned by the native functions.
+    public static final int NEED_DATA = 0;
+    public static final int HAVE_EVENT = 1;
+    public static final int HAVE_ERROR = 2;
+
+    private static final long nativeFinalizerPtr = nativeGetFinalizerMethodPtr();
 
     private final long nativePtr;
     private final CodecRegistry codecRegistry;
+    private final ArrayDeque<BsonDocument> events = new ArrayDeque<>();
 
     public OsWatchStream(CodecRegistry codecRegistry) {
         this.codecRegistry = codecRegistry;
         this.nativePtr = nativeCreateWatchStream();
+        NativeContext.dummyContext.addReference(this);
     }
 
     @Override
@@ -27,30 +46,50 @@ public class OsWatchStream implements NativeObject {
 
     @Override
     public long getNativeFinalizerPtr() {
-        return nativeGetFinalizerMethodPtr();
+        return nativeFinalizerPtr;
     }
 
+    /**
+     * Returns the next event, or {@code null} if no more events have been received.
+     */
+    @Nullable
     public BsonDocument getNextEvent() {
-        String bsonEvent = nativeGetNextEvent(nativePtr);
-        return JniBsonProtocol.decode(bsonEvent, codecRegistry.get(BsonDocument.class));
+        if (events.isEmpty() && nativeGetState(nativePtr) == HAVE_EVENT) {
+            byte[] encodedEvents = nativeDrainEvents(nativePtr);
+            BsonArray array = JniBsonProtocol.decode(encodedEvents, codecRegistry.get(BsonArray.class));
+            for (BsonValue event : array) {
+                events.add(event.asDocument());
+            }
+        }
+        return events.poll();
     }
 
-    public String getState() {
-        return nativeGetState(nativePtr);
+    /**
+     * Returns {@link #HAVE_EVENT} while there are events left, otherwise {@link #HAVE_ERROR} or {@link #NEED_DATA}.
+     */
+    public int getState() {
+        return events.isEmpty() ? nativeGetState(nativePtr) : HAVE_EVENT;
     }
 
     public AppException getError() {
         return nativeGetError(nativePtr);
     }
 
-    public void feedLine(String line) {
-        nativeFeedLine(nativePtr, line);
+    /**
+     * Feeds the first {@code length} bytes of a direct buffer. The bytes may contain any number of lines, including
+     * partial ones.
+     *
+     * @return the state after the bytes have been processed, see {@link #getState()}.
+     */
+    public int feedBytes(ByteBuffer buffer, int length) {
+        int state = nativeFeedBytes(nativePtr, buffer, length);
+        return events.isEmpty() ? state : HAVE_EVENT;
     }
 
     private static native long nativeGetFinalizerMethodPtr();
     private static native long nativeCreateWatchStream();
-    private static native void nativeFeedLine(long nativePtr, String line);
-    private static native String nativeGetState(long nativePtr);
-    private static native String nativeGetNextEvent(long nativePtr);
+    private static native int nativeFeedBytes(long nativePtr, ByteBuffer buffer, int length);
+    private static native int nativeGetState(long nativePtr);
+    private static native byte[] nativeDrainEvents(long nativePtr);
     private static native AppException nativeGetError(long nativePtr);
 }
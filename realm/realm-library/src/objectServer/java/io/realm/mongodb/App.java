@@ -161,6 +161,8 @@ public class App {
 
     private final AppConfiguration config;
     final Sync syncManager;
+    @Nullable
+    final FunctionsImpl.CallCache functionCallCache;
     private final EmailPasswordAuth emailAuthProvider = new EmailPasswordAuthImpl(this);
     private CopyOnWriteArrayList<AuthenticationListener> authListeners = new CopyOnWriteArrayList<>();
     private Handler mainHandler = new Handler(Looper.getMainLooper());
@@ -179,6 +181,7 @@ public class App {
         this.config = config;
         this.osApp = init(config);
         this.syncManager = new SyncImpl(this);
+        this.functionCallCache = FunctionsImpl.CallCache.create(config);
     }
 
     private OsApp init(AppConfiguration config) {
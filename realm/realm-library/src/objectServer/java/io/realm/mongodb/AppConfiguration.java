@@ -147,6 +147,8 @@ public class AppConfiguration {
     private final CodecRegistry codecRegistry;
     @Nullable
     private final HttpLogObfuscator httpLogObfuscator;
+    private final boolean nativeNetworkTransportEnabled;
+    private final long functionCallCacheTtlMs;
 
     private AppConfiguration(String appId,
                              String appName,
@@ -160,7 +162,9 @@ public class AppConfiguration {
                              Map<String, String> customHeaders,
                              File syncRootdir,
                              CodecRegistry codecRegistry,
-                             @Nullable HttpLogObfuscator httpLogObfuscator) {
+                             @Nullable HttpLogObfuscator httpLogObfuscator,
+                             boolean nativeNetworkTransportEnabled,
+                             long functionCallCacheTtlMs) {
         this.appId = appId;
         this.appName = appName;
         this.appVersion = appVersion;
@@ -174,6 +178,8 @@ public class AppConfiguration {
         this.syncRootDir = syncRootdir;
         this.codecRegistry = codecRegistry;
         this.httpLogObfuscator = httpLogObfuscator;
+        this.nativeNetworkTransportEnabled = nativeNetworkTransportEnabled;
+        this.functionCallCacheTtlMs = functionCallCacheTtlMs;
     }
 
     /**
@@ -310,6 +316,39 @@ public class AppConfiguration {
         return httpLogObfuscator;
     }
 
+    /**
+     * Returns whether requests against the MongoDB Realm application are sent by the native network transport.
+     *
+     * @return {@code true} if the native network transport is used, {@code false} if OkHttp is used.
+     * @see Builder#nativeNetworkTransport(boolean)
+     */
+    public boolean isNativeNetworkTransportEnabled() {
+        return nativeNetworkTransportEnabled;
+    }
+
+    /**
+     * Returns whether calls of MongoDB Realm functions are coalesced and their results cached.
+     *
+     * @return {@code true} if the function call cache is enabled, {@code false} otherwise.
+     * @see Builder#functionCallCache(long, TimeUnit)
+     */
+    public boolean isFunctionCallCacheEnabled() {
+        return functionCallCacheTtlMs >= 0;
+    }
+
+    /**
+     * Returns how long results of MongoDB Realm functions are cached.
+     * <p>
+     * This value is only applicable if {@link #isFunctionCallCacheEnabled()} returns {@code true}.
+     *
+     * @param unit the unit of time of the returned value.
+     * @return the time to live of the cached results.
+     * @see Builder#functionCallCache(long, TimeUnit)
+     */
+    public long getFunctionCallCacheTimeToLive(TimeUnit unit) {
+        return unit.convert(functionCallCacheTtlMs, TimeUnit.MILLISECONDS);
+    }
+
     @Override
     public boolean equals(Object o) {
         if (this == o) return true;
@@ -318,6 +357,8 @@ public class AppConfiguration {
         AppConfiguration that = (AppConfiguration) o;
 
         if (requestTimeoutMs != that.requestTimeoutMs) return false;
+        if (nativeNetworkTransportEnabled != that.nativeNetworkTransportEnabled) return false;
+        if (functionCallCacheTtlMs != that.functionCallCacheTtlMs) return false;
         if (!appId.equals(that.appId)) return false;
         if (appName != null ? !appName.equals(that.appName) : that.appName != null) return false;
         if (appVersion != null ? !appVersion.equals(that.appVersion) : that.appVersion != null)
@@ -346,6 +387,8 @@ public class AppConfiguration {
         result = 31 * result + syncRootDir.hashCode();
         result = 31 * result + codecRegistry.hashCode();
         result = 31 * result + (httpLogObfuscator != null ? httpLogObfuscator.hashCode() : 0);
+        result = 31 * result + (nativeNetworkTransportEnabled ? 1 : 0);
+        result = 31 * result + (int) (functionCallCacheTtlMs ^ (functionCallCacheTtlMs >>> 32));
         return result;
     }
 
@@ -402,6 +445,8 @@ public class AppConfiguration {
         private CodecRegistry codecRegistry = DEFAULT_BSON_CODEC_REGISTRY;
         @Nullable
         private HttpLogObfuscator httpLogObfuscator = new HttpLogObfuscator(LOGIN_FEATURE, loginObfuscators);
+        private boolean nativeNetworkTransportEnabled = false;
+        private long functionCallCacheTtlMs = -1;
 
         /**
          * Creates an instance of the Builder for the AppConfiguration.
@@ -633,6 +678,51 @@ public class AppConfiguration {
             return this;
         }
 
+        /**
+         * Sends the requests against the MongoDB Realm application with a native HTTP client instead of OkHttp.
+         * <p>
+         * The native client keeps connections to the server alive between requests and passes request and response
+         * bodies between the native layer and the network without converting them to Java strings. This reduces the
+         * overhead of requests with large bodies, like calling functions or querying remote collections. HTTP
+         * requests sent by the native client are not logged. Streaming requests, like watching a remote collection,
+         * always use OkHttp.
+         * <p>
+         * The default is {@code false}.
+         *
+         * @param enabled {@code true} to use the native client.
+         */
+        public Builder nativeNetworkTransport(boolean enabled) {
+            this.nativeNetworkTransportEnabled = enabled;
+            return this;
+        }
+
+        /**
+         * Enables the function call cache, which avoids requests for calls of MongoDB Realm functions made with the
+         * same name, arguments and user.
+         * <p>
+         * While such a call is in flight, identical calls do not send a request but complete with its result. If
+         * {@code timeToLive} is positive, successful results are also cached for that long and identical calls made
+         * in the meantime complete with them without a request. Errors are never cached. Cached results are dropped
+         * when the current user of the app changes and are never shared across logins.
+         * <p>
+         * Only enable this if the functions of the app do not have side effects, as identical calls made at the same
+         * time are only executed once by the server.
+         * <p>
+         * The cache is disabled by default.
+         *
+         * @param timeToLive how long results are cached, {@code 0} to only coalesce calls in flight.
+         * @param unit the unit of time used to define the time to live.
+         * @throws IllegalArgumentException if {@code timeToLive} is negative.
+         */
+        public Builder functionCallCache(long timeToLive, TimeUnit unit) {
+            if (timeToLive < 0) {
+                throw new IllegalArgumentException("'timeToLive' must be >= 0. It was: " + timeToLive);
+            }
+            Util.checkNull(unit, "unit");
+            this.functionCallCacheTtlMs = unit.toMillis(timeToLive);
+            return this;
+        }
+
         /**
          * Creates the AppConfiguration.
          *
@@ -651,7 +741,9 @@ public class AppConfiguration {
                     customHeaders,
                     syncRootDir,
                     codecRegistry,
-                    httpLogObfuscator);
+                    httpLogObfuscator,
+                    nativeNetworkTransportEnabled,
+                    functionCallCacheTtlMs);
         }
     }
 }
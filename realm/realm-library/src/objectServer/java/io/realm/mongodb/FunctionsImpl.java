@@ -19,9 +19,15 @@ import org.bson.codecs.Decoder;
 import org.bson.codecs.configuration.CodecRegistry;
 
 import java.util.List;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
 import java.util.concurrent.atomic.AtomicReference;
 
+import javax.annotation.Nullable;
+
 import io.realm.annotations.Beta;
+import io.realm.internal.NativeContext;
+import io.realm.internal.NativeObject;
 import io.realm.internal.Util;
 import io.realm.internal.jni.JniBsonProtocol;
 import io.realm.internal.jni.OsJNIResultCallback;
@@ -36,6 +42,8 @@ import io.realm.mongodb.functions.Functions;
 @Beta
 class FunctionsImpl extends Functions {
 
+    private static final long COMPLETION_MARGIN_MS = 5000;
+
     FunctionsImpl(User user) {
         this(user, user.getApp().getConfiguration().getDefaultCodecRegistry());
     }
@@ -49,22 +57,100 @@ class FunctionsImpl extends Functions {
     public <T> T invoke(String name, List<?> args, CodecRegistry codecRegistry, Decoder<T> resultDecoder) {
         Util.checkEmpty(name, "name");
 
-        String encodedArgs = JniBsonProtocol.encode(args, codecRegistry);
+        byte[] encodedArgs = JniBsonProtocol.encodeBinary(args, codecRegistry);
 
-        // NativePO calling scheme is actually synchronous
-        AtomicReference<String> success = new AtomicReference<>(null);
+        // The call completes on this thread with the Java network transport, otherwise on the thread of the native
+        // transport or of a pending identical call of the function call cache.
+        AtomicReference<byte[]> success = new AtomicReference<>(null);
         AtomicReference<AppException> error = new AtomicReference<>(null);
-        OsJNIResultCallback<String> callback = new OsJNIResultCallback<String>(success, error) {
+        final CountDownLatch completed = new CountDownLatch(1);
+        OsJNIResultCallback<byte[]> callback = new OsJNIResultCallback<byte[]>(success, error) {
+            @Override
+            protected byte[] mapSuccess(Object result) {
+                return (byte[]) result;
+            }
+
             @Override
-            protected String mapSuccess(Object result) {
-                return (String) result;
+            public void onSuccess(Object result) {
+                try {
+                    super.onSuccess(result);
+                } finally {
+                    completed.countDown();
+                }
+            }
+
+            @Override
+            public void onError(String nativeErrorCategory, int nativeErrorCode, String errorMessage) {
+                try {
+                    super.onError(nativeErrorCategory, nativeErrorCode, errorMessage);
+                } finally {
+                    completed.countDown();
+                }
             }
         };
-        nativeCallFunction(user.getApp().osApp.getNativePtr(), user.osUser.getNativePtr(), name, encodedArgs, callback);
-        String encodedResponse = ResultHandler.handleResult(success, error);
+        App app = user.getApp();
+        CallCache cache = app.functionCallCache;
+        nativeCallFunction(app.osApp.getNativePtr(), user.osUser.getNativePtr(),
+                (cache != null) ? cache.getNativePtr() : 0, name, encodedArgs, callback);
+        awaitCompletion(completed, app.getConfiguration().getRequestTimeoutMs());
+        byte[] encodedResponse = ResultHandler.handleResult(success, error);
         return JniBsonProtocol.decode(encodedResponse, resultDecoder);
     }
 
-    private static native void nativeCallFunction(long nativeAppPtr, long nativeUserPtr, String name, String args_json, OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
+    private static void awaitCompletion(CountDownLatch completed, long requestTimeoutMs) {
+        try {
+            // The request is bounded by the request timeout, the margin covers delivering its result.
+            if (!completed.await(requestTimeoutMs + COMPLETION_MARGIN_MS, TimeUnit.MILLISECONDS)) {
+                throw new AppException(ErrorCode.NETWORK_UNKNOWN, "The function call did not complete in time.");
+            }
+        } catch (InterruptedException e) {
+            Thread.currentThread().interrupt();
+            throw new AppException(ErrorCode.NETWORK_INTERRUPTED, e);
+        }
+    }
+
+    /**
+     * Native function call cache of an {@link App}, see {@link AppConfiguration.Builder#functionCallCache(long, TimeUnit)}.
+     */
+    static class CallCache implements NativeObject {
+
+        private static final long nativeFinalizerPtr = nativeGetCacheFinalizerPtr();
+
+        private final long nativePtr;
+
+        CallCache(long timeToLiveMs) {
+            this.nativePtr = nativeCreateCache(timeToLiveMs);
+            NativeContext.dummyContext.addReference(this);
+        }
+
+        @Nullable
+        static CallCache create(AppConfiguration config) {
+            return config.isFunctionCallCacheEnabled()
+                    ? new CallCache(config.getFunctionCallCacheTimeToLive(TimeUnit.MILLISECONDS))
+                    : null;
+        }
+
+        /**
+         * Drops the cached results.
+         */
+        void clear() {
+            nativeClearCache(nativePtr);
+        }
+
+        @Override
+        public long getNativePtr() {
+            return nativePtr;
+        }
+
+        @Override
+        public long getNativeFinalizerPtr() {
+            return nativeFinalizerPtr;
+        }
+    }
+
+    private static native long nativeGetCacheFinalizerPtr();
+    private static native long nativeCreateCache(long timeToLiveMs);
+    private static native void nativeClearCache(long nativeCachePtr);
+    private static native void nativeCallFunction(long nativeAppPtr, long nativeUserPtr, long nativeCachePtr, String name, byte[] args, OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 
 }
@@ -46,6 +46,7 @@ import io.realm.mongodb.mongo.iterable.FindIterable;
 import io.realm.mongodb.mongo.options.CountOptions;
 import io.realm.mongodb.mongo.options.FindOneAndModifyOptions;
 import io.realm.mongodb.mongo.options.FindOptions;
+import io.realm.mongodb.mongo.options.InsertManyOptions;
 import io.realm.mongodb.mongo.options.InsertManyResult;
 import io.realm.mongodb.mongo.options.UpdateOptions;
 import io.realm.mongodb.mongo.result.DeleteResult;
@@ -476,6 +477,26 @@ public class MongoCollection<DocumentT> {
         });
     }
 
+    /**
+     * Inserts one or more documents, split into batches as specified by the options.
+     *
+     * @param documents the documents to insert
+     * @param options   the options controlling the batches and reporting the progress
+     * @return a task containing the result of the insert many operation. If a batch fails, the task fails with an
+     * {@link io.realm.mongodb.mongo.options.InsertManyException} holding the ids of the documents already inserted.
+     * @see InsertManyOptions
+     */
+    public RealmResultTask<InsertManyResult> insertMany(final List<? extends DocumentT> documents,
+                                                        final InsertManyOptions options) {
+        return new RealmResultTaskImpl<>(threadPoolExecutor, new RealmResultTaskImpl.Executor<InsertManyResult>() {
+            @Nullable
+            @Override
+            public InsertManyResult run() {
+                return osMongoCollection.insertMany(documents, options);
+            }
+        });
+    }
+
     /**
      * Removes at most one document from the collection that matches the given filter.  If no
      * documents match, the collection is not
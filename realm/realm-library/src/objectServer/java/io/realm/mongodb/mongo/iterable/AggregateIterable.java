@@ -22,6 +22,8 @@ import org.bson.conversions.Bson;
 import java.util.List;
 import java.util.concurrent.ThreadPoolExecutor;
 
+import javax.annotation.Nullable;
+
 import io.realm.internal.jni.JniBsonProtocol;
 import io.realm.internal.jni.OsJNIResultCallback;
 import io.realm.internal.objectstore.OsJavaNetworkTransport;
@@ -47,11 +49,39 @@ public class AggregateIterable<ResultT> extends MongoIterable<ResultT> {
 
     @Override
     void callNative(final OsJNIResultCallback<?> callback) {
-        String pipelineString = JniBsonProtocol.encode(pipeline, codecRegistry);
-        nativeAggregate(osMongoCollection.getNativePtr(), pipelineString, callback);
+        byte[] encodedPipeline = JniBsonProtocol.encodeBinary(pipeline, codecRegistry);
+        nativeAggregate(osMongoCollection.getNativePtr(), encodedPipeline, callback);
+    }
+
+    @Override
+    void callNativePage(@Nullable final byte[] encodedContinuation, final long pageSize, final OsJNIResultCallback<?> callback) {
+        byte[] encodedPipeline = JniBsonProtocol.encodeBinary(pipeline, codecRegistry);
+        nativeAggregatePage(osMongoCollection.getNativePtr(), encodedPipeline, encodedContinuation, pageSize, callback);
+    }
+
+    /**
+     * Sets the number of documents fetched per request by {@link #iterator()}.
+     * <p>
+     * With a batch size, the output of the pipeline is sorted by {@code _id} and fetched in pages. Each page runs
+     * the pipeline again and continues after the last document of the previous page, so all output documents must
+     * contain a unique {@code _id} of a single type.
+     *
+     * @param batchSize the number of documents per page, or 0 to fetch all documents at once.
+     * @return this
+     * @throws IllegalArgumentException if the batch size is negative.
+     */
+    public AggregateIterable<ResultT> batchSize(int batchSize) {
+        setBatchSize(batchSize);
+        return this;
     }
 
     private static native void nativeAggregate(long remoteMongoCollectionPtr,
-                                               String pipeline,
+                                               byte[] pipeline,
                                                OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
+
+    private static native void nativeAggregatePage(long remoteMongoCollectionPtr,
+                                                   byte[] pipeline,
+                                                   @Nullable byte[] continuation,
+                                                   long pageSize,
+                                                   OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 }
@@ -41,7 +41,7 @@ public class FindIterable<ResultT> extends MongoIterable<ResultT> {
     private static final int FIND_WITH_OPTIONS = 2;
 
     private final FindOptions options;
-    private final String encodedEmptyDocument;
+    private final byte[] encodedEmptyDocument;
 
     private Bson filter;
 
@@ -52,25 +52,39 @@ public class FindIterable<ResultT> extends MongoIterable<ResultT> {
         super(threadPoolExecutor, osMongoCollection, codecRegistry, resultClass);
         this.options = new FindOptions();
         this.filter = new Document();
-        this.encodedEmptyDocument = JniBsonProtocol.encode(new Document(), codecRegistry);
+        this.encodedEmptyDocument = JniBsonProtocol.encodeBinary(new Document(), codecRegistry);
     }
 
     @Override
     void callNative(final OsJNIResultCallback<?> callback) {
-        String filterString = JniBsonProtocol.encode(filter, codecRegistry);
-        String projectionString = encodedEmptyDocument;
-        String sortString = encodedEmptyDocument;
+        byte[] encodedFilter = JniBsonProtocol.encodeBinary(filter, codecRegistry);
+        byte[] encodedProjection = encodedEmptyDocument;
+        byte[] encodedSort = encodedEmptyDocument;
 
         if (options == null) {
-            nativeFind(FIND, osMongoCollection.getNativePtr(), filterString, projectionString, sortString, 0, callback);
+            nativeFind(FIND, osMongoCollection.getNativePtr(), encodedFilter, encodedProjection, encodedSort, 0, callback);
         } else {
-            projectionString = JniBsonProtocol.encode(options.getProjection(), codecRegistry);
-            sortString = JniBsonProtocol.encode(options.getSort(), codecRegistry);
+            encodedProjection = JniBsonProtocol.encodeBinary(options.getProjection(), codecRegistry);
+            encodedSort = JniBsonProtocol.encodeBinary(options.getSort(), codecRegistry);
 
-            nativeFind(FIND_WITH_OPTIONS, osMongoCollection.getNativePtr(), filterString, projectionString, sortString, options.getLimit(), callback);
+            nativeFind(FIND_WITH_OPTIONS, osMongoCollection.getNativePtr(), encodedFilter, encodedProjection, encodedSort, options.getLimit(), callback);
         }
     }
 
+    @Override
+    void callNativePage(@Nullable final byte[] encodedContinuation, final long pageSize, final OsJNIResultCallback<?> callback) {
+        byte[] encodedFilter = JniBsonProtocol.encodeBinary(filter, codecRegistry);
+        byte[] encodedProjection = JniBsonProtocol.encodeBinary(options.getProjection(), codecRegistry);
+        byte[] encodedSort = JniBsonProtocol.encodeBinary(options.getSort(), codecRegistry);
+
+        nativeFindPage(osMongoCollection.getNativePtr(), encodedFilter, encodedProjection, encodedSort, encodedContinuation, pageSize, callback);
+    }
+
+    @Override
+    long getLimit() {
+        return options.getLimit();
+    }
+
     /**
      * Sets the query filter to apply to the query.
      *
@@ -115,11 +129,36 @@ public class FindIterable<ResultT> extends MongoIterable<ResultT> {
         return this;
     }
 
+    /**
+     * Sets the number of documents fetched per request by {@link #iterator()}.
+     * <p>
+     * With a batch size, the documents are fetched in pages ordered by the sort criteria followed by {@code _id}.
+     * Each page continues after the last document of the previous page instead of skipping documents, so the
+     * server can use the indexes of the sort fields. All documents must contain the sort fields, so the projection
+     * must not exclude them, and each sort field must only hold values of a single type.
+     *
+     * @param batchSize the number of documents per page, or 0 to fetch all documents at once.
+     * @return this
+     * @throws IllegalArgumentException if the batch size is negative.
+     */
+    public FindIterable<ResultT> batchSize(int batchSize) {
+        setBatchSize(batchSize);
+        return this;
+    }
+
     private static native void nativeFind(int findType,
                                           long remoteMongoCollectionPtr,
-                                          String filter,
-                                          String projection,
-                                          String sort,
+                                          byte[] filter,
+                                          byte[] projection,
+                                          byte[] sort,
                                           long limit,
                                           OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
+
+    private static native void nativeFindPage(long remoteMongoCollectionPtr,
+                                              byte[] filter,
+                                              byte[] projection,
+                                              byte[] sort,
+                                              @Nullable byte[] continuation,
+                                              long pageSize,
+                                              OsJavaNetworkTransport.NetworkTransportJNIResultCallback callback);
 }
@@ -17,6 +17,7 @@
 package io.realm.mongodb.mongo.iterable;
 
 import java.io.Closeable;
+import java.io.IOException;
 import java.util.Iterator;
 
 /**
@@ -60,6 +61,12 @@ public class MongoCursor<ResultT> implements Iterator<ResultT>, Closeable {
 
     @Override
     public void close() {
-
+        // Paged cursors stop fetching the next page.
+        if (iterator instanceof Closeable) {
+            try {
+                ((Closeable) iterator).close();
+            } catch (IOException ignored) {
+            }
+        }
     }
 }
@@ -16,11 +16,24 @@
 
 package io.realm.mongodb.mongo.iterable;
 
+import org.bson.BsonArray;
+import org.bson.BsonDocumentReader;
+import org.bson.BsonValue;
+import org.bson.codecs.BsonArrayCodec;
+import org.bson.codecs.BsonDocumentCodec;
+import org.bson.codecs.Codec;
+import org.bson.codecs.DecoderContext;
 import org.bson.codecs.configuration.CodecRegistry;
 
+import java.io.Closeable;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Iterator;
+import java.util.List;
+import java.util.NoSuchElementException;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.Future;
 import java.util.concurrent.ThreadPoolExecutor;
 import java.util.concurrent.atomic.AtomicReference;
 
@@ -32,6 +45,7 @@ import io.realm.internal.jni.OsJNIResultCallback;
 import io.realm.internal.network.ResultHandler;
 import io.realm.internal.objectstore.OsMongoCollection;
 import io.realm.mongodb.AppException;
+import io.realm.mongodb.ErrorCode;
 import io.realm.mongodb.RealmResultTask;
 
 /**
@@ -51,6 +65,8 @@ public abstract class MongoIterable<ResultT> {
     private final Class<ResultT> resultClass;
     private final ThreadPoolExecutor threadPoolExecutor;
 
+    private int batchSize = 0;
+
     MongoIterable(final ThreadPoolExecutor threadPoolExecutor,
                   final OsMongoCollection<?> osMongoCollection,
                   final CodecRegistry codecRegistry,
@@ -63,11 +79,31 @@ public abstract class MongoIterable<ResultT> {
 
     abstract void callNative(OsJNIResultCallback<?> callback);
 
+    // Fetches at most pageSize documents following the documents of the previous page, described by the
+    // continuation returned with it. The continuation is null for the first page.
+    abstract void callNativePage(@Nullable byte[] encodedContinuation, long pageSize, OsJNIResultCallback<?> callback);
+
+    // Maximum number of documents returned in total, 0 if unlimited.
+    long getLimit() {
+        return 0;
+    }
+
+    void setBatchSize(int batchSize) {
+        if (batchSize < 0) {
+            throw new IllegalArgumentException("Batch size must not be negative: " + batchSize);
+        }
+        this.batchSize = batchSize;
+    }
+
     /**
      * Returns a cursor of the operation represented by this iterable.
      * <p>
      * The result is wrapped in a {@code Task} since the iterator should be capable of
      * asynchronously retrieve documents from the server.
+     * <p>
+     * If a batch size has been set, the results are fetched in pages of that size: the task completes as soon as the
+     * first page has been received and the next page is fetched in the background while the current one is
+     * consumed. Otherwise all results are fetched before the task completes.
      *
      * @return an asynchronous task with cursor of the operation represented by this iterable.
      */
@@ -76,6 +112,9 @@ public abstract class MongoIterable<ResultT> {
             @Nullable
             @Override
             public MongoCursor<ResultT> run() {
+                if (batchSize > 0) {
+                    return new MongoCursor<>(new PagedIterator());
+                }
                 return new MongoCursor<>(MongoIterable.this.getCollection().iterator());
             }
         });
@@ -128,12 +167,138 @@ public abstract class MongoIterable<ResultT> {
     }
 
     private Collection<ResultT> mapCollection(Object result) {
-        Collection<?> collection = JniBsonProtocol.decode((String) result, Collection.class, codecRegistry);
+        Collection<?> collection = JniBsonProtocol.decode((byte[]) result, Collection.class, codecRegistry);
         Collection<ResultT> decodedCollection = new ArrayList<>();
         for (Object collectionElement : collection) {
-            String encodedElement = JniBsonProtocol.encode(collectionElement, codecRegistry);
+            byte[] encodedElement = JniBsonProtocol.encodeBinary(collectionElement, codecRegistry);
             decodedCollection.add(JniBsonProtocol.decode(encodedElement, resultClass, codecRegistry));
         }
         return decodedCollection;
     }
+
+    private Page fetchPage(@Nullable byte[] encodedContinuation, long pageSize) {
+        AtomicReference<Page> success = new AtomicReference<>(null);
+        AtomicReference<AppException> error = new AtomicReference<>(null);
+        OsJNIResultCallback<Page> callback = new OsJNIResultCallback<Page>(success, error) {
+            @Override
+            protected Page mapSuccess(Object result) {
+                return mapPage(result);
+            }
+        };
+
+        callNativePage(encodedContinuation, pageSize, callback);
+
+        return ResultHandler.handleResult(success, error);
+    }
+
+    // A page is passed as [documents, continuation], the continuation is null after the last page and an error
+    // message if the next page cannot be queried.
+    private Page mapPage(Object result) {
+        BsonArray page = JniBsonProtocol.decode((byte[]) result, new BsonArrayCodec());
+        BsonValue continuation = page.get(1);
+        if (continuation.isString()) {
+            throw new AppException(ErrorCode.BSON_DECODING, continuation.asString().getValue());
+        }
+        Codec<ResultT> codec = JniBsonProtocol.getCodec(resultClass, codecRegistry);
+        List<ResultT> documents = new ArrayList<>();
+        try {
+            for (BsonValue document : page.get(0).asArray()) {
+                documents.add(codec.decode(new BsonDocumentReader(document.asDocument()), DecoderContext.builder().build()));
+            }
+        } catch (Exception e) {
+            throw new AppException(ErrorCode.BSON_DECODING, "Error decoding page of " + resultClass.getSimpleName(), e);
+        }
+        byte[] encodedContinuation = continuation.isDocument()
+                ? JniBsonProtocol.encodeBinary(continuation.asDocument(), new BsonDocumentCodec())
+                : null;
+        return new Page(documents, encodedContinuation);
+    }
+
+    private class Page {
+        private final List<ResultT> documents;
+        @Nullable
+        private final byte[] encodedContinuation;
+
+        Page(List<ResultT> documents, @Nullable byte[] encodedContinuation) {
+            this.documents = documents;
+            this.encodedContinuation = encodedContinuation;
+        }
+    }
+
+    // Iterates the results page by page. At most two pages are held in memory: the one being iterated and the next
+    // one, which is fetched while the current one is consumed. The cursor is often consumed on the network pool of
+    // the app, so the next page is not fetched on it.
+    private class PagedIterator implements Iterator<ResultT>, Closeable {
+        private Iterator<ResultT> documents;
+        @Nullable
+        private Future<Page> nextPage;
+        private long remaining;
+
+        PagedIterator() {
+            long limit = getLimit();
+            remaining = (limit > 0) ? limit : Long.MAX_VALUE;
+            accept(fetchPage(null, nextPageSize()));
+        }
+
+        private long nextPageSize() {
+            return Math.min(batchSize, remaining);
+        }
+
+        private void accept(Page page) {
+            documents = page.documents.iterator();
+            remaining -= page.documents.size();
+            nextPage = null;
+            final byte[] encodedContinuation = page.encodedContinuation;
+            if (encodedContinuation != null && remaining > 0) {
+                final long pageSize = nextPageSize();
+                nextPage = OsMongoCollection.CONCURRENT_REQUEST_EXECUTOR.submit(new Callable<Page>() {
+                    @Override
+                    public Page call() {
+                        return fetchPage(encodedContinuation, pageSize);
+                    }
+                });
+            }
+        }
+
+        @Override
+        public boolean hasNext() {
+            while (!documents.hasNext()) {
+                if (nextPage == null) {
+                    return false;
+                }
+                accept(awaitNextPage());
+            }
+            return true;
+        }
+
+        private Page awaitNextPage() {
+            try {
+                //noinspection ConstantConditions
+                return nextPage.get();
+            } catch (InterruptedException e) {
+                throw new AppException(ErrorCode.NETWORK_INTERRUPTED, e);
+            } catch (ExecutionException e) {
+                if (e.getCause() instanceof AppException) {
+                    throw (AppException) e.getCause();
+                }
+                throw new AppException(ErrorCode.UNKNOWN, e.getCause());
+            }
+        }
+
+        @Override
+        public ResultT next() {
+            if (!hasNext()) {
+                throw new NoSuchElementException();
+            }
+            return documents.next();
+        }
+
+        @Override
+        public void close() {
+            if (nextPage != null) {
+                nextPage.cancel(false);
+                nextPage = null;
+            }
+        }
+    }
 }
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm.mongodb.mongo.options;
+
+import io.realm.annotations.Beta;
+import io.realm.mongodb.AppException;
+
+/**
+ * Thrown when some of the batches of an insert many operation failed. The documents of the batches which succeeded
+ * stay inserted, {@link #getPartialResult()} returns their ids.
+ * <p>
+ * The error code, type and message are those of the error which stopped the operation, which is also the cause of
+ * this exception.
+ *
+ * @see InsertManyOptions
+ */
+@Beta
+public class InsertManyException extends AppException {
+
+    private final InsertManyResult partialResult;
+
+    /**
+     * Creates an exception for an insert many operation which was stopped by an error.
+     *
+     * @param error the error which stopped the operation.
+     * @param partialResult the ids of the documents inserted before the operation stopped.
+     */
+    public InsertManyException(AppException error, InsertManyResult partialResult) {
+        super(error.getErrorCode(), error.getErrorType(), error.getErrorIntValue(), error.getErrorMessage(),
+                error.getException());
+        initCause(error);
+        this.partialResult = partialResult;
+    }
+
+    /**
+     * Returns the ids of the documents inserted before the operation stopped, arranged by the index of the document
+     * from the operation. Empty if no document was inserted.
+     *
+     * @return the result of the batches which succeeded.
+     */
+    public InsertManyResult getPartialResult() {
+        return partialResult;
+    }
+}
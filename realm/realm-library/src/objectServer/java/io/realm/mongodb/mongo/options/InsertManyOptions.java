@@ -0,0 +1,157 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm.mongodb.mongo.options;
+
+import javax.annotation.Nullable;
+
+import io.realm.annotations.Beta;
+
+/**
+ * The options to apply when inserting many documents.
+ * <p>
+ * Large lists of documents are split into batches which are inserted with separate requests, one after another unless
+ * more requests in flight are allowed. If a batch fails, no further batches are sent and the error is reported once
+ * the requests in flight have completed. Documents of batches which succeeded stay inserted, their ids are available
+ * from the {@link InsertManyException} reporting the error.
+ */
+@Beta
+public class InsertManyOptions {
+
+    /**
+     * Reports the progress of an insert many operation.
+     */
+    public interface ProgressListener {
+        /**
+         * Called every time a batch of documents has been inserted. Calls never overlap, but they can be made from
+         * different threads.
+         *
+         * @param insertedDocuments the number of documents inserted so far.
+         * @param totalDocuments the number of documents to insert.
+         */
+        void onProgress(long insertedDocuments, long totalDocuments);
+    }
+
+    private int maxBatchSize = 1000;
+    private int maxBatchBytes = 8 * 1024 * 1024;
+    private int maxRequestsInFlight = 1;
+    @Nullable
+    private ProgressListener progressListener;
+
+    /**
+     * Returns the maximum number of documents inserted by a single request. The default is 1000.
+     *
+     * @return the maximum number of documents per request.
+     */
+    public int getMaxBatchSize() {
+        return maxBatchSize;
+    }
+
+    /**
+     * Sets the maximum number of documents inserted by a single request.
+     *
+     * @param maxBatchSize the maximum number of documents per request.
+     * @return this
+     * @throws IllegalArgumentException if the size isn't positive.
+     */
+    public InsertManyOptions maxBatchSize(final int maxBatchSize) {
+        if (maxBatchSize < 1) {
+            throw new IllegalArgumentException("The batch size must be positive: " + maxBatchSize);
+        }
+        this.maxBatchSize = maxBatchSize;
+        return this;
+    }
+
+    /**
+     * Returns the maximum size in bytes of the BSON encoded documents of a single request. A document larger than this
+     * is sent on its own. The default is 8 MB.
+     *
+     * @return the maximum number of bytes per request.
+     */
+    public int getMaxBatchBytes() {
+        return maxBatchBytes;
+    }
+
+    /**
+     * Sets the maximum size in bytes of the BSON encoded documents of a single request.
+     *
+     * @param maxBatchBytes the maximum number of bytes per request.
+     * @return this
+     * @throws IllegalArgumentException if the size isn't positive.
+     */
+    public InsertManyOptions maxBatchBytes(final int maxBatchBytes) {
+        if (maxBatchBytes < 1) {
+            throw new IllegalArgumentException("The batch size in bytes must be positive: " + maxBatchBytes);
+        }
+        this.maxBatchBytes = maxBatchBytes;
+        return this;
+    }
+
+    /**
+     * Returns the maximum number of requests sent at the same time. The default is 1.
+     *
+     * @return the maximum number of requests in flight.
+     */
+    public int getMaxRequestsInFlight() {
+        return maxRequestsInFlight;
+    }
+
+    /**
+     * Sets the maximum number of requests sent at the same time. With more than 1, batches are inserted
+     * concurrently and their order is no longer that of the documents.
+     *
+     * @param maxRequestsInFlight the maximum number of requests in flight.
+     * @return this
+     * @throws IllegalArgumentException if the number isn't positive.
+     */
+    public InsertManyOptions maxRequestsInFlight(final int maxRequestsInFlight) {
+        if (maxRequestsInFlight < 1) {
+            throw new IllegalArgumentException("The number of requests in flight must be positive: " + maxRequestsInFlight);
+        }
+        this.maxRequestsInFlight = maxRequestsInFlight;
+        return this;
+    }
+
+    /**
+     * Returns the listener notified when batches have been inserted, or {@code null} if none is set.
+     *
+     * @return the progress listener.
+     */
+    @Nullable
+    public ProgressListener getProgressListener() {
+        return progressListener;
+    }
+
+    /**
+     * Sets a listener notified every time a batch of documents has been inserted.
+     *
+     * @param progressListener the listener, or {@code null} to remove it.
+     * @return this
+     */
+    public InsertManyOptions progressListener(@Nullable final ProgressListener progressListener) {
+        this.progressListener = progressListener;
+        return this;
+    }
+
+    @Override
+    public String toString() {
+        return "InsertManyOptions{"
+                + "maxBatchSize=" + maxBatchSize
+                + ", maxBatchBytes=" + maxBatchBytes
+                + ", maxRequestsInFlight=" + maxRequestsInFlight
+                + '}';
+    }
+}
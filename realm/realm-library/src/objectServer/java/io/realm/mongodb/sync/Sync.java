@@ -181,6 +181,10 @@ public abstract class Sync {
             // So instead we manually create the underlying native session.
             OsRealmConfig config = new OsRealmConfig.Builder(syncConfiguration).build();
             nativeCreateSession(config.getNativePtr());
+            session.startMetrics();
+        } else {
+            // Object Store replaces the native session when the Realm is opened after its session was stopped.
+            session.startMetrics();
         }
 
         return session;
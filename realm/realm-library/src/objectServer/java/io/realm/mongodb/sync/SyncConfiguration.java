@@ -106,6 +106,7 @@ public class SyncConfiguration extends RealmConfiguration {
     private final boolean deleteRealmOnLogout;
     private final boolean waitForInitialData;
     private final long initialDataTimeoutMillis;
+    @Nullable private final ProgressListener initialDataProgressListener;
     private final OsRealmConfig.SyncSessionStopPolicy sessionStopPolicy;
     @Nullable private final String syncUrlPrefix;
     private final ClientResyncMode clientResyncMode;
@@ -133,6 +134,7 @@ public class SyncConfiguration extends RealmConfiguration {
                               boolean deleteRealmOnLogout,
                               boolean waitForInitialData,
                               long initialDataTimeoutMillis,
+                              @Nullable ProgressListener initialDataProgressListener,
                               OsRealmConfig.SyncSessionStopPolicy sessionStopPolicy,
                               CompactOnLaunchCallback compactOnLaunch,
                               @Nullable String syncUrlPrefix,
@@ -164,6 +166,7 @@ public class SyncConfiguration extends RealmConfiguration {
         this.deleteRealmOnLogout = deleteRealmOnLogout;
         this.waitForInitialData = waitForInitialData;
         this.initialDataTimeoutMillis = initialDataTimeoutMillis;
+        this.initialDataProgressListener = initialDataProgressListener;
         this.sessionStopPolicy = sessionStopPolicy;
         this.syncUrlPrefix = syncUrlPrefix;
         this.clientResyncMode = clientResyncMode;
@@ -411,6 +414,19 @@ public class SyncConfiguration extends RealmConfiguration {
         return unit.convert(initialDataTimeoutMillis, TimeUnit.MILLISECONDS);
     }
 
+    /**
+     * Returns the listener notified about the download progress while the initial remote data is downloaded.
+     * <p>
+     * This value is only applicable if {@link #shouldWaitForInitialRemoteData()} returns {@code true}.
+     *
+     * @return the progress listener or {@code null} if none was set.
+     * @see SyncConfiguration.Builder#initialRemoteDataProgressListener(ProgressListener)
+     */
+    @Nullable
+    public ProgressListener getInitialRemoteDataProgressListener() {
+        return initialDataProgressListener;
+    }
+
     @Override
     protected boolean isSyncConfiguration() {
         return true;
@@ -481,6 +497,8 @@ public class SyncConfiguration extends RealmConfiguration {
         private boolean readOnly = false;
         private boolean waitForServerChanges = false;
         private long initialDataTimeoutMillis = Long.MAX_VALUE;
+        @Nullable
+        private ProgressListener initialDataProgressListener = null;
         // sync specific
         private boolean deleteRealmOnLogout = false;
         private URI serverUrl;
@@ -914,6 +932,24 @@ public class SyncConfiguration extends RealmConfiguration {
             return this;
         }
 
+        /**
+         * Sets a listener notified about the download progress while the initial remote data is downloaded, see
+         * {@link #waitForInitialRemoteData()}. The listener behaves like one added with
+         * {@link ProgressMode#CURRENT_CHANGES}: {@link Progress#getTransferableBytes()} is the estimate of the server
+         * of the bytes to download, so it can be used to report how much of the initial download is left.
+         * <p>
+         * The listener is called on a background thread. It is not called if the Realm file already exists, or if
+         * {@link #waitForInitialRemoteData()} is not enabled.
+         *
+         * @param listener the listener notified about the progress of the initial download.
+         * @throws IllegalArgumentException if {@code null} is given as a listener.
+         */
+        public Builder initialRemoteDataProgressListener(ProgressListener listener) {
+            Util.checkNull(listener, "listener");
+            this.initialDataProgressListener = listener;
+            return this;
+        }
+
         /**
          * Setting this will cause the Realm to become read only and all write transactions made against this Realm will
          * fail with an {@link IllegalStateException}.
@@ -1139,6 +1175,7 @@ public class SyncConfiguration extends RealmConfiguration {
                     deleteRealmOnLogout,
                     waitForServerChanges,
                     initialDataTimeoutMillis,
+                    initialDataProgressListener,
                     sessionStopPolicy,
                     compactOnLaunch,
                     syncUrlPrefix,
@@ -29,12 +29,16 @@ import java.util.concurrent.atomic.AtomicInteger;
 import java.util.concurrent.atomic.AtomicLong;
 import java.util.concurrent.atomic.AtomicReference;
 
+import javax.annotation.Nullable;
+
 import io.realm.annotations.Beta;
 import io.realm.mongodb.ErrorCode;
 import io.realm.mongodb.AppException;
 import io.realm.Realm;
 import io.realm.RealmConfiguration;
 import io.realm.internal.Keep;
+import io.realm.internal.NativeContext;
+import io.realm.internal.NativeObject;
 import io.realm.internal.Util;
 import io.realm.internal.util.Pair;
 import io.realm.log.RealmLog;
@@ -108,6 +112,13 @@ public class SyncSession {
     static final byte CONNECTION_VALUE_CONNECTING = 1;
     static final byte CONNECTION_VALUE_CONNECTED = 2;
 
+    // Checked by JNI against the values recorded natively
+    static final int METRICS_VALUE_COUNT = SyncSessionMetrics.VALUE_COUNT;
+
+    // Native counters of the session, null until the native session has been created
+    @Nullable
+    private volatile MetricsRecorder metricsRecorder;
+
     /**
      * Enum describing the states a SyncSession can be in. The initial state is
      * {@link State#INACTIVE}.
@@ -310,7 +321,30 @@ public class SyncSession {
      * @param listener the listener to register.
      */
     public synchronized void addDownloadProgressListener(ProgressMode mode, ProgressListener listener) {
-        addProgressListener(mode, DIRECTION_DOWNLOAD, listener);
+        addProgressListener(mode, DIRECTION_DOWNLOAD, 0, 0, listener);
+    }
+
+    /**
+     * Adds a progress listener tracking changes that need to be downloaded from the Realm Object
+     * Server, which is notified at most once per {@code minInterval} and only after at least
+     * {@code minTransferredBytes} have been transferred since the last notification.
+     * <p>
+     * Progress events are coalesced by the native Sync Client before they reach the JVM, which
+     * keeps large downloads from being slowed down by thousands of notifications per second. The
+     * first event and the events completing a transfer are always reported, the events dropped in
+     * between are covered by the next notification.
+     *
+     * @param mode type of mode used. See {@link ProgressMode} for more information.
+     * @param minInterval minimum time between two notifications, {@code 0} to not limit it.
+     * @param unit unit of {@code minInterval}.
+     * @param minTransferredBytes minimum number of bytes transferred between two notifications,
+     * {@code 0} to not limit it.
+     * @param listener the listener to register.
+     * @throws IllegalArgumentException if a limit is negative.
+     */
+    public synchronized void addDownloadProgressListener(ProgressMode mode, long minInterval, TimeUnit unit,
+                                                         long minTransferredBytes, ProgressListener listener) {
+        addProgressListener(mode, DIRECTION_DOWNLOAD, toThrottleIntervalMillis(minInterval, unit), minTransferredBytes, listener);
     }
 
     /**
@@ -324,7 +358,28 @@ public class SyncSession {
      * @param listener the listener to register.
      */
     public synchronized void addUploadProgressListener(ProgressMode mode, ProgressListener listener) {
-        addProgressListener(mode, DIRECTION_UPLOAD, listener);
+        addProgressListener(mode, DIRECTION_UPLOAD, 0, 0, listener);
+    }
+
+    /**
+     * Adds a progress listener tracking changes that need to be uploaded from the device to the
+     * Realm Object Server, which is notified at most once per {@code minInterval} and only after
+     * at least {@code minTransferredBytes} have been transferred since the last notification.
+     * <p>
+     * Events are coalesced like for
+     * {@link #addDownloadProgressListener(ProgressMode, long, TimeUnit, long, ProgressListener)}.
+     *
+     * @param mode type of mode used. See {@link ProgressMode} for more information.
+     * @param minInterval minimum time between two notifications, {@code 0} to not limit it.
+     * @param unit unit of {@code minInterval}.
+     * @param minTransferredBytes minimum number of bytes transferred between two notifications,
+     * {@code 0} to not limit it.
+     * @param listener the listener to register.
+     * @throws IllegalArgumentException if a limit is negative.
+     */
+    public synchronized void addUploadProgressListener(ProgressMode mode, long minInterval, TimeUnit unit,
+                                                       long minTransferredBytes, ProgressListener listener) {
+        addProgressListener(mode, DIRECTION_UPLOAD, toThrottleIntervalMillis(minInterval, unit), minTransferredBytes, listener);
     }
 
     /**
@@ -353,15 +408,28 @@ public class SyncSession {
         }
     }
 
-    private void addProgressListener(ProgressMode mode, int direction, ProgressListener listener) {
+    private static long toThrottleIntervalMillis(long minInterval, TimeUnit unit) {
+        Util.checkNull(unit, "unit");
+        if (minInterval < 0) {
+            throw new IllegalArgumentException("'minInterval' must be >= 0. It was: " + minInterval);
+        }
+        return unit.toMillis(minInterval);
+    }
+
+    private void addProgressListener(ProgressMode mode, int direction, long minIntervalMs, long minTransferredBytes,
+                                     ProgressListener listener) {
         checkProgressListenerArguments(mode, listener);
+        if (minTransferredBytes < 0) {
+            throw new IllegalArgumentException("'minTransferredBytes' must be >= 0. It was: " + minTransferredBytes);
+        }
         boolean isStreaming = (mode == ProgressMode.INDEFINITELY);
         long listenerId = progressListenerId.incrementAndGet();
 
         // A listener might be triggered immediately as part of `nativeAddProgressListener`, so
         // we need to make sure it can be found by SyncManager.notifyProgressListener()
         listenerIdToProgressListenerMap.put(listenerId, new Pair<ProgressListener, Progress>(listener, null));
-        long listenerToken = nativeAddProgressListener(appNativePointer, configuration.getPath(), listenerId , direction, isStreaming);
+        long listenerToken = nativeAddProgressListener(appNativePointer, configuration.getPath(), listenerId , direction, isStreaming,
+                minIntervalMs, minTransferredBytes);
         if (listenerToken == 0) {
             // ObjectStore did not register the listener. This can happen if a
             // listener is registered with ProgressMode.CURRENT_CHANGES and no changes actually
@@ -639,6 +707,74 @@ public class SyncSession {
         }
     }
 
+    /**
+     * Returns a snapshot of the traffic and connection counters of this session.
+     * <p>
+     * The counters are recorded natively from the moment the session is created or since the last call to
+     * {@link #resetMetrics()}. Closing the last instance of the Realm ends the session, opening it again starts a new
+     * session with its own counters. If the session has not been created yet, all counters are {@code 0}.
+     *
+     * @return the current values of the counters.
+     * @see SyncSessionMetrics
+     */
+    public SyncSessionMetrics getMetrics() {
+        MetricsRecorder recorder = metricsRecorder;
+        if (recorder == null) {
+            // The native session may not have existed when this session was created.
+            startMetrics();
+            recorder = metricsRecorder;
+        }
+        if (recorder == null) {
+            return new SyncSessionMetrics(new long[METRICS_VALUE_COUNT]);
+        }
+        return new SyncSessionMetrics(nativeGetMetrics(appNativePointer, configuration.getPath(), recorder.nativePtr));
+    }
+
+    /**
+     * Sets all counters returned by {@link #getMetrics()} to {@code 0}.
+     */
+    public void resetMetrics() {
+        MetricsRecorder recorder = metricsRecorder;
+        if (recorder != null) {
+            nativeResetMetrics(appNativePointer, configuration.getPath(), recorder.nativePtr);
+        }
+    }
+
+    // Starts recording the metrics, or moves them to the current native session if Object Store replaced it. Called
+    // when this session is created and every time the Realm is opened, which creates the native session if needed.
+    synchronized void startMetrics() {
+        if (metricsRecorder == null) {
+            long nativePtr = nativeCreateMetrics(appNativePointer, configuration.getPath());
+            if (nativePtr != 0) {
+                metricsRecorder = new MetricsRecorder(nativePtr);
+            }
+        } else {
+            nativeAttachMetrics(appNativePointer, configuration.getPath(), metricsRecorder.nativePtr);
+        }
+    }
+
+    // Releases the native listeners recording the metrics when garbage collected.
+    private static class MetricsRecorder implements NativeObject {
+        private static final long nativeFinalizerPtr = nativeGetMetricsFinalizerPtr();
+
+        private final long nativePtr;
+
+        MetricsRecorder(long nativePtr) {
+            this.nativePtr = nativePtr;
+            NativeContext.dummyContext.addReference(this);
+        }
+
+        @Override
+        public long getNativePtr() {
+            return nativePtr;
+        }
+
+        @Override
+        public long getNativeFinalizerPtr() {
+            return nativeFinalizerPtr;
+        }
+    }
+
     void shutdownAndWait() {
         nativeShutdownAndWait(appNativePointer, configuration.getPath());
     }
@@ -772,7 +908,8 @@ public class SyncSession {
 
     private native long nativeAddConnectionListener(long appNativePointer, String localRealmPath);
     private static native void nativeRemoveConnectionListener(long appNativePointer, long listenerId, String localRealmPath);
-    private native long nativeAddProgressListener(long appNativePointer, String localRealmPath, long listenerId, int direction, boolean isStreaming);
+    private native long nativeAddProgressListener(long appNativePointer, String localRealmPath, long listenerId, int direction, boolean isStreaming,
+                                                  long minIntervalMs, long minTransferredBytes);
     private static native void nativeRemoveProgressListener(long appNativePointer, String localRealmPath, long listenerToken);
     private native boolean nativeWaitForDownloadCompletion(long appNativePointer, int callbackId, String localRealmPath);
     private native boolean nativeWaitForUploadCompletion(long appNativePointer, int callbackId, String localRealmPath);
@@ -781,4 +918,10 @@ public class SyncSession {
     private static native void nativeStart(long appNativePointer, String localRealmPath);
     private static native void nativeStop(long appNativePointer, String localRealmPath);
     private static native void nativeShutdownAndWait(long appNativePointer, String localRealmPath);
+    private static native long nativeGetMetricsFinalizerPtr();
+    private static native long nativeCreateMetrics(long appNativePointer, String localRealmPath);
+    private static native void nativeAttachMetrics(long appNativePointer, String localRealmPath, long metricsNativePtr);
+    // Both attach the metrics to the current native session of the Realm first.
+    private static native long[] nativeGetMetrics(long appNativePointer, String localRealmPath, long metricsNativePtr);
+    private static native void nativeResetMetrics(long appNativePointer, String localRealmPath, long metricsNativePtr);
 }
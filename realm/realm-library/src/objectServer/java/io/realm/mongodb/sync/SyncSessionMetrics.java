@@ -0,0 +1,144 @@
+/*
+ * Copyright 2020 Realm Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package io.realm.mongodb.sync;
+
+import java.util.Locale;
+
+import io.realm.annotations.Beta;
+
+/**
+ * Immutable snapshot of the counters of a {@link SyncSession}, as returned by {@link SyncSession#getMetrics()}.
+ * <p>
+ * The counters are recorded by the native Sync Client from the moment the session is created or since the last
+ * call to {@link SyncSession#resetMetrics()}. They are derived from the progress and connection notifications of
+ * the session:
+ * <ul>
+ * <li>A download batch is a set of changesets received from the server and integrated into the Realm.</li>
+ * <li>An upload batch is an acknowledgement by the server that it received a set of uploaded changesets.</li>
+ * <li>The upload latency is the time from local changes becoming ready for upload until the server has
+ * acknowledged all of them.</li>
+ * <li>A reconnect is every connection established by the session after the first one.</li>
+ * </ul>
+ */
+@Beta
+public class SyncSessionMetrics {
+
+    // Order of the values returned by native code, must match SyncSessionMetrics::Value
+    private static final int BYTES_UPLOADED = 0;
+    private static final int BYTES_DOWNLOADED = 1;
+    private static final int UPLOAD_BATCHES = 2;
+    private static final int DOWNLOAD_BATCHES = 3;
+    private static final int UPLOAD_LATENCY_COUNT = 4;
+    private static final int UPLOAD_LATENCY_TOTAL_MS = 5;
+    private static final int UPLOAD_LATENCY_MAX_MS = 6;
+    private static final int RECONNECTS = 7;
+    private static final int DISCONNECTED_MS = 8;
+    private static final int CONNECTING_MS = 9;
+    private static final int CONNECTED_MS = 10;
+    static final int VALUE_COUNT = 11;
+
+    private final long[] values;
+
+    SyncSessionMetrics(long[] values) {
+        this.values = values;
+    }
+
+    /**
+     * Returns the number of bytes of changesets uploaded to the server.
+     */
+    public long getBytesUploaded() {
+        return values[BYTES_UPLOADED];
+    }
+
+    /**
+     * Returns the number of bytes of changesets downloaded from the server.
+     */
+    public long getBytesDownloaded() {
+        return values[BYTES_DOWNLOADED];
+    }
+
+    /**
+     * Returns the number of upload batches acknowledged by the server.
+     */
+    public long getUploadBatches() {
+        return values[UPLOAD_BATCHES];
+    }
+
+    /**
+     * Returns the number of download batches integrated into the Realm.
+     */
+    public long getDownloadBatches() {
+        return values[DOWNLOAD_BATCHES];
+    }
+
+    /**
+     * Returns the number of times all local changes were uploaded and acknowledged, i.e. the number of upload
+     * latencies measured.
+     */
+    public long getUploadRoundTrips() {
+        return values[UPLOAD_LATENCY_COUNT];
+    }
+
+    /**
+     * Returns the average upload latency in milliseconds, or {@code 0} if no upload has completed.
+     */
+    public long getAverageUploadLatencyMs() {
+        long count = values[UPLOAD_LATENCY_COUNT];
+        return (count == 0) ? 0 : values[UPLOAD_LATENCY_TOTAL_MS] / count;
+    }
+
+    /**
+     * Returns the longest upload latency in milliseconds.
+     */
+    public long getMaxUploadLatencyMs() {
+        return values[UPLOAD_LATENCY_MAX_MS];
+    }
+
+    /**
+     * Returns the number of connections established after the first one.
+     */
+    public long getReconnects() {
+        return values[RECONNECTS];
+    }
+
+    /**
+     * Returns the time in milliseconds the session spent in the given connection state.
+     *
+     * @param state the connection state.
+     * @return the time spent in the state.
+     */
+    public long getTimeInStateMs(ConnectionState state) {
+        switch (state) {
+            case DISCONNECTED: return values[DISCONNECTED_MS];
+            case CONNECTING: return values[CONNECTING_MS];
+            case CONNECTED: return values[CONNECTED_MS];
+            default:
+                throw new IllegalArgumentException("Unknown connection state: " + state);
+        }
+    }
+
+    @Override
+    public String toString() {
+        return String.format(Locale.US,
+                "SyncSessionMetrics{bytesUploaded=%d, bytesDownloaded=%d, uploadBatches=%d, downloadBatches=%d, " +
+                        "uploadRoundTrips=%d, averageUploadLatencyMs=%d, maxUploadLatencyMs=%d, reconnects=%d, " +
+                        "disconnectedMs=%d, connectingMs=%d, connectedMs=%d}",
+                getBytesUploaded(), getBytesDownloaded(), getUploadBatches(), getDownloadBatches(),
+                getUploadRoundTrips(), getAverageUploadLatencyMs(), getMaxUploadLatencyMs(), getReconnects(),
+                values[DISCONNECTED_MS], values[CONNECTING_MS], values[CONNECTED_MS]);
+    }
+}